@@ -26,6 +26,7 @@
 #ifndef TGUI_XHTML_ATTRIBUTES_HPP
 #define TGUI_XHTML_ATTRIBUTES_HPP
 
+#include <cstdint>
 #include <cwctype>
 #include <string>
 #include <vector>
@@ -33,6 +34,7 @@
 #include "TGUI/Xhtml/MarkupSizeType.hpp"
 #include "TGUI/Xhtml/MarkupBorderStyle.hpp"
 #include "TGUI/Xhtml/Dom/XhtmlEntityResolver.hpp"
+#include "TGUI/Xhtml/Dom/XhtmlMemoryResource.hpp"
 
 namespace tgui  { namespace xhtml
 {
@@ -40,19 +42,28 @@ namespace tgui  { namespace xhtml
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// @brief Generic XHTML attribute
     ///
-    /// This class holds a key / value pair
+    /// This class holds a key / value pair. A parsed value is kept as span into the (shared) source slice of its tag and is
+    /// normalized and entity resolved on the first call of getValue(), so values that are never read are never decoded.
+    /// Values that are not longer than the span bookkeeping itself (see PendingValueOverhead) are decoded immediately.
+    /// Since the first getValue() call updates the attribute, concurrent first reads of the same attribute must be
+    /// synchronized by the caller.
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     class TGUI_API XhtmlAttribute
     {
     public:
         using Ptr = std::shared_ptr<XhtmlAttribute>;                 //!< Shared Attribute pointer
         using ConstPtr = std::shared_ptr<const XhtmlAttribute>;      //!< Shared constant Attribute pointer
+        using SourcePtr = std::shared_ptr<const tgui::String>;       //!< Shared source buffer pointer, the raw values refer to
+        using Revision = std::uint64_t;                              //!< Process-wide unique stamp of a value assignment
+
+        /// The memory a not yet decoded value occupies in addition to the (then empty) value - shorter values are decoded immediately
+        static constexpr size_t PendingValueOverhead = sizeof(SourcePtr) + 2 * sizeof(size_t);
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief The default constructor
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         XhtmlAttribute()
-            : m_name(), m_value()
+            : m_name(), m_value(), m_source(), m_sourceOffset(0), m_sourceLength(0), m_revision(0)
         {   ;   }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -62,7 +73,7 @@ namespace tgui  { namespace xhtml
         /// @param value  The attribute value to initialize
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         XhtmlAttribute(const tgui::String& name, const tgui::String& value = U"")
-            : m_name(name), m_value(value)
+            : m_name(name), m_value(value), m_source(), m_sourceOffset(0), m_sourceLength(0), m_revision(nextRevision())
         {   ;   }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -71,7 +82,8 @@ namespace tgui  { namespace xhtml
         /// @param attribute    The attribute to initialize from
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         XhtmlAttribute(const XhtmlAttribute& attribute)
-            : m_name(attribute.m_name), m_value(attribute.m_value)
+            : m_name(attribute.m_name), m_value(attribute.m_value), m_source(attribute.m_source),
+              m_sourceOffset(attribute.m_sourceOffset), m_sourceLength(attribute.m_sourceLength), m_revision(attribute.m_revision)
         {   ;   }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -83,16 +95,26 @@ namespace tgui  { namespace xhtml
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Creates an XHTML attribute from raw string (on success)
         ///
-        /// @param messages         The collection of error/warning messages, created during the parser run
-        /// @param buffer           The raw string to parse for the attribute
+        /// @param diagnostics      The receiver of the errors/warnings, created during the parser run
+        /// @param source           The raw string to parse for the attribute, the attribute value keeps a reference to it
         /// @param beginPosition    The position within the raw string to start to parse for the attribute
         /// @param processedLength  The number of characters that have been parsed from the buffer
         ///
         /// @return The attribute on success, or nullptr otherwise
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        static XhtmlAttribute::Ptr createFromStr(std::vector<std::tuple<MessageType, String>>& messages, const tgui::String& buffer,
+        static XhtmlAttribute::Ptr createFromStr(XhtmlDiagnostics& diagnostics, const SourcePtr& source,
             const size_t beginPosition, size_t& processedLength);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Moves the not yet decoded values of the indicated attributes into one common source slice
+        ///
+        /// The attributes of one tag typically refer to the complete document (or tag markup) buffer. After this call they
+        /// share a copy of the range, that covers their raw values only, so an unread value doesn't keep the buffer alive.
+        ///
+        /// @param attributes  The attributes (typically of one tag) to move the not yet decoded values of
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void sliceSources(const std::vector<XhtmlAttribute::Ptr>& attributes);
+
     public:
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Get the attribute name of this attribute
@@ -105,23 +127,76 @@ namespace tgui  { namespace xhtml
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Get the attribute value of this attribute
         ///
+        /// The raw value is decoded on the first call, afterwards the reference to the source buffer is released.
+        ///
         /// @return The attribute value of this attribute
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         inline const tgui::String& getValue() const
-        {   return m_value;   }
+        {
+            if (m_source != nullptr)
+                decodeValue();
+            return m_value;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Determines whether the value of this attribute is still a not decoded span into the source buffer
+        ///
+        /// @return The flag whether the value is not yet decoded
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        inline bool isValuePending() const
+        {   return m_source != nullptr;   }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Gets the revision of the value, that changes with every value assignment
+        ///
+        /// Revisions are unique within the process, so a cache can detect a changed value as well as a replaced attribute.
+        /// Attributes without an assigned value have revision 0.
+        ///
+        /// @return The revision of the value
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        inline Revision getRevision() const
+        {   return m_revision;   }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates a new process-wide unique revision (thread-safe)
+        ///
+        /// @return The new revision, never 0
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static Revision nextRevision();
 
     protected:
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Sets and normalizes the value and resolves contained entities (if any)
         ///
-        /// @param messages  The collection of error messages, created during the parser run
-        /// @param rawValue  The raw string of the value to set
+        /// @param diagnostics  The receiver of the errors/warnings, created during the parser run
+        /// @param rawValue     The raw string of the value to set
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        virtual void putValue(std::vector<std::tuple<MessageType, tgui::String>>& messages, const tgui::String& rawValue);
+        virtual void putValue(XhtmlDiagnostics& diagnostics, const tgui::String& rawValue);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sets the value as span into the source buffer, the value is decoded on the first call of getValue()
+        ///
+        /// A raw value, that is not longer than PendingValueOverhead, is decoded immediately.
+        ///
+        /// @param diagnostics  The receiver of the errors/warnings, created during the parser run
+        /// @param source       The source buffer, that contains the raw value
+        /// @param offset       The position of the raw value within the source buffer
+        /// @param length       The length of the raw value
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void putRawValue(XhtmlDiagnostics& diagnostics, const SourcePtr& source, size_t offset, size_t length);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Decodes the span into the source buffer to the value and releases the source buffer
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void decodeValue() const;
 
     protected:
-        tgui::String m_name;   //!< This attribute's name
-        tgui::String m_value;  //!< This attribute's value
+        tgui::String         m_name;          //!< This attribute's name
+        mutable tgui::String m_value;         //!< This attribute's value (valid, if there is no pending source buffer)
+        mutable SourcePtr    m_source;        //!< The source buffer of the not yet decoded raw value, or nullptr
+        size_t               m_sourceOffset;  //!< The position of the raw value within the source buffer
+        size_t               m_sourceLength;  //!< The length of the raw value within the source buffer
+        Revision             m_revision;      //!< The revision of the value, see getRevision()
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -627,24 +702,27 @@ namespace tgui  { namespace xhtml
         {   return m_styleEntryFlags;   }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        /// @brief Sets and normalizes the value and resolves contained entities (if any)
+        /// @brief Sets and normalizes the value, resolves contained entities (if any) and applies the CSS declarations
         ///
-        /// @param messages  The collection of error messages, created during the parser run
-        /// @param rawValue  The raw string of the value to set
+        /// The declarations are tokenized in place, the properties are dispatched by a perfect hash of their names and the
+        /// lengths and colors are parsed from the tokens, so no temporary strings are created.
+        ///
+        /// @param diagnostics  The receiver of the errors/warnings, created during the parser run
+        /// @param rawValue     The raw string of the value to set
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void putValue(std::vector<std::tuple<tgui::xhtml::MessageType, String>>& messages, const tgui::String& rawValue) override;
+        void putValue(XhtmlDiagnostics& diagnostics, const tgui::String& rawValue) override;
 
-    public:
-        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        /// @brief Determines whether indicated string contains case insensitive one of the predicates
-        ///
-        /// @param left      The string to be compared with the predicates
-        /// @param patterns  The strings to check containment
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sets the value from a span into the source buffer - the style is needed for the layout, so it's decoded at once
         ///
-        /// @return          The flag indicating whether one of the predicates is contained (true) or not (false)
-        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        static bool containsAnyIgnoreCase(const tgui::String& nocaseLeft, const std::vector<tgui::String>& patterns);
+        /// @param diagnostics  The receiver of the errors/warnings, created during the parser run
+        /// @param source       The source buffer, that contains the raw value
+        /// @param offset       The position of the raw value within the source buffer
+        /// @param length       The length of the raw value
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void putRawValue(XhtmlDiagnostics& diagnostics, const SourcePtr& source, size_t offset, size_t length) override;
 
+    public:
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Tries to parse the color
         ///
@@ -653,7 +731,19 @@ namespace tgui  { namespace xhtml
         ///
         /// @return            The flag indicating whether parse succeded (true) or not (false)
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        static bool tryParseColor(const tgui::String& colorString, Color& colorValue);
+        static inline bool tryParseColor(const tgui::String& colorString, Color& colorValue)
+        {   return tryParseColor(colorString.data(), colorString.length(), colorValue);   }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Tries to parse the color from a span of characters (without any allocation)
+        ///
+        /// @param colorString The first character of the span, that should contain information about the color
+        /// @param length      The length of the span
+        /// @param colorValue  [OUT] The color on success
+        ///
+        /// @return            The flag indicating whether parse succeded (true) or not (false)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool tryParseColor(const char32_t* colorString, size_t length, Color& colorValue);
 
     private:
         Color              m_color;             //!< The foreground/text color
@@ -45,7 +45,7 @@ namespace tgui  { namespace xhtml
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         XhtmlContainerElement()
             : XhtmlElement()
-        {   m_children = std::make_shared<std::vector<XhtmlElement::Ptr>>();   }
+        {   m_children = XhtmlMemoryResource::makeShared<std::vector<XhtmlElement::Ptr>>();   }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief The initializing constructor
@@ -56,14 +56,14 @@ namespace tgui  { namespace xhtml
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         XhtmlContainerElement(const char* typeName)
             : XhtmlElement(typeName)
-        {   m_children = std::make_shared<std::vector<XhtmlElement::Ptr>>();   }
+        {   m_children = XhtmlMemoryResource::makeShared<std::vector<XhtmlElement::Ptr>>();   }
 
     public:
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief The virtual default destructor
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual ~XhtmlContainerElement()
-        {   m_children->clear();   }
+        {   releaseChildren();   }
     };
 
 } }
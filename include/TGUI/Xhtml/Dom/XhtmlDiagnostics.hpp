@@ -0,0 +1,358 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// XHTML parser diagnostics (zlib license) provided for TGUI - Texus' Graphical User Interface
+// Copyright (C) 2023 Steffen Ploetz (Steffen.Ploetz@cityweb.de)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_XHTML_DIAGNOSTICS_HPP
+#define TGUI_XHTML_DIAGNOSTICS_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <vector>
+
+#include <TGUI/String.hpp>
+
+namespace tgui  { namespace xhtml
+{
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief The enumeration of message types
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    enum class MessageType
+    {
+        ERROR,   //!< The message represents an error
+        WARNING  //!< The message represents an warning
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief The enumeration of diagnostic codes, one for every error/warning the reader and parser can report
+    ///
+    /// The message type and the message text of a code are provided by XhtmlDiagnostics::getMessageType() and
+    /// XhtmlDiagnostics::format().
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    enum class XhtmlDiagnosticCode : std::uint16_t
+    {
+        DocumentNotReadable,             //!< The document can not be read (argument: the reason)
+        FeedNotIncremental,              //!< feed() is called for a parser, that has not been created for incremental parsing
+        FeedAfterFinish,                 //!< feed() is called after finish()
+        CommentNotClosed,                //!< A comment tag is not closed until the end of the document
+        CommentIncomplete,               //!< A comment tag is not complete at the end of the document
+        CommentNotAccuratelyClosed,      //!< A comment tag is closed by "--" without immediately following '>'
+        ElementBufferInvalid,            //!< There is nothing to parse an element from
+        ElementIndexOverrun,             //!< There are too few characters left to parse an element from
+        ElementTooLong,                  //!< A tag isn't delimited by '>' within XhtmlParser::MaxTagLength bytes (UTF-8 modes)
+        ElementNotCreated,               //!< A tag can neither be parsed as comment nor as element
+        InnerTextParentInvalid,          //!< An inner text has a parent, that can't hold it (arguments: the text, the parent's type name)
+        InnerTextParentMissing,          //!< An inner text has no parent (argument: the text)
+        RemainingCharacters,             //!< There are characters left at the end of the document (argument: the characters)
+        MultipleHtmlRoots,               //!< There is more than one 'html' root element
+        EndTagMismatch,                  //!< An end tag doesn't match the open start tag (arguments: start and end tag type names)
+        EndTagUnmatched,                 //!< An end tag has no open start tag (argument: the end tag type name)
+        TagBufferInvalid,                //!< There is nothing to parse a tag from
+        TagStartInvalid,                 //!< A tag doesn't start with '<'
+        TagTypeNameNotEmpty,             //!< An empty tag "<>" has a type name
+        TagClosingReached,               //!< An empty tag "<>" is a closing tag
+        TagTypeNameStartInvalid,         //!< A tag type name doesn't start with an alphabet character
+        TagTypeNameEmpty,                //!< A tag type name is of length 0
+        TagTypeNameInvalid,              //!< A tag type name contains invalid characters
+        ScriptTagNotClosed,              //!< A tag inside a script is not closed (argument: the type name)
+        ScriptClosingTagExpected,        //!< A tag inside a script is no closing tag (argument: the type name)
+        ClosingTagEndExpected,           //!< A closing tag isn't delimited by '>' (argument: the type name)
+        ClosingTagTypeNameEmpty,         //!< A closing tag has no type name
+        TagNotAutoClosable,              //!< A tag is delimited by "/>", but is no auto-closed tag (argument: the type name)
+        TagNotDelimitedAfterInnerText,   //!< A tag is not delimited until the end of the document (argument: the type name)
+        TagNotOpenedBeforeEndSymbol,     //!< A tag contains '/' before it is opened (argument: the type name)
+        TagNotDelimited,                 //!< A tag isn't delimited by '>' (argument: the type name)
+        ElementTypeUnknown,              //!< A tag type name is unknown, an 'empty' element is created (argument: the type name)
+        AttributesBufferInvalid,         //!< There is nothing to parse the attributes from
+        AttributeBufferInvalid,          //!< There is nothing to parse an attribute from
+        AttributeNameEmpty,              //!< An attribute name is of length 0
+        AttributeValueInvalid,           //!< There is no attribute value
+        StyleValueUnrecognized,          //!< A style value is too short to be recognized (argument: the style value)
+        StyleValueNotSplittable,         //!< A style value can't be split into key and value (argument: the style value)
+        StyleKeyValueUnrecognized,       //!< The key or value of a style value is too short (argument: the style value)
+        StyleValueInvalid,               //!< The value of a style value is not supported (argument: the style value)
+        StyleColorInvalid,               //!< The color of a style value is not supported (argument: the style value)
+        StyleSheetBlockNotClosed,        //!< A style sheet block or comment is not closed until the end of the style sheet
+        StyleSheetRuleIncomplete,        //!< A style sheet rule has no declaration block (argument: the selector list)
+        StyleSheetAtRuleIgnored,         //!< A style sheet at-rule is not supported and skipped (argument: the at-keyword)
+        StyleSheetSelectorUnsupported,   //!< A selector is not supported and skipped (argument: the selector)
+        EntityInvalid,                   //!< There is nothing to resolve an entity from
+        Count                            //!< The number of diagnostic codes (no diagnostic code)
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief The enumeration of diagnostics modes, that determine the effort spent on errors/warnings while parsing
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    enum class XhtmlDiagnosticsMode
+    {
+        Collect,    //!< Collect every diagnostic with code, location and arguments (the message text is formatted on demand)
+        CountOnly,  //!< Count the errors and warnings only
+        None        //!< Ignore all diagnostics
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief One error/warning, that occurred while reading or parsing an XHTML document
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct XhtmlDiagnostic
+    {
+        XhtmlDiagnosticCode Code;           //!< The diagnostic code
+        size_t              Offset;         //!< The offset of the markup construct within the document (bytes in UTF-8 mode
+                                            //!< or code points in UTF-32 mode)
+        size_t              Line;           //!< The 1-based line of the offset, or 0 if there is no location
+        size_t              Column;         //!< The 1-based column of the offset (in the units of the offset), or 0 if there
+                                            //!< is no location
+        tgui::String        Argument;       //!< The first argument of the message text, can be empty
+        tgui::String        SecondArgument; //!< The second argument of the message text, can be empty
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Receives the errors/warnings of one parser run
+    ///
+    /// Reporting a diagnostic costs one branch, if the mode is XhtmlDiagnosticsMode::None, and one increment, if the mode is
+    /// XhtmlDiagnosticsMode::CountOnly. Only XhtmlDiagnosticsMode::Collect stores the diagnostic (code, location and the
+    /// copied arguments) - the message text is never built while parsing, but formatted on demand via format().
+    ///
+    /// The location is provided by the parser via setLocation() before the markup construct is parsed, the diagnostics of
+    /// nested parsing functions (element, attribute and entity creation) refer to this location.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API XhtmlDiagnostics
+    {
+    public:
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief The initializing constructor
+        ///
+        /// @param mode  The diagnostics mode
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        explicit XhtmlDiagnostics(XhtmlDiagnosticsMode mode = XhtmlDiagnosticsMode::Collect)
+            : m_mode(mode), m_errorCount(0), m_warningCount(0), m_offset(0), m_line(0), m_column(0), m_diagnostics()
+        { }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Gets the diagnostics mode
+        ///
+        /// @return The diagnostics mode
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        inline XhtmlDiagnosticsMode getMode() const
+        {   return m_mode;   }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sets the diagnostics mode, must not be changed while parsing
+        ///
+        /// @param mode  The diagnostics mode
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        inline void setMode(XhtmlDiagnosticsMode mode)
+        {   m_mode = mode;   }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Determines whether the diagnostics are collected (and thus the location is required)
+        ///
+        /// @return The flag whether the diagnostics are collected
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        inline bool isCollecting() const
+        {   return m_mode == XhtmlDiagnosticsMode::Collect;   }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sets the location, the subsequently reported diagnostics refer to
+        ///
+        /// @param offset  The offset of the markup construct within the document
+        /// @param line    The 1-based line of the offset
+        /// @param column  The 1-based column of the offset
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        inline void setLocation(size_t offset, size_t line, size_t column)
+        {
+            m_offset = offset;
+            m_line   = line;
+            m_column = column;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Reports a diagnostic without arguments
+        ///
+        /// @param code  The diagnostic code
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        inline void report(XhtmlDiagnosticCode code)
+        {
+            if (m_mode != XhtmlDiagnosticsMode::None)
+                count(code);
+            if (m_mode == XhtmlDiagnosticsMode::Collect)
+                collect(code, nullptr, nullptr);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Reports a diagnostic with one argument, the argument is copied only if the diagnostics are collected
+        ///
+        /// @param code      The diagnostic code
+        /// @param argument  The first argument of the message text
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        inline void report(XhtmlDiagnosticCode code, const tgui::String& argument)
+        {
+            if (m_mode != XhtmlDiagnosticsMode::None)
+                count(code);
+            if (m_mode == XhtmlDiagnosticsMode::Collect)
+                collect(code, &argument, nullptr);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Reports a diagnostic with one argument, that is a span of characters and copied only if the diagnostics are collected
+        ///
+        /// @param code      The diagnostic code
+        /// @param argument  The first character of the first argument of the message text, needs not to be zero terminated
+        /// @param length    The length of the first argument of the message text
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        inline void report(XhtmlDiagnosticCode code, const char32_t* argument, size_t length)
+        {
+            if (m_mode != XhtmlDiagnosticsMode::None)
+                count(code);
+            if (m_mode == XhtmlDiagnosticsMode::Collect)
+            {
+                const tgui::String first(std::u32string(argument, length));
+                collect(code, &first, nullptr);
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Reports a diagnostic with two arguments, the arguments are copied only if the diagnostics are collected
+        ///
+        /// @param code            The diagnostic code
+        /// @param argument        The first argument of the message text
+        /// @param secondArgument  The second argument of the message text
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        inline void report(XhtmlDiagnosticCode code, const tgui::String& argument, const tgui::String& secondArgument)
+        {
+            if (m_mode != XhtmlDiagnosticsMode::None)
+                count(code);
+            if (m_mode == XhtmlDiagnosticsMode::Collect)
+                collect(code, &argument, &secondArgument);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Reports a diagnostic with (ASCII) type name arguments, that are converted only if the diagnostics are collected
+        ///
+        /// @param code            The diagnostic code
+        /// @param argument        The first argument of the message text
+        /// @param secondArgument  The second argument of the message text, or nullptr
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        inline void report(XhtmlDiagnosticCode code, const char* argument, const char* secondArgument = nullptr)
+        {
+            if (m_mode != XhtmlDiagnosticsMode::None)
+                count(code);
+            if (m_mode == XhtmlDiagnosticsMode::Collect)
+            {
+                const tgui::String first(argument != nullptr ? argument : "");
+                const tgui::String second(secondArgument != nullptr ? secondArgument : "");
+                collect(code, &first, &second);
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Gets the number of reported errors (0 if the mode is XhtmlDiagnosticsMode::None)
+        ///
+        /// @return The number of reported errors
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        inline size_t getErrorCount() const
+        {   return m_errorCount;   }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Gets the number of reported warnings (0 if the mode is XhtmlDiagnosticsMode::None)
+        ///
+        /// @return The number of reported warnings
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        inline size_t getWarningCount() const
+        {   return m_warningCount;   }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Gets the collected diagnostics (empty unless the mode is XhtmlDiagnosticsMode::Collect)
+        ///
+        /// @return The collected diagnostics in the order of their occurrence
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        inline const std::vector<XhtmlDiagnostic>& getDiagnostics() const
+        {   return m_diagnostics;   }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes all counts and collected diagnostics and resets the location (the mode is kept)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void clear();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Formats the collected diagnostics to message texts
+        ///
+        /// @return The collection of error/warning messages
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::vector<std::tuple<MessageType, tgui::String>> toMessages() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Gets the message type of the indicated diagnostic code
+        ///
+        /// @param code  The diagnostic code to get the message type for
+        ///
+        /// @return The message type
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static MessageType getMessageType(XhtmlDiagnosticCode code);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Formats the message text of the indicated diagnostic, including its location (if any)
+        ///
+        /// @param diagnostic  The diagnostic to format
+        ///
+        /// @return The message text
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static tgui::String format(const XhtmlDiagnostic& diagnostic);
+
+    private:
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Counts a diagnostic as error or warning
+        ///
+        /// @param code  The diagnostic code
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        inline void count(XhtmlDiagnosticCode code)
+        {
+            if (getMessageType(code) == MessageType::ERROR)
+                m_errorCount++;
+            else
+                m_warningCount++;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Stores a diagnostic with the current location
+        ///
+        /// @param code            The diagnostic code
+        /// @param argument        The first argument of the message text, or nullptr
+        /// @param secondArgument  The second argument of the message text, or nullptr
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void collect(XhtmlDiagnosticCode code, const tgui::String* argument, const tgui::String* secondArgument);
+
+    private:
+        XhtmlDiagnosticsMode         m_mode;         //!< The diagnostics mode
+        size_t                       m_errorCount;   //!< The number of reported errors
+        size_t                       m_warningCount; //!< The number of reported warnings
+        size_t                       m_offset;       //!< The offset of the current location
+        size_t                       m_line;         //!< The line of the current location, or 0 if there is no location
+        size_t                       m_column;       //!< The column of the current location, or 0 if there is no location
+        std::vector<XhtmlDiagnostic> m_diagnostics;  //!< The collected diagnostics
+    };
+
+} }
+
+#endif // TGUI_XHTML_DIAGNOSTICS_HPP
@@ -34,6 +34,8 @@ namespace tgui  { namespace xhtml
     struct TGUI_API XhtmlElementType
     {
     public:
+        using TagId = std::uint8_t;                                            //!< The small integer ID of an element type
+
         static constexpr const char  DocType[] = "!doctype";                   //!< The tag name of an !DOCTYPE element
         static constexpr const char  Document[] = "document";                  //!< The tag name of a DOCUMENT element
         static constexpr const char  Style[] = "style";                        //!< The tag name of a STYLE element
@@ -83,17 +85,75 @@ namespace tgui  { namespace xhtml
         static constexpr const char* Anchor = MarkupLanguageElement::Anchor;   //!< The tag name of an ANCHOR element
         static constexpr const char  Image[] = "img";                          //!< The tag name of an IMAGE element
         static constexpr const char  Script[] = "script";                      //!< The tag name of a SCRIPT element
+        static constexpr const char  Empty[] = "empty";                        //!< The tag name of the fall back for unknown elements
+
+        static constexpr TagId       EmptyTagId = 44;                          //!< The tag ID of the fall back for unknown elements
 
     private:
-        static XhtmlElementType m_dataTypes[]; //!< The supported XHTML element types
+        static const XhtmlElementType m_dataTypes[]; //!< The supported XHTML element types, the index is the tag ID
 
     public:
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Determine the element type from the element type name
         ///
-        /// @param text      The element type from the element type name on success, or the element type 'empty' otherwise
+        /// @param typeName  The (case insensitive) element type name
+        ///
+        /// @return The element type on success, or the element type 'empty' otherwise
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static XhtmlElementType getType(const char* typeName = Empty);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Determine the element type from the tag ID
+        ///
+        /// @param tagId  The tag ID, as returned by getTagId()
+        ///
+        /// @return The element type on success, or the element type 'empty' otherwise
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static const XhtmlElementType& getTypeById(TagId tagId);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Determine the tag ID from the element type name
+        ///
+        /// The lookup uses a perfect hash over the length and three characters of the name, that is verified at compile time,
+        /// so it costs only one hash table access and one string compare.
+        ///
+        /// @param typeName  The (case insensitive) element type name
+        ///
+        /// @return The tag ID on success, or EmptyTagId otherwise
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static TagId getTagId(const char* typeName);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Determine the tag ID from the element type name
+        ///
+        /// @param typeName  The first character of the (case insensitive) element type name, needs not to be zero terminated
+        /// @param length    The length of the element type name
+        ///
+        /// @return The tag ID on success, or EmptyTagId otherwise
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        static XhtmlElementType getType(const char* typeName = "empty");
+        static TagId getTagId(const char* typeName, size_t length);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Determine the tag ID from the element type name
+        ///
+        /// @param typeName  The first character of the (case insensitive) element type name, needs not to be zero terminated
+        /// @param length    The length of the element type name
+        ///
+        /// @return The tag ID on success, or EmptyTagId otherwise
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static TagId getTagId(const char32_t* typeName, size_t length);
+
+    private:
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Determine the tag ID from the element type name for any character type
+        ///
+        /// @param typeName  The first character of the (case insensitive) element type name
+        /// @param length    The length of the element type name
+        ///
+        /// @return The tag ID on success, or EmptyTagId otherwise
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <typename CharT>
+        static TagId lookupTagId(const CharT* typeName, size_t length);
 
     public:
         const char*             TypeName;            //!< The element type name
@@ -116,6 +176,7 @@ namespace tgui  { namespace xhtml
     class TGUI_API XhtmlStyleableNoncontainerElement;
     class TGUI_API XhtmlStyleableContainerElement;
     class TGUI_API XhtmlListItem;
+    struct TGUI_API XhtmlMatchedStyle;
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// @brief Base class for **all** XHTML element (text and node) classes
@@ -133,10 +194,10 @@ namespace tgui  { namespace xhtml
         /// ATTENTION: To register a parent and to register this new object to a parent are the responsibilities of the caller!
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         XhtmlElement()
-            : m_elementType(XhtmlElementType::getType()), m_parent(nullptr), m_attributes(), m_children(),
+            : m_tagId(XhtmlElementType::EmptyTagId), m_elementType(XhtmlElementType::getTypeById(m_tagId)), m_parent(), m_attributes(), m_children(),
               m_startTagBeginPosition(0), m_startTagEndPosition(0),m_stopTagBeginPosition(0), m_stopTagEndPosition(0),
-              m_isParsedAsAutoClosed(false)
-        {   m_attributes = std::make_shared<std::vector<XhtmlAttribute::Ptr>>();   }
+              m_isParsedAsAutoClosed(false), m_matchedStyle()
+        {   m_attributes = XhtmlMemoryResource::makeShared<std::vector<XhtmlAttribute::Ptr>>();   }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief The initializing constructor
@@ -146,10 +207,10 @@ namespace tgui  { namespace xhtml
         /// @param typeName  The type name of the element type to associate
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         XhtmlElement(const char* typeName)
-            : m_elementType(XhtmlElementType::getType(typeName)), m_parent(nullptr), m_attributes(), m_children(),
+            : m_tagId(XhtmlElementType::getTagId(typeName)), m_elementType(XhtmlElementType::getTypeById(m_tagId)), m_parent(), m_attributes(), m_children(),
               m_startTagBeginPosition(0), m_startTagEndPosition(0),m_stopTagBeginPosition(0), m_stopTagEndPosition(0),
-              m_isParsedAsAutoClosed(false)
-        {   m_attributes = std::make_shared<std::vector<XhtmlAttribute::Ptr>>();   }
+              m_isParsedAsAutoClosed(false), m_matchedStyle()
+        {   m_attributes = XhtmlMemoryResource::makeShared<std::vector<XhtmlAttribute::Ptr>>();   }
 
 
     public:
@@ -205,6 +266,20 @@ namespace tgui  { namespace xhtml
         static XhtmlElement::Ptr createAuto(const char* typeName, XhtmlElement::Ptr parent,
             const size_t beginPosition, const size_t endPosition, const bool isParsedAsAutoClosed);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates a new XHTML element, according to the indicated tag ID
+        ///
+        /// @param tagId                 The tag ID of the requested XHTML element type, as returned by XhtmlElementType::getTagId()
+        /// @param parent                The parent to register
+        /// @param beginPosition         The cursor position of the XHTML parser, the start tag of this element begins
+        /// @param endPosition           The cursor position of the XHTML parser, the start tag of this element ends
+        /// @param isParsedAsAutoClosed  The flag indicating whether the XHTML parser detected this element has no closing tag
+        ///
+        /// @return The new XHTML element of the requested type on success, or a generic XHTML element otherwise
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static XhtmlElement::Ptr createAuto(XhtmlElementType::TagId tagId, XhtmlElement::Ptr parent,
+            const size_t beginPosition, const size_t endPosition, const bool isParsedAsAutoClosed);
+
         //-----------------------------------------------------------------------------------------------------------------------
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -531,7 +606,7 @@ public:
         /// @return The new H1 (styleable container) node
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         static inline std::shared_ptr<XhtmlStyleableContainerElement> createH1(XhtmlElement::Ptr parent, const String& text)
-        {   return createStyleableContainer(XhtmlElementType::H1, parent, std::dynamic_pointer_cast<XhtmlElement>(std::make_shared<XhtmlInnerText>(text)));   }
+        {   return createStyleableContainer(XhtmlElementType::H1, parent, std::dynamic_pointer_cast<XhtmlElement>(XhtmlMemoryResource::makeShared<XhtmlInnerText>(text)));   }
 
         //-----------------------------------------------------------------------------------------------------------------------
 
@@ -580,7 +655,7 @@ public:
         /// @return The new H2 (styleable container) node
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         static inline std::shared_ptr<XhtmlStyleableContainerElement> createH2(XhtmlElement::Ptr parent, const String& text)
-        {   return createStyleableContainer(XhtmlElementType::H2, parent, std::dynamic_pointer_cast<XhtmlElement>(std::make_shared<XhtmlInnerText>(text)));   }
+        {   return createStyleableContainer(XhtmlElementType::H2, parent, std::dynamic_pointer_cast<XhtmlElement>(XhtmlMemoryResource::makeShared<XhtmlInnerText>(text)));   }
 
         //-----------------------------------------------------------------------------------------------------------------------
 
@@ -627,7 +702,7 @@ public:
         /// @return The new H3 (styleable container) node
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         static inline std::shared_ptr<XhtmlStyleableContainerElement> createH3(XhtmlElement::Ptr parent, const String& text)
-        {   return createStyleableContainer(XhtmlElementType::H3, parent, std::dynamic_pointer_cast<XhtmlElement>(std::make_shared<XhtmlInnerText>(text)));   }
+        {   return createStyleableContainer(XhtmlElementType::H3, parent, std::dynamic_pointer_cast<XhtmlElement>(XhtmlMemoryResource::makeShared<XhtmlInnerText>(text)));   }
 
         //-----------------------------------------------------------------------------------------------------------------------
 
@@ -674,7 +749,7 @@ public:
         /// @return The new H4 (styleable container) node
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         static inline std::shared_ptr<XhtmlStyleableContainerElement> createH4(XhtmlElement::Ptr parent, const String& text)
-        {   return createStyleableContainer(XhtmlElementType::H4, parent, std::dynamic_pointer_cast<XhtmlElement>(std::make_shared<XhtmlInnerText>(text)));   }
+        {   return createStyleableContainer(XhtmlElementType::H4, parent, std::dynamic_pointer_cast<XhtmlElement>(XhtmlMemoryResource::makeShared<XhtmlInnerText>(text)));   }
 
         //-----------------------------------------------------------------------------------------------------------------------
 
@@ -721,7 +796,7 @@ public:
         /// @return The new H5 (styleable container) node
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         static inline std::shared_ptr<XhtmlStyleableContainerElement> createH5(XhtmlElement::Ptr parent, const String& text)
-        {   return createStyleableContainer(XhtmlElementType::H5, parent, std::dynamic_pointer_cast<XhtmlElement>(std::make_shared<XhtmlInnerText>(text)));   }
+        {   return createStyleableContainer(XhtmlElementType::H5, parent, std::dynamic_pointer_cast<XhtmlElement>(XhtmlMemoryResource::makeShared<XhtmlInnerText>(text)));   }
 
         //-----------------------------------------------------------------------------------------------------------------------
 
@@ -768,7 +843,7 @@ public:
         /// @return The new H6 (styleable container) node
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         static inline std::shared_ptr<XhtmlStyleableContainerElement> createH6(XhtmlElement::Ptr parent, const String& text)
-        {   return createStyleableContainer(XhtmlElementType::H6, parent, std::dynamic_pointer_cast<XhtmlElement>(std::make_shared<XhtmlInnerText>(text)));   }
+        {   return createStyleableContainer(XhtmlElementType::H6, parent, std::dynamic_pointer_cast<XhtmlElement>(XhtmlMemoryResource::makeShared<XhtmlInnerText>(text)));   }
 
         //-----------------------------------------------------------------------------------------------------------------------
 
@@ -815,7 +890,7 @@ public:
         /// @return The new EM (container) node
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         static inline std::shared_ptr<XhtmlContainerElement> createEmphasized(XhtmlElement::Ptr parent, const String& text)
-        {   return createContainer(XhtmlElementType::Emphasized, parent, std::dynamic_pointer_cast<XhtmlElement>(std::make_shared<XhtmlInnerText>(text)));   }
+        {   return createContainer(XhtmlElementType::Emphasized, parent, std::dynamic_pointer_cast<XhtmlElement>(XhtmlMemoryResource::makeShared<XhtmlInnerText>(text)));   }
 
         //-----------------------------------------------------------------------------------------------------------------------
 
@@ -862,7 +937,7 @@ public:
         /// @return The new I (container) node
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         static inline std::shared_ptr<XhtmlContainerElement> createItalic(XhtmlElement::Ptr parent, const String& text)
-        {   return createContainer(XhtmlElementType::Italic, parent, std::dynamic_pointer_cast<XhtmlElement>(std::make_shared<XhtmlInnerText>(text)));   }
+        {   return createContainer(XhtmlElementType::Italic, parent, std::dynamic_pointer_cast<XhtmlElement>(XhtmlMemoryResource::makeShared<XhtmlInnerText>(text)));   }
 
         //-----------------------------------------------------------------------------------------------------------------------
 
@@ -909,7 +984,7 @@ public:
         /// @return The new Strong (container) node
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         static inline std::shared_ptr<XhtmlContainerElement> createStrong(XhtmlElement::Ptr parent, const String& text)
-        {   return createContainer(XhtmlElementType::Strong, parent, std::dynamic_pointer_cast<XhtmlElement>(std::make_shared<XhtmlInnerText>(text)));   }
+        {   return createContainer(XhtmlElementType::Strong, parent, std::dynamic_pointer_cast<XhtmlElement>(XhtmlMemoryResource::makeShared<XhtmlInnerText>(text)));   }
 
         //-----------------------------------------------------------------------------------------------------------------------
 
@@ -956,7 +1031,7 @@ public:
         /// @return The new Bold (container) node
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         static inline std::shared_ptr<XhtmlContainerElement> createBold(XhtmlElement::Ptr parent, const String& text)
-        {   return createContainer(XhtmlElementType::Bold, parent, std::dynamic_pointer_cast<XhtmlElement>(std::make_shared<XhtmlInnerText>(text)));   }
+        {   return createContainer(XhtmlElementType::Bold, parent, std::dynamic_pointer_cast<XhtmlElement>(XhtmlMemoryResource::makeShared<XhtmlInnerText>(text)));   }
 
         //-----------------------------------------------------------------------------------------------------------------------
 
@@ -1003,7 +1078,7 @@ public:
         /// @return The new Underline/Misspelled (container) node
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         static inline std::shared_ptr<XhtmlContainerElement> createUnderline(XhtmlElement::Ptr parent, const String& text)
-        {   return createContainer(XhtmlElementType::Underline, parent, std::dynamic_pointer_cast<XhtmlElement>(std::make_shared<XhtmlInnerText>(text)));   }
+        {   return createContainer(XhtmlElementType::Underline, parent, std::dynamic_pointer_cast<XhtmlElement>(XhtmlMemoryResource::makeShared<XhtmlInnerText>(text)));   }
 
         //-----------------------------------------------------------------------------------------------------------------------
 
@@ -1050,7 +1125,7 @@ public:
         /// @return The new Superscript (container) node
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         static inline std::shared_ptr<XhtmlContainerElement> createSuperscript(XhtmlElement::Ptr parent, const String& text)
-        {   return createContainer(XhtmlElementType::Superscript, parent, std::dynamic_pointer_cast<XhtmlElement>(std::make_shared<XhtmlInnerText>(text)));   }
+        {   return createContainer(XhtmlElementType::Superscript, parent, std::dynamic_pointer_cast<XhtmlElement>(XhtmlMemoryResource::makeShared<XhtmlInnerText>(text)));   }
 
         //-----------------------------------------------------------------------------------------------------------------------
 
@@ -1097,7 +1172,7 @@ public:
         /// @return The new Subscript (container) node
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         static inline std::shared_ptr<XhtmlContainerElement> createSubscript(XhtmlElement::Ptr parent, const String& text)
-        {   return createContainer(XhtmlElementType::Subscript, parent, std::dynamic_pointer_cast<XhtmlElement>(std::make_shared<XhtmlInnerText>(text)));   }
+        {   return createContainer(XhtmlElementType::Subscript, parent, std::dynamic_pointer_cast<XhtmlElement>(XhtmlMemoryResource::makeShared<XhtmlInnerText>(text)));   }
 
         //-----------------------------------------------------------------------------------------------------------------------
 
@@ -1885,6 +1960,14 @@ public:
         inline const char* getTypeName() const
         {   return m_elementType.TypeName;   }
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Gets the tag ID of the element
+        ///
+        /// @return The tag ID of the element, or XhtmlElementType::EmptyTagId for unknown elements
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        inline XhtmlElementType::TagId getTagId() const
+        {   return m_tagId;   }
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Gets the class name of the element
         ///
@@ -1994,23 +2077,34 @@ public:
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         XhtmlAttribute::Ptr getAttribute(const tgui::String& name) const;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Gets the cached result of matching the style sheet rules against this element (created on first access)
+        ///
+        /// The cache is maintained by XhtmlStyleSheet::match(), that also validates it against the current attributes.
+        ///
+        /// @return The cached style sheet matching result
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        XhtmlMatchedStyle& getMatchedStyle() const;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Sets the element's parent element. Can be nullptr
         ///
+        /// The parent is not owned (the parent owns its children), so it must be kept alive by the caller or its own parent.
+        ///
         /// @param parent  The parent to set
         ///
         /// @return The previously set parent
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         inline XhtmlElement::Ptr setParent(XhtmlElement::Ptr parent)
-        {   XhtmlElement::Ptr oldParent = m_parent; m_parent = parent; return oldParent;  }
+        {   XhtmlElement::Ptr oldParent = m_parent.lock(); m_parent = parent; return oldParent;  }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Gets the element's parent element. Can be nullptr
         ///
-        /// @return The element's parent element. Can be nullptr
+        /// @return The element's parent element. Can be nullptr (also if the parent has already been destroyed)
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         inline XhtmlElement::Ptr getParent() const
-        {   return m_parent;   }
+        {   return m_parent.lock();   }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Appends a child to the collection of parent's children and registers the parent as the child's parent
@@ -2191,22 +2285,22 @@ public:
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Creates a collection XHTML attributes from raw string (on success)
         ///
-        /// @param messages        The collection of generated error/warning messages
+        /// @param diagnostics     The receiver of the generated errors/warnings
         /// @param attributes      The collection of attributes to add the created attributes to
-        /// @param buffer          The raw string to parse from
+        /// @param source          The raw string to parse from, the attribute values keep a reference to it
         /// @param beginPosition   The offset to the parse start position within the buffer
         ///
         /// @return The number of character processes in the buffer
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        static size_t createAttributesFromParseStr(std::vector<std::tuple<MessageType, tgui::String>>& messages,
-            std::vector<XhtmlAttribute::Ptr>& attributes, const tgui::String& buffer, const size_t beginPosition);
+        static size_t createAttributesFromParseStr(XhtmlDiagnostics& diagnostics,
+            std::vector<XhtmlAttribute::Ptr>& attributes, const XhtmlAttribute::SourcePtr& source, const size_t beginPosition);
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Creates an XHTML element from raw string (on success)
         ///
-        /// @param messages         The collection of generated error/warning messages
+        /// @param diagnostics      The receiver of the generated errors/warnings
         /// @param parent           The parent XHTML element. Can be nullptr
-        /// @param buffer           The raw string to parse from
+        /// @param source           The raw string to parse from, the attribute values keep a reference to it
         /// @param beginPosition    The offset to the parse start position within the buffer
         /// @param isOpeningTag     Determine whether element is inside opening tag
         /// @param isClosingTag     Determine whether element is inside closing tag
@@ -2216,14 +2310,14 @@ public:
         ///
         /// @return The XHTML element on success, or nullptr otherwise
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        static const XhtmlElement::Ptr createElementFromParseStr(std::vector<std::tuple<tgui::xhtml::MessageType, tgui::String>>& messages,
-            XhtmlElement::Ptr parent, const tgui::String& buffer, const size_t beginPosition,
+        static const XhtmlElement::Ptr createElementFromParseStr(XhtmlDiagnostics& diagnostics,
+            XhtmlElement::Ptr parent, const XhtmlAttribute::SourcePtr& source, const size_t beginPosition,
             bool& isOpeningTag, bool& isClosingTag, bool& isInsideScript, size_t& processedLength, bool parseInnerText = true);
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Creates an XHTML element from parsed data
         ///
-        /// @param messages         The collection of generated error/warning messages
+        /// @param diagnostics      The receiver of the generated errors/warnings
         /// @param isOpeningTag     Determine whether tag parse currently is an opening tag
         /// @param isClosingTag     Determine whether tag parse currently is an closing tag
         /// @param elementOpened    Determine whether parse position within the buffer is after/within opening tag '<script ...>'
@@ -2236,7 +2330,7 @@ public:
         ///
         /// @return The XHTML element on success, or nullptr otherwise
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        static const XhtmlElement::Ptr createElementFromParseData(std::vector<std::tuple<MessageType, tgui::String>>& messages,
+        static const XhtmlElement::Ptr createElementFromParseData(XhtmlDiagnostics& diagnostics,
             bool& isOpeningTag, bool& isClosingTag, bool elementOpened, bool elementClosed, tgui::String& typeName,
             XhtmlElement::Ptr& parent, const size_t& beginPosition, const size_t& endPosition, std::vector<XhtmlAttribute::Ptr>& attributesBuffer);
 
@@ -2258,6 +2352,13 @@ public:
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         XhtmlStyleEntry::Ptr investigateStyleEntry() const;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Releases all children without recursion (safe for deeply nested element trees)
+        ///
+        /// Descendants, that are not referenced from elsewhere, are detached from their parents and released one by one.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void releaseChildren();
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Clean the type name of a tag
         ///
@@ -2277,8 +2378,9 @@ public:
         }
 
     protected:
+        XhtmlElementType::TagId                           m_tagId;                 //!< The tag ID of the associated XHTML element type
         XhtmlElementType                                  m_elementType;           //!< The associated XHTML element type
-        XhtmlElement::Ptr                                 m_parent;                //!< This element's parent element
+        std::weak_ptr<XhtmlElement>                       m_parent;                //!< This element's parent element (not owned)
         std::shared_ptr<std::vector<XhtmlAttribute::Ptr>> m_attributes;            //!< This element's attribute list
         std::shared_ptr<std::vector<XhtmlElement::Ptr>>   m_children;              //!< This element's child elements
 
@@ -2288,12 +2390,30 @@ public:
         size_t                                            m_stopTagBeginPosition;  //!< The first character prosition of the end tag
         size_t                                            m_stopTagEndPosition;    //!< The last character prosition of the end tag
         bool                                              m_isParsedAsAutoClosed;
+        mutable std::shared_ptr<XhtmlMatchedStyle>        m_matchedStyle;          //!< The cached style sheet matching result, or nullptr
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief A position within a text, the text can be distributed to two lines at
+    ///
+    /// The line ends in front of 'LineEnd' and the next line starts at 'NextLineStart'. The characters in between (spaces, or
+    /// a line break character) are not displayed at all.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct TGUI_API XhtmlBreakOpportunity
+    {
+        XhtmlBreakOpportunity(std::uint32_t lineEnd, std::uint32_t nextLineStart, bool isMandatory)
+            : LineEnd(lineEnd), NextLineStart(nextLineStart), IsMandatory(isMandatory)
+        { }
+
+        std::uint32_t LineEnd;       //!< The position behind the last character of the line
+        std::uint32_t NextLineStart; //!< The position of the first character of the next line
+        bool          IsMandatory;   //!< The flag indicating a line break character (only preformatted text must break there)
+    };
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// @brief The XHTML text element
     ///
@@ -2312,7 +2432,7 @@ public:
         /// ATTENTION: To register a parent and to register this new object to a parent are the responsibilities of the caller!
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         XhtmlInnerText()
-            : XhtmlElement(XhtmlElementType::Text), m_text()
+            : XhtmlElement(XhtmlElementType::Text), m_text(), m_textRevision(0), m_breakOpportunities()
         {   ;   }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -2323,7 +2443,7 @@ public:
         /// @param text    The text to apply
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         XhtmlInnerText(String text)
-            : XhtmlElement(XhtmlElementType::Text), m_text(L"")
+            : XhtmlElement(XhtmlElementType::Text), m_text(L""), m_textRevision(0), m_breakOpportunities()
         {   setText(text);   }
 
     public:
@@ -2341,7 +2461,12 @@ public:
         /// @param text  The new text to set
         /// @param decode  The flag, determining whether to encode the text, default is true
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        inline void setText(tgui::String text, bool decode = true) { m_text = (decode ? XhtmlElement::decode(text) : text); }
+        inline void setText(tgui::String text, bool decode = true)
+        {
+            m_text = (decode ? XhtmlElement::decode(text) : text);
+            m_textRevision = XhtmlAttribute::nextRevision();
+            findBreakOpportunities(m_text, m_breakOpportunities);
+        }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Gets the text of the element
@@ -2350,8 +2475,43 @@ public:
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         inline tgui::String getText() { return m_text; }
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Gets the revision of the text, that changes with every setText() call
+        ///
+        /// Revisions are unique within the process (see XhtmlAttribute::nextRevision()), so a layout cache can detect a changed
+        /// text as well as a replaced element.
+        ///
+        /// @return The revision of the text (0, if no text has been set)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        inline XhtmlAttribute::Revision getTextRevision() const
+        {   return m_textRevision;   }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Gets the break opportunities of the text, that have been determined when the text has been set
+        ///
+        /// @return The break opportunities of the text, in ascending order
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        inline const std::vector<XhtmlBreakOpportunity>& getBreakOpportunities() const
+        {   return m_breakOpportunities;   }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Determines the break opportunities of a text, following the rules of the Unicode line breaking algorithm (UAX #14)
+        ///
+        /// The rules are simplified to the character classes, that matter for the supported documents: Line breaks are mandatory
+        /// break opportunities. Spaces are break opportunities, unless they are followed by closing punctuation or preceded by
+        /// opening punctuation. No-break spaces glue their neighbours. Hyphens and dashes break after them, the hyphen-minus not
+        /// in front of a number and not at the beginning of a word. Ideographic characters (CJK, Hangul, ...) break in front of and
+        /// after them, unless a closing punctuation or non-starter follows or an opening punctuation precedes.
+        ///
+        /// @param text           The text to determine the break opportunities for
+        /// @param opportunities  The break opportunities of the text, in ascending order
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void findBreakOpportunities(const tgui::String& text, std::vector<XhtmlBreakOpportunity>& opportunities);
+
     private:
-        tgui::String m_text;
+        tgui::String                       m_text;               //!< The text
+        XhtmlAttribute::Revision           m_textRevision;       //!< The revision of the text
+        std::vector<XhtmlBreakOpportunity> m_breakOpportunities; //!< The break opportunities of the text
     };
 
 } }
@@ -29,11 +29,13 @@
 
 #include "TGUI/Xhtml/MarkupLanguageElement.hpp"
 #include "TGUI/Xhtml/MarkupListItemType.hpp"
+#include "TGUI/Xhtml/Dom/XhtmlMemoryResource.hpp"
 #include "TGUI/Xhtml/Dom/XhtmlAttributes.hpp"
 
 #include "TGUI/Xhtml/Dom/XhtmlElement.hpp"
 #include "TGUI/Xhtml/Dom/XhtmlContainerElement.hpp"
 #include "TGUI/Xhtml/Dom/XhtmlStyleableInterface.hpp"
+#include "TGUI/Xhtml/Dom/XhtmlStyleSheet.hpp"
 #include "TGUI/Xhtml/Dom/XhtmlStyle.hpp"
 #include "TGUI/Xhtml/Dom/XhtmlStyleableNoncontainerElement.hpp"
 #include "TGUI/Xhtml/Dom/XhtmlStyleableContainerElement.hpp"
@@ -38,55 +38,60 @@
 #ifndef TINY_XHTML_ENTRITY_RESOLVER
 #define TINY_XHTML_ENTRITY_RESOLVER
 
-#include <tuple>
-#include <vector>
+#include "TGUI/Xhtml/Dom/XhtmlDiagnostics.hpp"
 
 namespace tgui  { namespace xhtml
 {
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    /// @brief The enumeration of message types
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    enum class MessageType
-    {
-        ERROR,   //!< The message represents an error
-        WARNING  //!< The message represents an warning
-    };
-
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    /// @brief Provides an entity map, that maps encoded entity names to decoded entities
+    /// @brief Provides the resolution of encoded entity references (the full HTML5 set of named character references as well
+    ///        as decimal and hexadecimal numeric character references) to decoded entities
+    ///
+    /// The resolution works directly on the parser buffer, needs a bounded look-ahead of at most MaxEntityLength characters
+    /// and allocates no memory.
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     class XhtmlEntityResolver
     {
+    public:
+        static constexpr unsigned int MaxEntityLength = 33; //!< The maximum length of an entity reference, including '&' and ';'
+
     public:
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        /// @brief Find the first decoded entity, that is mapped to the indicated encoded entity name
+        /// @brief Resolves the longest encoded entity reference at the beginning of the indicated characters
+        ///
+        /// Named references are case sensitive. Within attribute values, the legacy named references without terminating
+        /// semicolon (like "&amp") are only resolved, if they are not followed by an alphanumeric character or '=' (HTML5).
         ///
-        /// @param messages       The collection of error/warning messages, created during the parser run
-        /// @param encode         The encoded entity name to be resolved
-        /// @param substitute     The encoded entity that is mapped to an encoded entity name
+        /// @param diagnostics       The receiver of the errors/warnings, created during the parser run
+        /// @param encode            The characters to be resolved, starting with '&' - need not be zero terminated
+        /// @param length            The number of characters available in encode (only MaxEntityLength are evaluated)
+        /// @param substitute        [OUT] The decoded entity
+        /// @param secondSubstitute  [OUT] The second decoded entity for the few named references, that decode to two
+        ///                          characters, or 0 otherwise
+        /// @param isAttribute       Determine whether encode is part of an attribute value (or of text content otherwise)
         ///
-        /// @return The number of processed character in encode on success, or 0 otherwise
+        /// @return The number of processed characters in encode on success, or 0 otherwise
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        static unsigned int resolveEntity(std::vector<std::tuple<tgui::xhtml::MessageType, String>>& messages, const char32_t* encode, char32_t& substitute);
+        static unsigned int resolveEntity(XhtmlDiagnostics& diagnostics, const char32_t* encode,
+                                          size_t length, char32_t& substitute, char32_t& secondSubstitute, bool isAttribute = false);
 
-    private:
-        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        /// @brief Interprets an unsigned long integer value in the indicated string
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Resolves the longest encoded entity reference at the beginning of the indicated UTF-8 bytes
         ///
-        /// @param value  The string to be interpreted
-        /// @param radix  The number base
+        /// Since entity references consist of ASCII characters only, one byte is one character.
         ///
-        /// @return The value converted to unsigned long integer
-        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        static unsigned long toULong(const char32_t* value, int radix = 10);
-
-    private:
-        static std::map<tgui::String, char32_t> m_charEntityRefs; /**< The map of encoded entity names to decoded entities */
+        /// @param diagnostics       The receiver of the errors/warnings, created during the parser run
+        /// @param encode            The bytes to be resolved, starting with '&' - need not be zero terminated
+        /// @param length            The number of bytes available in encode (only MaxEntityLength are evaluated)
+        /// @param substitute        [OUT] The decoded entity
+        /// @param secondSubstitute  [OUT] The second decoded entity for the few named references, that decode to two
+        ///                          characters, or 0 otherwise
+        /// @param isAttribute       Determine whether encode is part of an attribute value (or of text content otherwise)
+        ///
+        /// @return The number of processed bytes in encode on success, or 0 otherwise
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static unsigned int resolveEntity(XhtmlDiagnostics& diagnostics, const char* encode,
+                                          size_t length, char32_t& substitute, char32_t& secondSubstitute, bool isAttribute = false);
     };
 
 } }
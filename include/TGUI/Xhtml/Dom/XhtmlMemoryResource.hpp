@@ -0,0 +1,214 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// XHTML DOM memory resource (zlib license) provided for TGUI - Texus' Graphical User Interface
+// Copyright (C) 2023 Steffen Ploetz (Steffen.Ploetz@cityweb.de)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_XHTML_MEMORY_RESOURCE_HPP
+#define TGUI_XHTML_MEMORY_RESOURCE_HPP
+
+#include <memory>
+#include <memory_resource>
+#include <utility>
+
+namespace tgui  { namespace xhtml
+{
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Allocator, that allocates from a shared polymorphic memory resource
+    ///
+    /// In contrast to std::pmr::polymorphic_allocator, this allocator shares the ownership of the memory resource. Because
+    /// std::allocate_shared() keeps a copy of the allocator within the control block, every XHTML DOM object keeps its
+    /// memory resource alive - the memory resource (e. g. a per-document arena) is released after the last object is gone.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <class T>
+    class XhtmlAllocator
+    {
+    public:
+        using value_type = T; //!< The type of the objects to allocate
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief The initializing constructor
+        ///
+        /// @param resource  The memory resource to allocate from, must not be nullptr
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        explicit XhtmlAllocator(std::shared_ptr<std::pmr::memory_resource> resource) noexcept
+            : m_resource(std::move(resource))
+        { }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief The converting copy constructor (rebinding)
+        ///
+        /// @param other  The allocator to share the memory resource with
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <class U>
+        XhtmlAllocator(const XhtmlAllocator<U>& other) noexcept
+            : m_resource(other.getResource())
+        { }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Allocates uninitialized storage for the indicated number of objects
+        ///
+        /// @param count  The number of objects to allocate storage for
+        ///
+        /// @return The allocated storage
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        T* allocate(std::size_t count)
+        {   return static_cast<T*>(m_resource->allocate(count * sizeof(T), alignof(T)));   }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Deallocates storage, previously allocated by allocate()
+        ///
+        /// @param storage  The storage to deallocate
+        /// @param count    The number of objects, the storage has been allocated for
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void deallocate(T* storage, std::size_t count) noexcept
+        {   m_resource->deallocate(storage, count * sizeof(T), alignof(T));   }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Gets the shared memory resource
+        ///
+        /// @return The shared memory resource
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        inline const std::shared_ptr<std::pmr::memory_resource>& getResource() const noexcept
+        {   return m_resource;   }
+
+    private:
+        std::shared_ptr<std::pmr::memory_resource> m_resource; //!< The shared memory resource to allocate from
+    };
+
+    template <class T, class U>
+    inline bool operator==(const XhtmlAllocator<T>& lhs, const XhtmlAllocator<U>& rhs) noexcept
+    {   return lhs.getResource() == rhs.getResource() || *lhs.getResource() == *rhs.getResource();   }
+
+    template <class T, class U>
+    inline bool operator!=(const XhtmlAllocator<T>& lhs, const XhtmlAllocator<U>& rhs) noexcept
+    {   return !(lhs == rhs);   }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Provides the memory resource, the XHTML DOM objects are allocated from
+    ///
+    /// The memory resource is selected per thread via XhtmlMemoryScope. If no memory resource is selected, the XHTML DOM
+    /// objects are allocated from the heap (via std::make_shared()), as before.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API XhtmlMemoryResource
+    {
+    public:
+        using Ptr = std::shared_ptr<std::pmr::memory_resource>; //!< Shared memory resource pointer
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates a new monotonic arena, intended to hold all XHTML DOM objects of one document
+        ///
+        /// Deallocation is a no-op, the complete arena is released at once, after the last XHTML DOM object is gone.
+        /// The arena is not thread-safe, only one thread at a time may allocate from it.
+        ///
+        /// @param initialSize  The size of the first arena block in bytes (subsequent blocks grow geometrically)
+        ///
+        /// @return The new monotonic arena
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static Ptr createArena(size_t initialSize = 64 * 1024);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Wraps a memory resource, that is owned by the caller
+        ///
+        /// @param resource  The memory resource to wrap, must outlive all XHTML DOM objects allocated from it
+        ///
+        /// @return The wrapped (not owned) memory resource
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static Ptr wrap(std::pmr::memory_resource* resource);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Gets the memory resource, that is currently selected for the calling thread
+        ///
+        /// @return The currently selected memory resource or nullptr (allocate from the heap)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static const Ptr& getCurrent()
+        {   return current();   }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates a new shared object from the currently selected memory resource
+        ///
+        /// @param args  The arguments to forward to the constructor of the new object
+        ///
+        /// @return The new shared object
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <class T, class... Args>
+        static std::shared_ptr<T> makeShared(Args&&... args)
+        {
+            const Ptr& resource = current();
+            if (resource == nullptr)
+                return std::make_shared<T>(std::forward<Args>(args)...);
+            return std::allocate_shared<T>(XhtmlAllocator<T>(resource), std::forward<Args>(args)...);
+        }
+
+    private:
+        friend class XhtmlMemoryScope;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Gets the storage of the currently selected memory resource of the calling thread
+        ///
+        /// @return The storage of the currently selected memory resource
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static Ptr& current();
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Selects a memory resource for the XHTML DOM objects, created by the calling thread within the scope
+    ///
+    /// @example XhtmlMemoryScope scope(XhtmlMemoryResource::createArena());
+    ///          auto text = XhtmlElement::createInnerText(nullptr, U"Allocated from the arena.");
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API XhtmlMemoryScope
+    {
+    public:
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief The initializing constructor, selects the indicated memory resource
+        ///
+        /// @param resource  The memory resource to select, or nullptr to allocate from the heap
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        explicit XhtmlMemoryScope(XhtmlMemoryResource::Ptr resource)
+            : m_previous(XhtmlMemoryResource::current())
+        {   XhtmlMemoryResource::current() = std::move(resource);   }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief The destructor, restores the previously selected memory resource
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~XhtmlMemoryScope()
+        {   XhtmlMemoryResource::current() = std::move(m_previous);   }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Deleted copy constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        XhtmlMemoryScope(const XhtmlMemoryScope&) = delete;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Deleted assignment operator overload
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        XhtmlMemoryScope& operator=(const XhtmlMemoryScope&) = delete;
+
+    private:
+        XhtmlMemoryResource::Ptr m_previous; //!< The previously selected memory resource, to restore at the end of the scope
+    };
+
+} }
+
+#endif // TGUI_XHTML_MEMORY_RESOURCE_HPP
@@ -47,6 +47,7 @@
 #include <vector>
 #include <map>
 #include <algorithm>
+#include <functional>
 
 #include "TGUI/Xhtml/Dom/XhtmlElements.hpp"
 
@@ -60,31 +61,66 @@ namespace tgui  { namespace xhtml
     public:
         using MsgType = std::tuple<MessageType, tgui::String>; //!< The type of error/warning messages to use while parsing
 
-    private:
+        static constexpr size_t MaxTagLength = 64 * 1024; //!< The maximum tag length in bytes (UTF-8 modes), a longer tag is plain text
+
+    public:
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        /// @brief The default constructor
+        /// @brief The default constructor for incremental parsing
+        ///
+        /// The UTF-8 byte stream is fed chunk by chunk via feed() and the parsing is completed via finish(). The parser owns
+        /// the not yet processed bytes only, so parsing can overlap with I/O and the peak memory stays bounded.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         XhtmlParser()
-            : m_buffer(), m_bufferPos(0), m_messages(), m_rootElements()
-        {}
+            : m_buffer(), m_utf8Buffer(), m_tagBuffer(), m_isUtf8Buffer(true), m_bufferPos(0), m_diagnostics(), m_rootElements(),
+              m_feedBuffer(), m_feedOffset(0), m_isIncremental(true), m_isFinished(false), m_isDocumentStarted(false),
+              m_markupScan(), m_workStartPosition(0), m_workDataLen(0), m_characters(), m_isInsideScript(false), m_preformattedDepth(0),
+              m_parentElements(), m_onElementCompleted(), m_memoryResource(XhtmlMemoryResource::createArena()),
+              m_lineNumber(1), m_lineStartOffset(0), m_lineScanOffset(0)
+        {   parseDocument_resetState();   }
 
-    public:
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief The initializing constructor
         ///
         /// @param buffer  The buffer of the character stream to parse
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         XhtmlParser(const tgui::String& buffer)
-            : m_buffer(buffer), m_bufferPos(0), m_messages(), m_rootElements()
+            : m_buffer(std::make_shared<const tgui::String>(buffer)), m_utf8Buffer(), m_tagBuffer(), m_isUtf8Buffer(false), m_bufferPos(0), m_diagnostics(), m_rootElements(),
+              m_feedBuffer(), m_feedOffset(0), m_isIncremental(false), m_isFinished(false), m_isDocumentStarted(false),
+              m_markupScan(), m_workStartPosition(0), m_workDataLen(0), m_characters(), m_isInsideScript(false), m_preformattedDepth(0),
+              m_parentElements(), m_onElementCompleted(), m_memoryResource(XhtmlMemoryResource::createArena()),
+              m_lineNumber(1), m_lineStartOffset(0), m_lineScanOffset(0)
+        {}
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief The initializing constructor for UTF-8 encoded byte streams (zero-copy mode)
+        ///
+        /// The parser works directly on the UTF-8 bytes and decodes code points only for inner texts and tag markup (that
+        /// includes the attribute values), instead of converting the complete document to UTF-32 in advance. In this mode
+        /// all buffer positions (cursor, tag positions and the return value of parseDocument()) are byte positions.
+        ///
+        /// @param utf8Buffer  The buffer of the UTF-8 byte stream to parse, must outlive the parser (is not copied)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        XhtmlParser(tgui::CharStringView utf8Buffer)
+            : m_buffer(), m_utf8Buffer(utf8Buffer), m_tagBuffer(), m_isUtf8Buffer(true), m_bufferPos(0), m_diagnostics(), m_rootElements(),
+              m_feedBuffer(), m_feedOffset(0), m_isIncremental(false), m_isFinished(false), m_isDocumentStarted(false),
+              m_markupScan(), m_workStartPosition(0), m_workDataLen(0), m_characters(), m_isInsideScript(false), m_preformattedDepth(0),
+              m_parentElements(), m_onElementCompleted(), m_memoryResource(XhtmlMemoryResource::createArena()),
+              m_lineNumber(1), m_lineStartOffset(0), m_lineScanOffset(0)
         {}
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Acquires the next character from the buffer and update the cursor
         ///
+        /// In UTF-8 mode this is the next byte, which is sufficient to recognize all markup delimiters (they are ASCII).
+        ///
         /// @return The next character from the buffer
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         char32_t acquireChar()
-        { return m_buffer[m_bufferPos++]; }
+        {
+            const char32_t c = peekChar(m_bufferPos);
+            m_bufferPos++;
+            return c;
+        }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Rejects the last acquired character from the buffer and update the cursor
@@ -92,7 +128,37 @@ namespace tgui  { namespace xhtml
         /// @return The rejected character from the buffer
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         char32_t rejectChar()
-        { return m_buffer[--m_bufferPos]; }
+        { return peekChar(--m_bufferPos); }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Gets the character at the indicated buffer position without updating the cursor
+        ///
+        /// @param position  The buffer position to get the character for
+        ///
+        /// @return The character at the indicated buffer position, or 0 if the position is behind the end of the buffer
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        inline char32_t peekChar(size_t position) const
+        {
+            if (m_isUtf8Buffer)
+                return (position < m_utf8Buffer.size() ? static_cast<char32_t>(static_cast<unsigned char>(m_utf8Buffer[position])) : 0);
+            return (position < m_buffer->size() ? (*m_buffer)[position] : 0);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Gets the size of the buffer to parse (code points in UTF-32 mode or bytes in UTF-8 mode)
+        ///
+        /// @return The size of the buffer to parse
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        inline size_t getBufferSize() const
+        {   return (m_isUtf8Buffer ? m_utf8Buffer.size() : m_buffer->size());   }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Determines whether the parser works on an UTF-8 byte stream (zero-copy mode)
+        ///
+        /// @return The flag whether the parser works on an UTF-8 byte stream
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        inline bool isUtf8Buffer() const
+        {   return m_isUtf8Buffer;   }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Parses a comment tag
@@ -112,23 +178,103 @@ namespace tgui  { namespace xhtml
         size_t parseDocument(bool resolveEntities = true, bool traceResult = false);
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        /// @brief Cleans breaks ('\r' '\n') and spaces ('\t', '\v', ' ') from characters string
+        /// @brief Feeds the next chunk of the UTF-8 byte stream and parses as far as possible (incremental mode)
+        ///
+        /// Tags, comments and entities, that are split across chunk boundaries, are postponed until the next chunk arrives.
+        /// The search for the end of postponed markup continues with the next chunk. A '<', that is not followed by a type name,
+        /// '/' or '!', is plain text and a tag, that isn't delimited within MaxTagLength bytes, is plain text too.
+        /// The open element stack, the pending inner text and the script/preformatted state are kept across the calls.
+        ///
+        /// @param chunk            The next chunk of the UTF-8 byte stream to parse, is copied (must not outlive the call)
+        /// @param resolveEntities  Determine whether to resolve entities
+        ///
+        /// @return The number of parsed bytes (since the first chunk)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        size_t feed(tgui::CharStringView chunk, bool resolveEntities = true);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Parses the remaining bytes of the UTF-8 byte stream and completes the XHTML document (incremental mode)
+        ///
+        /// @param resolveEntities  Determine whether to resolve entities
+        /// @param traceResult      Determine whether to trace the result (element tree) to std::cout.
+        ///
+        /// @return The number of parsed bytes (since the first chunk)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        size_t finish(bool resolveEntities = true, bool traceResult = false);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sets the handler, that is called for every completed XHTML element
         ///
-        /// @param parentElement  The parent XHTML element to determine cleaning details
-        ///                       - partial cleaning, if string isn't an inner text (breaks and repeated spaces)
-        ///                       - complete cleaning otherwise (breaks and all spaces)
-        /// @param characters     The cuurently parsed string to clean
+        /// An XHTML element is completed, if its end tag has been parsed, if it is closed by definition (like '<br>') or if the
+        /// document ends. At this time the XHTML element and all of its children are fully parsed and registered to the parent.
+        ///
+        /// @param handler  The handler to call for every completed XHTML element, or nullptr to call none
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        static void parseDocument_cleanBreaksAndSpaces(const XhtmlElement::Ptr parentElement, tgui::String& characters);
+        inline void setOnElementCompleted(std::function<void(XhtmlElement::Ptr element)> handler)
+        {   m_onElementCompleted = handler;   }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        /// @brief Processes breaks ('<br>') and spaces (' ') from characters string, depending on the preformattedDepth
+        /// @brief Sets the memory resource, the parsed XHTML DOM objects are allocated from
+        ///
+        /// By default every parser creates its own monotonic arena (see XhtmlMemoryResource::createArena()), so the complete
+        /// XHTML DOM of a document is released at once, after the last XHTML DOM object is gone. The memory resource must
+        /// not be changed while parsing.
         ///
-        /// @param parentElement      The parent XHTML element to add new XHTML child elements to
-        /// @param characters         The cuurently parsed string to process regarding breaks and spaces
+        /// @param resource  The memory resource to allocate from, or nullptr to allocate from the heap
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        inline void setMemoryResource(XhtmlMemoryResource::Ptr resource)
+        {   m_memoryResource = resource;   }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Gets the memory resource, the parsed XHTML DOM objects are allocated from
+        ///
+        /// @return The memory resource to allocate from, or nullptr if allocated from the heap
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        inline XhtmlMemoryResource::Ptr getMemoryResource() const
+        {   return m_memoryResource;   }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sets the effort, that is spent on errors/warnings while parsing
+        ///
+        /// XhtmlDiagnosticsMode::Collect (the default) collects every diagnostic with code, location and arguments,
+        /// XhtmlDiagnosticsMode::CountOnly only counts the errors and warnings and XhtmlDiagnosticsMode::None ignores them
+        /// completely - neither message texts nor line/column locations are computed then. The mode must not be changed
+        /// while parsing.
+        ///
+        /// @param mode  The diagnostics mode
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        inline void setDiagnosticsMode(XhtmlDiagnosticsMode mode)
+        {   m_diagnostics.setMode(mode);   }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Gets the effort, that is spent on errors/warnings while parsing
+        ///
+        /// @return The diagnostics mode
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        inline XhtmlDiagnosticsMode getDiagnosticsMode() const
+        {   return m_diagnostics.getMode();   }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Cleans breaks ('\r' '\n') and spaces ('\t', '\v', ' ', no-break space) from characters string in one pass
+        ///
+        /// Outside of '<pre>' tags every run of breaks and spaces is collapsed to one space, a no-break space becomes a space
+        /// and a leading space is removed at the beginning of a block. Inside of '<pre>' tags only "\r\n" is reduced to "\n".
+        /// The characters string is compacted in place, no temporary string is created.
+        ///
+        /// @param parentElement      The parent XHTML element to determine whether a leading space is to remove
+        /// @param characters         The cuurently parsed string to clean
         /// @param preformattedDepth  The number of not closed '<pre>' tags (inside a '<pre>' tag the spaces should not be suppressed)
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void parseDocument_createInnerText(XhtmlElement::Ptr parentElement, tgui::String& characters, int preformattedDepth);
+        static void parseDocument_cleanBreaksAndSpaces(const XhtmlElement::Ptr parentElement, tgui::String& characters, int preformattedDepth);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates the inner text XHTML elements from a cleaned characters string - every remaining line break (inside of
+        /// '<pre>' tags) creates a break ('<br>') XHTML element
+        ///
+        /// @param parentElement  The parent XHTML element to add new XHTML child elements to
+        /// @param characters     The cleaned characters string to create inner text XHTML elements from
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void parseDocument_createInnerText(XhtmlElement::Ptr parentElement, const tgui::String& characters);
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Checks the parity of XHTML start tag and XHTML end tag
@@ -152,6 +298,216 @@ namespace tgui  { namespace xhtml
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         XhtmlElement::Ptr parseElement(XhtmlElement::Ptr parent, bool& isOpeningTag, bool& isClosingTag, bool& isInsideScript);
 
+    private:
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief The state of the search for the end of a markup (comment or tag), that is kept across feed() calls
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct MarkupScan
+        {
+            size_t   Start = tgui::String::npos; //!< The buffer position of the markup's '<', or tgui::String::npos if none
+            size_t   Position = 0;               //!< The buffer position to continue the search at
+            size_t   End = tgui::String::npos;   //!< The buffer position behind the markup's end, or tgui::String::npos if not found
+            char32_t Quote = 0;                  //!< The quote of the attribute value the search is inside, or 0 if none
+            bool     AfterEqualSign = false;     //!< Determine whether the search is behind an '=' (attribute value expected)
+            bool     AfterCommentEnd = false;    //!< Determine whether the search of a comment is behind its "--"
+            bool     IsTooLong = false;          //!< Determine whether the tag isn't delimited within MaxTagLength bytes
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Resets the parsing state (open element stack, pending inner text, script/preformatted state)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void parseDocument_resetState();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Skips the byte order mark and the leading whitespaces of the document, if not already done
+        ///
+        /// @param isFinal  Determine whether the buffer contains the complete (remaining) document
+        ///
+        /// @return The flag whether the document start has been processed (false, if more bytes are required)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool parseDocument_skipDocumentStart(bool isFinal);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Determines whether the markup (comment or tag), that starts at the indicated buffer position, is complete
+        ///
+        /// The search continues where the previous call stopped, if the markup still starts at the same position.
+        ///
+        /// @param position  The buffer position of the markup's '<'
+        ///
+        /// @return The flag whether the buffer contains the complete markup (or the tag is too long to wait for its end)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool parseDocument_isMarkupComplete(size_t position);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Determines whether the '<' at the indicated buffer position starts markup, that is relevant inside a script
+        ///
+        /// Inside a script only comments ('<!--') and the script end tag ('</script') are markup.
+        ///
+        /// @param position  The buffer position of the '<'
+        ///
+        /// @return The flag whether the '<' starts a comment or the script end tag
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool parseDocument_isScriptMarkup(size_t position) const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Parses the buffer from the cursor position on, as far as possible
+        ///
+        /// @param resolveEntities  Determine whether to resolve entities
+        /// @param isFinal          Determine whether the buffer contains the complete (remaining) document, otherwise the parsing
+        ///                         is suspended at markup or entities, that might be incomplete
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void parseDocument_parseBuffer(bool resolveEntities, bool isFinal);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Completes the parsing (quality checks, completion of open elements and optional trace)
+        ///
+        /// @param traceResult  Determine whether to trace the result (element tree) to std::cout.
+        ///
+        /// @return The number of parsed characters
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        size_t parseDocument_finish(bool traceResult);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Appends a range of the buffer to the indicated string (decodes the range in UTF-8 mode)
+        ///
+        /// @param target    The string to append the buffer range to
+        /// @param position  The first buffer position of the range
+        /// @param length    The length of the range
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void appendBufferRange(tgui::String& target, size_t position, size_t length) const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Finds the first occurrence of the indicated ASCII pattern within the buffer
+        ///
+        /// @param pattern        The ASCII pattern to find
+        /// @param startPosition  The buffer position to start the search at
+        ///
+        /// @return The buffer position of the first occurrence on success, or tgui::String::npos otherwise
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        size_t findInBuffer(const char* pattern, size_t startPosition) const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Finds the end of the tag, that starts at the indicated buffer position ('>' inside quoted values don't count)
+        ///
+        /// The search is limited to MaxTagLength bytes and continues where the previous call stopped, if the tag still starts at
+        /// the same position. The result is kept in m_markupScan.
+        ///
+        /// @param position  The buffer position of the tag's '<'
+        ///
+        /// @return The buffer position behind the tag's '>' on success, or tgui::String::npos otherwise
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        size_t findTagEnd(size_t position);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Finds the next character, that requires evaluation by the parser ('<', '&' or 0)
+        ///
+        /// @param position  The buffer position to start the search at
+        ///
+        /// @return The buffer position of the next delimiter on success, or the buffer size otherwise
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        size_t findNextDelimiter(size_t position) const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Finds the next '<', '&' or 0 within a byte stream (vectorized with SSE2/AVX2, if available)
+        ///
+        /// @param data      The byte stream to search
+        /// @param position  The position to start the search at
+        /// @param size      The size of the byte stream
+        ///
+        /// @return The position of the next delimiter on success, or the size otherwise
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static size_t findNextDelimiter(const char* data, size_t position, size_t size);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Finds the next '<', '&' or 0 within an UTF-32 character stream (vectorized with SSE2/AVX2, if available)
+        ///
+        /// @param data      The UTF-32 character stream to search
+        /// @param position  The position to start the search at
+        /// @param size      The size of the UTF-32 character stream
+        ///
+        /// @return The position of the next delimiter on success, or the size otherwise
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static size_t findNextDelimiter(const char32_t* data, size_t position, size_t size);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Finds the next character, that might need whitespace normalization (any control character, ' ' or no-break
+        /// space) within an UTF-32 character stream (vectorized with SSE2, if available)
+        ///
+        /// @param data      The UTF-32 character stream to search
+        /// @param position  The position to start the search at
+        /// @param size      The size of the UTF-32 character stream
+        ///
+        /// @return The position of the next candidate on success, or the size otherwise
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static size_t findNextSpaceCandidate(const char32_t* data, size_t position, size_t size);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Skips a run of collapsible spaces (' ', '\t', '\v', '\n' and "\r\n") within an UTF-32 character stream
+        /// (vectorized with SSE2, if available)
+        ///
+        /// @param data      The UTF-32 character stream to search
+        /// @param position  The position to start the search at
+        /// @param size      The size of the UTF-32 character stream
+        ///
+        /// @return The position behind the run, or the start position if there is no collapsible space
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static size_t skipCollapsibleSpaces(const char32_t* data, size_t position, size_t size);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Counts the trailing zero bits of a comparison mask
+        ///
+        /// @param mask  The comparison mask to evaluate, must not be 0
+        ///
+        /// @return The number of trailing zero bits (the index of the first set bit)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static unsigned int countTrailingZeros(unsigned int mask);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Resolves the entity, that starts at the current cursor position
+        ///
+        /// @param substitute        [OUT] The decoded entity
+        /// @param secondSubstitute  [OUT] The second decoded entity, if the entity decodes to two characters, or 0 otherwise
+        ///
+        /// @return The number of processed buffer positions on success, or 0 otherwise
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int resolveEntityAtCursor(char32_t& substitute, char32_t& secondSubstitute);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sets the location, the subsequently reported diagnostics refer to - only if the diagnostics are collected
+        ///
+        /// @param position  The buffer position of the markup construct to parse next
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        inline void locateDiagnostics(size_t position)
+        {
+            if (m_diagnostics.isCollecting())
+                locateDiagnosticsAt(position);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Calculates the line and column of the indicated buffer position and sets it as location of the diagnostics
+        ///
+        /// The line breaks are counted incrementally, so every buffer position is scanned at most once per parser run.
+        ///
+        /// @param position  The buffer position of the markup construct to parse next
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void locateDiagnosticsAt(size_t position);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates an XHTML element from the UTF-8 byte stream at the current cursor position (on success)
+        ///
+        /// Only the markup of the tag is decoded, the remaining byte stream stays untouched.
+        ///
+        /// @param parent          The parent element to register the parsed element to
+        /// @param isOpeningTag    Determine whether element is inside opening tag
+        /// @param isClosingTag    Determine whether element is inside closing tag
+        /// @param isInsideScript  Determine whether element is is between '<script ...>' and '</script>'
+        ///
+        /// @return The XHTML element on success, or nullptr otherwise
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        XhtmlElement::Ptr parseElementUtf8(XhtmlElement::Ptr parent, bool& isOpeningTag, bool& isClosingTag, bool& isInsideScript);
+
+    public:
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Gets the collection of root elements. Can be empty
         ///
@@ -160,13 +516,23 @@ namespace tgui  { namespace xhtml
         inline std::vector<XhtmlElement::Ptr> getRootElements() const
         {   return m_rootElements;   }
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Gets the diagnostics (counts and, if collected, the errors/warnings with code and location) of the parser run
+        ///
+        /// @return The diagnostics of the parser run
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        inline const XhtmlDiagnostics& getDiagnostics() const
+        {   return m_diagnostics;   }
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Gets the complete collection of parser (error/warning) messages. Can be empty (if parser could recognize 100%)
         ///
+        /// The message texts are formatted from the collected diagnostics on every call.
+        ///
         /// @return The complete collection of parser (error/warning) messages. Can be empty
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         inline std::vector<std::tuple<MessageType, tgui::String>> getMessages() const
-        {   return m_messages;   }
+        {   return m_diagnostics.toMessages();   }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Gets the collection of parser error messages. Can be empty (if o parser errors occurred)
@@ -183,10 +549,31 @@ namespace tgui  { namespace xhtml
         std::shared_ptr<std::vector<tgui::String>> getWarningMessages() const;
 
     private:
-        tgui::String                   m_buffer;       //!< The UTF character stream to parse
+        XhtmlAttribute::SourcePtr      m_buffer;       //!< The UTF character stream to parse
+        tgui::CharStringView           m_utf8Buffer;   //!< The UTF-8 byte stream to parse (zero-copy mode), not owned
+        std::shared_ptr<tgui::String>  m_tagBuffer;    //!< The decoded markup of the actual tag (zero-copy mode), reused from tag to tag
+        bool                           m_isUtf8Buffer; //!< Determine whether the UTF-8 byte stream is parsed instead of the UTF character stream
         size_t                         m_bufferPos;    //!< The actual cursor position within the UTF character stream to parse
-        std::vector<MsgType>           m_messages;     //!< The error/warning messages that occurred when parsing the UTF character stream
+        XhtmlDiagnostics               m_diagnostics;  //!< The errors/warnings that occurred when parsing the UTF character stream
         std::vector<XhtmlElement::Ptr> m_rootElements; //!< The collection of root elements, parsed from the UTF character stream
+
+        std::string                    m_feedBuffer;        //!< The not yet processed bytes of the fed UTF-8 byte stream (incremental mode)
+        size_t                         m_feedOffset;        //!< The number of already processed and discarded bytes of the fed UTF-8 byte stream
+        bool                           m_isIncremental;     //!< Determine whether the UTF-8 byte stream is fed chunk by chunk
+        bool                           m_isFinished;        //!< Determine whether the incremental parsing has been finished
+        bool                           m_isDocumentStarted; //!< Determine whether the byte order mark and leading whitespaces are processed
+        MarkupScan                     m_markupScan;        //!< The state of the search for the end of the pending markup
+        size_t                         m_workStartPosition; //!< The start position of the pending character data
+        size_t                         m_workDataLen;       //!< The length of the pending character data
+        tgui::String                   m_characters;        //!< The last collection of unassociated (already decoded) characters
+        bool                           m_isInsideScript;    //!< Determine whether the cursor is between '<script ...>' and '</script>' tags
+        int                            m_preformattedDepth; //!< The number of currently open '<pre ...>' tags
+        std::vector<XhtmlElement::Ptr> m_parentElements;    //!< The stack of open elements (the bottom is always nullptr)
+        std::function<void(XhtmlElement::Ptr element)> m_onElementCompleted; //!< The handler to call for every completed element
+        XhtmlMemoryResource::Ptr       m_memoryResource;    //!< The memory resource to allocate the XHTML DOM objects from
+        size_t                         m_lineNumber;        //!< The 1-based line of the diagnostics location
+        size_t                         m_lineStartOffset;   //!< The offset of the first character of the line of the diagnostics location
+        size_t                         m_lineScanOffset;    //!< The offset up to which the line breaks have been counted
     };
 
 } }
@@ -45,7 +45,7 @@ namespace tgui  { namespace xhtml
         /// ATTENTION: To register a parent and to register this new object to a parent are the responsibilities of the caller!
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         XhtmlStyle()
-            : XhtmlElement(XhtmlElementType::Style), m_entries()
+            : XhtmlElement(XhtmlElementType::Style), m_entries(), m_styleSheet()
         { ; }
 
     public:
@@ -53,13 +53,15 @@ namespace tgui  { namespace xhtml
         /// @brief The virtual default destructor
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual ~XhtmlStyle()
-        {   m_entries.clear();   }
+        {   m_entries.clear(); m_styleSheet.clear();   }
 
 
     public:
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Sets a new or re-assigns an existing style entry
         ///
+        /// Named style entries are not matched against the elements, use addRule() for a style rule.
+        ///
         /// @param styleName      The name of the style entry
         /// @param styleEntry     The style entry to register
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -69,12 +71,20 @@ namespace tgui  { namespace xhtml
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Gets an style entry
         ///
+        /// If there is no style entry with this name, the style entry of the last rule with exactly this selector text is
+        /// returned - so the rules created from parsed data are still accessible by their selector text.
+        ///
         /// @param styleName      The name of the style entry
         ///
         /// @return The requested style entry on success, or nullptr otherwise
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         inline XhtmlStyleEntry::Ptr getEntry(const tgui::String& styleName)
-        {   return (styleName.size() != 0 && m_entries.find(styleName) != m_entries.end() ? m_entries[styleName] : nullptr);   }
+        {
+            if (styleName.size() == 0)
+                return nullptr;
+            auto entry = m_entries.find(styleName);
+            return (entry != m_entries.end() ? entry->second : m_styleSheet.findEntry(styleName));
+        }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Gets the style entry
@@ -86,16 +96,66 @@ namespace tgui  { namespace xhtml
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         XhtmlStyleEntry::Ptr getEntry(const char* typeName, const tgui::String& className);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Appends a style rule - a later rule with the same specificity overrides an earlier one
+        ///
+        /// @param selectorText   The text of one compound selector, e.g. "p", ".note" or "pre.highlight"
+        /// @param styleEntry     The style entry to apply to the matching elements
+        ///
+        /// @return The flag indicating whether the rule has been added (the selector is supported and the entry is not nullptr)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        inline bool addRule(const tgui::String& selectorText, XhtmlStyleEntry::Ptr styleEntry)
+        {   return (styleEntry != nullptr && m_styleSheet.addRule(selectorText, styleEntry));   }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Finds the style entry of the last style rule with exactly the indicated selector text
+        ///
+        /// @param selectorText   The selector text, exactly as added or parsed
+        ///
+        /// @return The requested style entry on success, or nullptr otherwise
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        inline XhtmlStyleEntry::Ptr findRule(const tgui::String& selectorText) const
+        {   return m_styleSheet.findEntry(selectorText);   }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Gets the style entries of all rules, that match an element, in cascade order (the last one wins)
+        ///
+        /// The result is cached by the element and matched again only after the element's 'id'/'class' or the rules changed.
+        ///
+        /// @param element     The element to get the matching style entries for
+        ///
+        /// @return The matching style entries
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        inline const std::vector<XhtmlStyleEntry::Ptr>& getMatchingEntries(const XhtmlElement& element) const
+        {   return m_styleSheet.match(element);   }
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Creates XHTML style entries from parsed data
         ///
-        /// @param messages         The collection of generated error/warning messages
-        /// @param buffer           The string that has to be parsed for style entries
+        /// @param diagnostics      The receiver of the generated errors/warnings
+        /// @param buffer           The style sheet text, that has to be compiled into style rules
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void createEntriesFromParseData(XhtmlDiagnostics& diagnostics, const tgui::String& buffer);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Appends the rules of a shared style sheet, e.g. one compiled once for several documents
+        ///
+        /// @param styleSheet       The style sheet to merge
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        inline void merge(const XhtmlStyleSheet& styleSheet)
+        {   m_styleSheet.merge(styleSheet);   }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Gets the compiled style sheet
+        ///
+        /// @return The compiled style sheet
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void createEntriesFromParseData(std::vector<std::tuple<MessageType, String>>& messages, const tgui::String& buffer);
+        inline const XhtmlStyleSheet& getStyleSheet() const
+        {   return m_styleSheet;   }
 
     private:
         std::map<tgui::String, XhtmlStyleEntry::Ptr> m_entries;                   //!< The collection of registered styles
+        XhtmlStyleSheet                              m_styleSheet;                //!< The compiled style rules
     };
 
 } }
@@ -0,0 +1,264 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// XHTML style sheet (zlib license) provided for TGUI - Texus' Graphical User Interface
+// Copyright (C) 2023 Steffen Ploetz (Steffen.Ploetz@cityweb.de)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_XHTML_STYLE_SHEET_HPP
+#define TGUI_XHTML_STYLE_SHEET_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <vector>
+
+#include <TGUI/String.hpp>
+
+#include "TGUI/Xhtml/Dom/XhtmlDiagnostics.hpp"
+#include "TGUI/Xhtml/Dom/XhtmlAttributes.hpp"
+
+namespace tgui  { namespace xhtml
+{
+    class XhtmlElement;
+
+    using XhtmlClassId = std::uint32_t; //!< The interned ID of a class name
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief The process-wide table of interned class names
+    ///
+    /// Class names are compared as small integers instead of strings. The table only grows, since the number of distinct
+    /// class names used by the documents of an application is small. All methods are thread-safe.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API XhtmlClassNames
+    {
+    public:
+        static constexpr XhtmlClassId NoClassId = 0;  //!< The class ID, that is never assigned to a class name
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Gets the class ID of a class name and registers the class name, if it is not yet known
+        ///
+        /// @param className  The class name (case-sensitive)
+        ///
+        /// @return The class ID of the class name
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static XhtmlClassId intern(const tgui::String& className);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Splits a white space separated list of class names (the value of a 'class' attribute) into class IDs
+        ///
+        /// @param classNames  The list of class names
+        /// @param classIds    [OUT] The sorted class IDs without duplicates
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void tokenize(const tgui::String& classNames, std::vector<XhtmlClassId>& classIds);
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief The cached result of matching the style sheet rules against one element, see XhtmlStyleSheet::match()
+    ///
+    /// The result stays valid as long as the style sheet revision and the revisions of the element's 'id' and 'class'
+    /// attributes are unchanged - relayouts for a new size or zoom factor reuse it without matching selectors again.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct TGUI_API XhtmlMatchedStyle
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief The default constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        XhtmlMatchedStyle()
+            : StyleSheetRevision(0), IdRevision(0), ClassRevision(0), ClassIds(), Entries(), IsValid(false)
+        { }
+
+        XhtmlAttribute::Revision          StyleSheetRevision; //!< The revision of the style sheet, the entries are matched for
+        XhtmlAttribute::Revision          IdRevision;         //!< The revision of the 'id' attribute (0 for none)
+        XhtmlAttribute::Revision          ClassRevision;      //!< The revision of the 'class' attribute (0 for none)
+        std::vector<XhtmlClassId>         ClassIds;           //!< The tokenized 'class' attribute
+        std::vector<XhtmlStyleEntry::Ptr> Entries;            //!< The matching style entries in cascade order
+        bool                              IsValid;            //!< The flag whether the entries have been matched at all
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief The compound selector of a style rule, e.g. "p", ".note", "#title", "pre.highlight.wide" or "*"
+    ///
+    /// Combinators (descendant ' ', child '>', siblings '+' and '~'), attribute selectors and pseudo-classes are not supported.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct TGUI_API XhtmlStyleSelector
+    {
+        tgui::String              TypeName;    //!< The (lower case) element type name, or empty for any element type
+        tgui::String              Id;          //!< The element ID, or empty for any element ID
+        std::vector<tgui::String> ClassNames;  //!< The class names, that all must be assigned to the element
+        std::vector<XhtmlClassId> ClassIds;    //!< The sorted interned IDs of the class names
+        unsigned int              TagKey;      //!< The tag ID of the type name, AnyTagKey or UnknownTagKey
+        std::uint32_t             Specificity; //!< The CSS specificity, encoded as (IDs << 16) | (classes << 8) | types
+
+        static constexpr unsigned int AnyTagKey = 0x100;     //!< The tag key of selectors without type name (beyond any tag ID)
+        static constexpr unsigned int UnknownTagKey = 0x101; //!< The tag key of type names, that are no known element type
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Tries to parse a compound selector
+        ///
+        /// @param selectorText  The trimmed text of one selector (without comments and without the ',' of a selector list)
+        /// @param selector      [OUT] The selector on success
+        ///
+        /// @return The flag indicating whether the selector is a supported compound selector (true) or not (false)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool tryParse(const tgui::String& selectorText, XhtmlStyleSelector& selector);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Determines whether the selector matches an element
+        ///
+        /// @param tagId     The tag ID of the element
+        /// @param id        The element ID. Can be empty
+        /// @param classIds  The sorted class IDs of the element. Can be empty
+        ///
+        /// @return The flag indicating whether the selector matches the element
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool matches(unsigned int tagId, const tgui::String& id, const std::vector<XhtmlClassId>& classIds) const;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief One rule of a style sheet - the selectors of a selector list become individual rules sharing the style entry
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct TGUI_API XhtmlStyleRule
+    {
+        XhtmlStyleSelector   Selector;      //!< The compiled selector
+        tgui::String         SelectorText;  //!< The selector as written (trimmed), to look up a rule by name
+        XhtmlStyleEntry::Ptr Entry;         //!< The declarations of the rule
+        size_t               SourceOrder;   //!< The position of the rule within all rules ever added to the style sheet
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief A style sheet, that is compiled once into a rule set indexed by ID, class name and type name
+    ///
+    /// The style sheet text is tokenized with comments, strings and nested blocks taken into account. Every selector of a
+    /// selector list becomes a rule of its own, duplicate selectors are kept as separate rules and unsupported selectors and
+    /// at-rules are skipped with a warning. Rules are found via the index of their most selective component (the ID, else the
+    /// pair of tag ID and one of the class IDs) and returned in cascade order - ascending specificity, then source order - so
+    /// that applying them in sequence lets the later rule win.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API XhtmlStyleSheet
+    {
+    public:
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief The default constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        XhtmlStyleSheet()
+            : m_rules(), m_idIndex(), m_ruleIndex(), m_nextSourceOrder(0), m_revision(0)
+        { }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Compiles the style sheet text and appends its rules (after all rules added so far)
+        ///
+        /// @param diagnostics  The receiver of the generated errors/warnings
+        /// @param source       The style sheet text, e.g. the inner text of a 'style' element
+        ///
+        /// @return The number of rules added
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        size_t compile(XhtmlDiagnostics& diagnostics, const tgui::String& source);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Appends a rule with an already created style entry
+        ///
+        /// @param selectorText  The text of one compound selector
+        /// @param styleEntry    The style entry of the rule
+        ///
+        /// @return The flag indicating whether the rule has been added (the selector is supported and the entry is not nullptr)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool addRule(const tgui::String& selectorText, XhtmlStyleEntry::Ptr styleEntry);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Appends the rules of another style sheet (after all rules added so far, keeping their relative order)
+        ///
+        /// @param styleSheet  The style sheet to merge into this one
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void merge(const XhtmlStyleSheet& styleSheet);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes all rules
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void clear();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Gets the rules in source order
+        ///
+        /// @return The rules in source order
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        inline const std::vector<XhtmlStyleRule>& getRules() const
+        {   return m_rules;   }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Gets the revision of the rule set, that changes with every added rule and with clear()
+        ///
+        /// @return The revision of the rule set, unique within the process (0 for a style sheet, that has never been changed)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        inline XhtmlAttribute::Revision getRevision() const
+        {   return m_revision;   }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Finds the style entry of the last rule with exactly the indicated selector text
+        ///
+        /// @param selectorText  The selector text to look for
+        ///
+        /// @return The style entry on success, or nullptr otherwise
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        XhtmlStyleEntry::Ptr findEntry(const tgui::String& selectorText) const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Gets the style entries of all rules, that match an element, in cascade order
+        ///
+        /// @param tagId        The tag ID of the element
+        /// @param id           The element ID. Can be empty
+        /// @param classIds     The sorted class IDs of the element, see XhtmlClassNames::tokenize(). Can be empty
+        /// @param styleEntries [OUT] The style entries in ascending specificity and source order
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void match(unsigned int tagId, const tgui::String& id, const std::vector<XhtmlClassId>& classIds,
+                   std::vector<XhtmlStyleEntry::Ptr>& styleEntries) const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Gets the style entries of all rules, that match an element, in cascade order - using the element's cache
+        ///
+        /// Selectors are matched again only if this style sheet or the element's 'id' or 'class' attribute has changed since
+        /// the last call. The cache of the element is updated, so the same element must not be matched concurrently.
+        ///
+        /// @param element  The element to match
+        ///
+        /// @return The style entries in ascending specificity and source order (valid until the next call for the element)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::vector<XhtmlStyleEntry::Ptr>& match(const XhtmlElement& element) const;
+
+    private:
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Appends a rule and registers it to the index of its most selective component
+        ///
+        /// @param rule  The rule to append, the source order is assigned here
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void appendRule(XhtmlStyleRule rule);
+
+    private:
+        std::vector<XhtmlStyleRule>                    m_rules;           //!< The rules in source order
+        std::map<tgui::String, std::vector<size_t>>    m_idIndex;         //!< The indices of the rules by ID
+        std::map<std::uint64_t, std::vector<size_t>>   m_ruleIndex;       //!< The indices of the rules without ID by (tag key, class ID)
+        size_t                                         m_nextSourceOrder; //!< The source order of the next rule to add
+        XhtmlAttribute::Revision                       m_revision;        //!< The revision of the rule set
+    };
+
+} }
+
+#endif // TGUI_XHTML_STYLE_SHEET_HPP
@@ -41,7 +41,7 @@ namespace tgui  { namespace xhtml
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         XhtmlStyleableContainerElement()
             : XhtmlContainerElement()
-        {   m_children = std::make_shared<std::vector<XhtmlElement::Ptr>>();   }
+        {   m_children = XhtmlMemoryResource::makeShared<std::vector<XhtmlElement::Ptr>>();   }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief The initializing constructor
@@ -52,7 +52,7 @@ namespace tgui  { namespace xhtml
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         XhtmlStyleableContainerElement(const char* typeName)
             : XhtmlContainerElement(typeName)
-        {   m_children = std::make_shared<std::vector<XhtmlElement::Ptr>>();   }
+        {   m_children = XhtmlMemoryResource::makeShared<std::vector<XhtmlElement::Ptr>>();   }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief The initializing constructor
@@ -64,14 +64,14 @@ namespace tgui  { namespace xhtml
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         XhtmlStyleableContainerElement(const char* typeName, XhtmlStyleEntry::Ptr styleEntry)
             : XhtmlContainerElement(typeName)
-        {   m_children = std::make_shared<std::vector<XhtmlElement::Ptr>>();   addAttribute(styleEntry);   }
+        {   m_children = XhtmlMemoryResource::makeShared<std::vector<XhtmlElement::Ptr>>();   addAttribute(styleEntry);   }
 
     public:
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief The virtual default destructor
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual ~XhtmlStyleableContainerElement()
-        {   m_children->clear();   }
+        {   releaseChildren();   }
 
 
     public:
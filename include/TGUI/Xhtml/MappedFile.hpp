@@ -0,0 +1,123 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2023 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// XHTML extension to TGUI - Texus' Graphical User Interface
+// Copyright (C) 2023 Steffen Ploetz (Steffen.Ploetz@cityweb.de)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef TGUI_MAPPED_FILE_HPP
+#define TGUI_MAPPED_FILE_HPP
+
+#include <string>
+
+namespace tgui  { namespace xhtml
+{
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Provides read-only access to the content of a file, that is mapped into memory
+    ///
+    /// The memory mapping is only supported on Linux. On any other system, as well as for empty files, open() fails and the
+    /// caller is expected to fall back to the regular stream based file reading.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API MappedFile
+    {
+    public:
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Default constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        MappedFile()
+            : m_data(nullptr), m_size(0)
+        { }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Deleted copy constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        MappedFile(const MappedFile&) = delete;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Deleted assignment operator overload
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Destructor, releases the memory mapping (if any)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~MappedFile()
+        {   close();   }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Maps the indicated file read-only into memory
+        ///
+        /// A previous memory mapping is released.
+        ///
+        /// @param filePath      The file to map into memory
+        /// @param errorMessage  [OUT] The error message on any error or an empty string otherwise
+        ///
+        /// @return The flag whether the file has been mapped into memory
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool open(const std::string& filePath, std::string& errorMessage);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Releases the memory mapping (if any)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void close();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Determines whether a file is currently mapped into memory
+        ///
+        /// @return The flag whether a file is currently mapped into memory
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        inline bool isOpen() const
+        {   return m_data != nullptr;   }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Gets the first byte of the mapped file content
+        ///
+        /// @return The first byte of the mapped file content or nullptr, if no file is mapped
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        inline const char* getData() const
+        {   return m_data;   }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Gets the size of the mapped file content
+        ///
+        /// @return The size of the mapped file content in bytes
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        inline size_t getSize() const
+        {   return m_size;   }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Determines whether memory mapping is supported on the current system
+        ///
+        /// @return The flag whether memory mapping is supported
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isSupported();
+
+    private:
+        const char* m_data;   //!< The first byte of the mapped file content
+        size_t      m_size;   //!< The size of the mapped file content in bytes
+    };
+
+} }
+
+#endif // TGUI_MAPPED_FILE_HPP
@@ -193,19 +193,43 @@ namespace tgui  { namespace xhtml
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        /// @brief Determines the size type
+        /// @brief Determines the size type (the measuring unit is case insensitive)
         ///
         /// @param sizePart  The string that should contain information about the size type
         ///
         /// @return          The size type
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        static inline SizeType determineSizeType(tgui::String sizePart)
+        static inline SizeType determineSizeType(const tgui::String& sizePart)
+        {   return determineSizeType(sizePart.data(), sizePart.length());   }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Determines the size type (the measuring unit is case insensitive)
+        ///
+        /// @param sizePart  The first character of the span, that should contain information about the size type
+        /// @param length    The length of the span
+        ///
+        /// @return          The size type
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static inline SizeType determineSizeType(const char32_t* sizePart, size_t length)
         {
-            if (sizePart.find(U"px") != SIZE_MAX)        return SizeType::Pixel;
-            else if (sizePart.find(U"pt") != SIZE_MAX)   return SizeType::Point;
-            else if (sizePart.find(U"em") != SIZE_MAX)   return SizeType::EquivalentOfM;
-            else if (sizePart.find(U"%") != SIZE_MAX)    return SizeType::Relative;
-            else                                         return SizeType::Pixel;
+            bool hasPoint = false;
+            bool hasEm = false;
+            bool hasPercent = false;
+            for (size_t position = 0; position < length; position++)
+            {
+                // folding by bit 5 is sufficient, since only the letters 'p', 'x', 't', 'e' and 'm' are compared
+                const char32_t character = sizePart[position] | 0x20;
+                const char32_t next      = (position + 1 < length ? sizePart[position + 1] | 0x20 : 0);
+                if (character == U'p' && next == U'x')
+                    return SizeType::Pixel;
+                hasPoint   = hasPoint   || (character == U'p' && next == U't');
+                hasEm      = hasEm      || (character == U'e' && next == U'm');
+                hasPercent = hasPercent || (sizePart[position] == U'%');
+            }
+            if (hasPoint)        return SizeType::Point;
+            else if (hasEm)      return SizeType::EquivalentOfM;
+            else if (hasPercent) return SizeType::Relative;
+            else                 return SizeType::Pixel;
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,241 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2023 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// XHTML extension to TGUI - Texus' Graphical User Interface
+// Copyright (C) 2023 Steffen Ploetz (Steffen.Ploetz@cityweb.de)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef TGUI_PERFECT_HASH_TABLE_HPP
+#define TGUI_PERFECT_HASH_TABLE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace tgui  { namespace xhtml
+{
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief One key/value pair of a perfect hash table
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <typename ValueT>
+    struct PerfectHashEntry
+    {
+        const char* Key;   //!< The (ASCII) key, must be lower case for case insensitive tables
+        ValueT      Value; //!< The value, that is mapped to the key
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Provides a read-only map from (ASCII) string keys to values, that is completely built at compile time
+    ///
+    /// The table uses the 'hash and displace' scheme: The keys are distributed to buckets by a first hash and every bucket
+    /// gets a displacement, that moves all keys of the bucket to free slots. Thus a lookup costs one hash calculation, two
+    /// array accesses and one string compare, independent of the number of entries. Since the table is a literal type, a
+    /// 'constexpr' instance requires no static initialization at all.
+    ///
+    /// Whether the construction succeeded must be verified by static_assert(table.isValid()).
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <typename ValueT, size_t EntryCount>
+    class PerfectHashTable
+    {
+    public:
+        static constexpr size_t SlotCount   = (EntryCount <= 8 ? 16 : (EntryCount <= 32 ? 64 : (EntryCount <= 128 ? 256 :
+                                               (EntryCount <= 512 ? 1024 : (EntryCount <= 2048 ? 4096 : 16384))))); //!< The number of slots (a power of 2)
+        static constexpr size_t BucketCount = SlotCount / 4;                  //!< The number of buckets (a power of 2)
+        static constexpr std::uint16_t EmptySlot = 0xFFFF;                    //!< The marker of an unused slot
+        static constexpr std::uint16_t MaxDisplacement = 0x3FFF;              //!< The highest displacement to try
+
+        static_assert(EntryCount < EmptySlot, "Too many entries for a perfect hash table!");
+
+    public:
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief The constructor, that calculates the slots and displacements
+        ///
+        /// @param entries     The key/value pairs, the keys must be unique
+        /// @param ignoreCase  Determine whether the lookup ignores the case of ASCII letters (the keys must be lower case)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        constexpr PerfectHashTable(const PerfectHashEntry<ValueT> (&entries)[EntryCount], bool ignoreCase)
+            : m_entries(), m_slots(), m_displacements(), m_maxKeyLength(0), m_ignoreCase(ignoreCase), m_isValid(true)
+        {
+            std::uint64_t hashes[EntryCount] = {};
+            size_t        bucketSizes[BucketCount] = {};
+            for (size_t index = 0; index < EntryCount; index++)
+            {
+                m_entries[index] = entries[index];
+
+                size_t length = 0;
+                while (entries[index].Key[length] != '\0')
+                    length++;
+                if (m_maxKeyLength < length)
+                    m_maxKeyLength = length;
+
+                hashes[index] = hash(entries[index].Key, length, ignoreCase);
+                bucketSizes[hashes[index] & (BucketCount - 1)]++;
+            }
+
+            for (size_t slot = 0; slot < SlotCount; slot++)
+                m_slots[slot] = EmptySlot;
+
+            // Place the buckets in descending order of their size, since large buckets are the hardest to place.
+            size_t largestBucketSize = 0;
+            for (size_t bucket = 0; bucket < BucketCount; bucket++)
+                if (largestBucketSize < bucketSizes[bucket])
+                    largestBucketSize = bucketSizes[bucket];
+
+            for (size_t bucketSize = largestBucketSize; bucketSize > 0; bucketSize--)
+            {
+                for (size_t bucket = 0; bucket < BucketCount; bucket++)
+                {
+                    if (bucketSizes[bucket] != bucketSize)
+                        continue;
+
+                    bool isPlaced = false;
+                    for (std::uint16_t displacement = 0; !isPlaced && displacement <= MaxDisplacement; displacement++)
+                    {
+                        isPlaced = true;
+                        for (size_t index = 0; isPlaced && index < EntryCount; index++)
+                        {
+                            if ((hashes[index] & (BucketCount - 1)) != bucket)
+                                continue;
+                            const size_t slot = calculateSlot(hashes[index], displacement);
+                            if (m_slots[slot] != EmptySlot)
+                                isPlaced = false;
+                            else
+                                m_slots[slot] = static_cast<std::uint16_t>(index);
+                        }
+
+                        if (isPlaced)
+                        {
+                            m_displacements[bucket] = displacement;
+                        }
+                        else
+                        {
+                            // Undo the partial placement of this bucket.
+                            for (size_t slot = 0; slot < SlotCount; slot++)
+                                if (m_slots[slot] != EmptySlot && (hashes[m_slots[slot]] & (BucketCount - 1)) == bucket)
+                                    m_slots[slot] = EmptySlot;
+                        }
+                    }
+                    if (!isPlaced)
+                        m_isValid = false;
+                }
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Determines whether the construction has been successful (all keys are unique and have a unique slot)
+        ///
+        /// @return The flag whether the construction has been successful
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        constexpr bool isValid() const
+        {   return m_isValid;   }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Finds the value, that is mapped to the indicated key
+        ///
+        /// @param key     The first character of the key, needs not to be zero terminated
+        /// @param length  The length of the key
+        ///
+        /// @return The value on success, or nullptr otherwise
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <typename CharT>
+        constexpr const ValueT* find(const CharT* key, size_t length) const
+        {
+            if (key == nullptr || length == 0 || length > m_maxKeyLength)
+                return nullptr;
+
+            const std::uint64_t keyHash = hash(key, length, m_ignoreCase);
+            const std::uint16_t index = m_slots[calculateSlot(keyHash, m_displacements[keyHash & (BucketCount - 1)])];
+            if (index == EmptySlot)
+                return nullptr;
+
+            const char* entryKey = m_entries[index].Key;
+            for (size_t position = 0; position < length; position++)
+                if (entryKey[position] == '\0' || static_cast<char32_t>(static_cast<unsigned char>(entryKey[position])) != fold(key[position], m_ignoreCase))
+                    return nullptr;
+            return (entryKey[length] == '\0' ? &m_entries[index].Value : nullptr);
+        }
+
+    private:
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Maps upper case ASCII letters to lower case, if the case is to ignore
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <typename CharT>
+        static constexpr char32_t fold(CharT character, bool ignoreCase)
+        {
+            const auto c = static_cast<char32_t>(static_cast<typename std::make_unsigned<CharT>::type>(character));
+            return (ignoreCase && c >= U'A' && c <= U'Z' ? c + (U'a' - U'A') : c);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Calculates the 64 bit FNV-1a hash of a key
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <typename CharT>
+        static constexpr std::uint64_t hash(const CharT* key, size_t length, bool ignoreCase)
+        {
+            std::uint64_t value = 0xCBF29CE484222325ull;
+            for (size_t position = 0; position < length; position++)
+            {
+                value ^= static_cast<std::uint64_t>(fold(key[position], ignoreCase));
+                value *= 0x100000001B3ull;
+            }
+            return value;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Calculates the slot of a key hash for the indicated displacement of its bucket
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static constexpr size_t calculateSlot(std::uint64_t keyHash, std::uint16_t displacement)
+        {
+            const std::uint64_t primary   = keyHash >> 40;
+            const std::uint64_t secondary = ((keyHash >> 16) & 0xFFFFFF) | 1;
+            return static_cast<size_t>((primary + displacement * secondary) & (SlotCount - 1));
+        }
+
+    private:
+        PerfectHashEntry<ValueT> m_entries[EntryCount];         //!< The key/value pairs
+        std::uint16_t            m_slots[SlotCount];            //!< The entry index per slot, or EmptySlot
+        std::uint16_t            m_displacements[BucketCount];  //!< The displacement per bucket
+        size_t                   m_maxKeyLength;                //!< The length of the longest key
+        bool                     m_ignoreCase;                  //!< The flag whether the case of ASCII letters is ignored
+        bool                     m_isValid;                     //!< The flag whether the construction has been successful
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Creates a perfect hash table at compile time, with the number of entries deduced from the indicated array
+    ///
+    /// @param entries     The key/value pairs, the keys must be unique
+    /// @param ignoreCase  Determine whether the lookup ignores the case of ASCII letters (the keys must be lower case)
+    ///
+    /// @return The perfect hash table
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <typename ValueT, size_t EntryCount>
+    constexpr PerfectHashTable<ValueT, EntryCount> createPerfectHashTable(const PerfectHashEntry<ValueT> (&entries)[EntryCount],
+                                                                         bool ignoreCase = false)
+    {
+        return PerfectHashTable<ValueT, EntryCount>(entries, ignoreCase);
+    }
+
+} }
+
+#endif // TGUI_PERFECT_HASH_TABLE_HPP
@@ -57,6 +57,59 @@ namespace tgui  { namespace xhtml
         /// Provides convenience helper for UTF string manipulation.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         static bool checkValid(const std::vector<char>& data, bool utf8 = true);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Checks whether the indicated byte range is a valid UTF-8 (or 6 byte UTF-8 like) sequence
+        ///
+        /// @param data  The first byte of the range to check
+        /// @param size  The number of bytes to check
+        /// @param utf8  Determine whether to accept only the 4 byte UTF-8 encoding
+        ///
+        /// @return The flag whether the byte range is valid
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool checkValid(const char* data, size_t size, bool utf8 = true);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Origin:           TGUI-XHTML
+        // Original license: zlib (see XHTML parser license)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Decodes one code point from an UTF-8 byte sequence
+        ///
+        /// Invalid or truncated sequences are not rejected, instead the lead byte is interpreted as ISO 8859-1 (Latin-1)
+        /// character, which is the same fall back that is applied to files, that are recognized as 'ASCII'.
+        ///
+        /// @param begin      The first byte of the sequence to decode
+        /// @param end        The end of the byte range (one past the last byte, that may be read)
+        /// @param codePoint  [OUT] The decoded code point
+        ///
+        /// @return The number of consumed bytes (at least 1 if begin < end, 0 otherwise)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static size_t decodeUtf8(const char* begin, const char* end, char32_t& codePoint);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Decodes an UTF-8 byte range and appends the code points to the indicated UTF-32 string
+        ///
+        /// @param target  The UTF-32 string to append the decoded code points to
+        /// @param begin   The first byte of the range to decode
+        /// @param end     The end of the byte range (one past the last byte to decode)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void appendUtf8(tgui::String& target, const char* begin, const char* end);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Determines the byte offset of the indicated code point within an UTF-8 byte range
+        ///
+        /// The counting is consistent with decodeUtf8(), so it can be used to map positions within a decoded string back
+        /// to positions within the UTF-8 byte range.
+        ///
+        /// @param begin       The first byte of the range
+        /// @param end         The end of the byte range (one past the last byte)
+        /// @param codePoints  The number of code points to skip
+        ///
+        /// @return The byte offset of the code point, or the range length if the range contains less code points
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static size_t offsetOfUtf8CodePoint(const char* begin, const char* end, size_t codePoints);
     };
 
 } }
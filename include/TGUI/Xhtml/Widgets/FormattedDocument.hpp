@@ -108,7 +108,6 @@ namespace tgui  { namespace xhtml
         using ConstPtr = std::shared_ptr<const FormattedDocument>; //!< Shared constant widget pointer
 
         static constexpr const char StaticWidgetType[] = "FormattedDocument";
-        static constexpr const char32_t LinebreakDelimitercharacters[] = U"\r\n\t\v -";
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     public:
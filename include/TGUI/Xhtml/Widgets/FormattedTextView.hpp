@@ -37,7 +37,8 @@ namespace tgui  { namespace xhtml
     /// A formatted text view widget is a multi-line formatted text output field which supports word-wrap and scrollbars.
     /// If you are looking for a multi-line text input field then check out the TextArea class (that doesn't support format).
     ///
-    /// It displays the content of a FormattedDocument
+    /// It displays the content of a FormattedDocument. Scrolling draws the visible part of the display list again, the rendered
+    /// content is not cached in offscreen tiles - the backend-independent render target provides no render-to-texture.
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     class TGUI_API FormattedTextView : public ClickableWidget
     {
@@ -145,7 +146,7 @@ namespace tgui  { namespace xhtml
         /// @param document  The underlying XHTML document to set
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         inline void setDocument(FormattedDocument::Ptr document)
-        {   m_document = document;   }
+        {   m_document = document; m_layoutRenderWidth = -1.0f; rebuildDisplayList();   }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Gets the underlying XHTML document
@@ -182,9 +183,20 @@ namespace tgui  { namespace xhtml
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
+        /// Finds the formatted elements, that are visible at the current scrollbar offsets (draw() also does this on demand)
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void recalculateVisiblePart()
-        {}
+        void recalculateVisiblePart();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Finds the formatted element at a position
+        ///
+        /// The frontmost formatted element wins, that is the one drawn last - e.g. a text section rather than its container.
+        ///
+        /// @param position  The position in layout coordinates (relative to the document origin, independent of the scrollbars)
+        ///
+        /// @return The formatted element at the position or nullptr
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        FormattedElement::Ptr elementAt(Vector2f position) const;
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
@@ -391,7 +403,7 @@ namespace tgui  { namespace xhtml
         static void calculateBorderDots(float distance, float borderWidth, bool dashed, int& numDots, float& stepWidth, float& dotSize);
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        /// @brief Calculates the vertices and indices for a dotted/dashed border line
+        /// @brief Calculates the vertices and indices for a dotted/dashed border line and appends them (nothing if transparent)
         ///
         /// @param numDots     The number of dots/dashes to draw on distance
         /// @param stepWidth   The step width from a dot/dash start coordinate to the next dot/dash start coordinate
@@ -403,13 +415,37 @@ namespace tgui  { namespace xhtml
         /// @param yHI         The higher y-ccordinate of the first dot/dash
         /// @param tLO         The lower y-ccordinate (vertical orientation) or x-ccordinate (horizontal orientation) of the last dot/dash
         /// @param tHI         The higher x-ccordinate (vertical orientation) or y-ccordinate (horizontal orientation) of the last dot/dash
-        /// @param vertices    [out] The vertices of 2D plane
-        /// @param indices     [out] The indices into the vertices of 2D plane, that create triangles representing the 2D plane
+        /// @param vertices    [in/out] The vertices of 2D plane, to append the dots/dashes to
+        /// @param indices     [in/out] The indices into the vertices of 2D plane, that create triangles representing the 2D plane
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         static void calculateDottedBorderVerticesAndIndices(int numDots, float stepWidth, tgui::Vertex::Color color, bool vertical,
             float xLO, float xHI, float yLO, float yHI, float tLO, float tHI,
             std::vector<tgui::Vertex>& vertices, std::vector<unsigned int>& indices);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Calculates the vertices and indices for the background and the borders of a formatted rectangle and appends them
+        ///
+        /// @param formattedRectangle The formatted rectangle (or link)
+        /// @param innerSize          The inner size of the text view, the border widths can relate to
+        /// @param batchVertices      [in/out] The shared vertices, to append the geometry to
+        /// @param batchIndices       [in/out] The shared indices into the shared vertices, to append the triangles to
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void calculateRectangleVerticesAndIndices(const FormattedRectangle::Ptr& formattedRectangle, Vector2f innerSize,
+            std::vector<tgui::Vertex>& batchVertices, std::vector<unsigned int>& batchIndices);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Appends vertices and indices to the shared vertices and indices, unless all vertices are fully transparent
+        ///
+        /// @param vertices      The vertices to append
+        /// @param vertexCount   The number of vertices to append
+        /// @param indices       The indices into the vertices to append
+        /// @param indexCount    The number of indices to append
+        /// @param batchVertices [in/out] The shared vertices
+        /// @param batchIndices  [in/out] The shared indices into the shared vertices
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void appendVerticesAndIndices(const tgui::Vertex* vertices, size_t vertexCount, const unsigned int* indices, size_t indexCount,
+            std::vector<tgui::Vertex>& batchVertices, std::vector<unsigned int>& batchIndices);
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Calculates a color, darker than the indicated color and applies the indicated opacity
         ///
@@ -430,6 +466,40 @@ namespace tgui  { namespace xhtml
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         static tgui::Vertex::Color calculateLighterColor(tgui::Color color, float opacity);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Rebuilds the display list (the document content, indexed by vertical extent) after a layout
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void rebuildDisplayList();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Finds the display list entries, that intersect a vertical range, and keeps them in content order
+        ///
+        /// @param top     The top of the vertical range (layout coordinates)
+        /// @param bottom  The bottom of the vertical range (layout coordinates)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void findVisibleDisplayListEntries(float top, float bottom) const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Finds the display list entries of the hit test grid row, that contains a vertical position
+        ///
+        /// @param y      The vertical position (layout coordinates)
+        /// @param begin  [out] The first display list index of the row, or nullptr if there is no such row
+        /// @param end    [out] The end of the display list indices of the row, or nullptr if there is no such row
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void findHitTestRow(float y, const size_t*& begin, const size_t*& end) const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Provides the retained text of a text section display list entry, creating it on first use
+        ///
+        /// The glyph geometry of the text is kept until the entry leaves the visible part or the document is laid out again.
+        /// Only a change of the link state patches the color and style of the retained text.
+        ///
+        /// @param displayListIndex  The index of the text section entry within the display list
+        ///
+        /// @return The retained text, ready to draw
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const Text& getRetainedText(size_t displayListIndex) const;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     public:
 
@@ -438,8 +508,46 @@ namespace tgui  { namespace xhtml
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief The kinds of formatted elements, the display list distinguishes to draw them
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        enum class DisplayListEntryKind
+        {
+            TextSection,    //!< A FormattedTextSection
+            Image,          //!< A FormattedImage
+            Rectangle       //!< A FormattedRectangle (including FormattedLink)
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief A formatted element of the document content together with its vertical extent
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct DisplayListEntry
+        {
+            DisplayListEntry(FormattedElement::Ptr element, size_t index, DisplayListEntryKind kind)
+                : Top(element->getLayoutTop()), Bottom(std::max(element->getLayoutTop(), element->getLayoutBottom())), Index(index),
+                  Kind(kind), Element(element), SourceAnchor(), TextGeometry(), TextGeometryShowsActiveLink(false),
+                  GeometryVertexBegin(0), GeometryVertexEnd(0), GeometryIndexBegin(0), GeometryIndexEnd(0)
+            { }
+
+            float                 Top;          //!< The top of the layout area
+            float                 Bottom;       //!< The bottom of the layout area
+            size_t                Index;        //!< The index of the formatted element within the document content
+            DisplayListEntryKind  Kind;         //!< The kind of the formatted element
+            FormattedElement::Ptr Element;      //!< The formatted element
+            FormattedLink::Ptr    SourceAnchor; //!< The link, a text section belongs to, the link itself for a link rectangle, or nullptr
+
+            mutable std::shared_ptr<Text> TextGeometry;            //!< The retained text (and its glyph geometry) of a visible text section, or nullptr
+            mutable bool                  TextGeometryShowsActiveLink; //!< Whether the retained text is colored and styled as an active link
+
+            size_t                GeometryVertexBegin; //!< The first vertex of a rectangle within the shared rectangle vertices
+            size_t                GeometryVertexEnd;   //!< The end of the vertices of a rectangle within the shared rectangle vertices
+            size_t                GeometryIndexBegin;  //!< The first index of a rectangle within the shared rectangle indices
+            size_t                GeometryIndexEnd;    //!< The end of the indices of a rectangle within the shared rectangle indices
+        };
+
         FormattedDocument::Ptr                   m_document;              //!< The formatted document to display
         float                                    m_zoom = 1.0f;           //!< The zoom
+        float                                    m_layoutRenderWidth = -1.0f; //!< The render width of the last layout, or -1 if not laid out
 
         Borders                                  m_bordersCached;
         Padding                                  m_paddingCached;
@@ -456,8 +564,21 @@ namespace tgui  { namespace xhtml
 
         // The fonts
         FormattedDocument::FontCollection        m_fontCollection;
-        std::vector<FormattedLink::Ptr>          m_anchorSources;         //!< The list of formatted links
+        std::vector<FormattedLink::Ptr>          m_activeAnchorSources;   //!< The list of active (hovered) formatted links
         std::map<String, FormattedElement::Ptr>  m_anchorTargets;         //!< The list of link targets
+
+        std::vector<DisplayListEntry>            m_displayList;           //!< The short entries sorted by top, followed by the tall entries sorted by top
+        size_t                                   m_tallDisplayListStart = 0; //!< The index of the first tall entry (containers) within the display list
+        float                                    m_displayListMaxHeight = 0.0f; //!< The height of the tallest short entry
+        Vector2f                                 m_displayListInnerSize;  //!< The inner size, the rectangle and border geometry has been built for
+        std::vector<Vertex>                      m_rectangleVertices;     //!< The background and border vertices of all rectangles, built once per layout
+        std::vector<unsigned int>                m_rectangleIndices;      //!< The rectangle triangles, each relative to the first vertex of its rectangle
+        mutable std::vector<unsigned int>        m_rectangleRunIndices;   //!< The reused indices of a run of adjacent rectangles, relative to the first vertex of the run
+        mutable std::vector<size_t>              m_visibleDisplayList;    //!< The indices of the visible display list entries, in content order
+        mutable float                            m_visiblePartTop = 0.0f; //!< The top of the vertical range, the visible entries have been found for
+        mutable float                            m_visiblePartBottom = -1.0f; //!< The bottom of that range, or less than its top if not found yet
+        std::vector<size_t>                      m_hitTestRowStarts;      //!< The start of each hit test grid row within the hit test entries, plus the end
+        std::vector<size_t>                      m_hitTestEntries;        //!< The display list indices of the entries, that overlap a row, row by row
     };
 
 } }
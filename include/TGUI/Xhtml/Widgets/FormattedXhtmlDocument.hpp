@@ -26,7 +26,10 @@
 #ifndef TGUI_FORMATTED_TEXT_XHTML_DOCUMENT_HPP
 #define TGUI_FORMATTED_TEXT_XHTML_DOCUMENT_HPP
 
+#include <unordered_map>
+
 #include "TGUI/Xhtml/Widgets/FormattedDocument.hpp"
+#include "TGUI/Xhtml/Widgets/GlyphAdvanceCache.hpp"
 #include "TGUI/Xhtml/Dom/XhtmlElements.hpp"
 
 namespace tgui  { namespace xhtml
@@ -76,10 +79,91 @@ namespace tgui  { namespace xhtml
         return static_cast<StyleCategoryFlags>(static_cast<int>(left) & static_cast<int>(right));
     }
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Layout traits of an XHTML element type, precomputed per tag ID to replace tag name comparisons during layout
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    enum class LayoutTraitFlags
+    {
+        None                        =     0,  //!< No layout traits (not rendered or not supported)
+        Block                       =     1,  //!< The element is a block, that caches and restores the formatting state
+        FlowContent                 =     2,  //!< The element is flow content (text or line break)
+        InitializesBackground       =     4,  //!< The element applies background and border style at the beginning
+        FinalizesBackground         =     8,  //!< The element completes the background extent at the end
+        TakesMargin                 =    16,  //!< The element applies the margin style
+        TakesPadding                =    32,  //!< The element applies the padding style
+        SuppressesInitialExtraSpace =    64,  //!< The first child element can be placed without preceding extra space
+        ProvidesExtraSpace          =   128,  //!< The element provides extra space to its successor
+        EndsRunLengthExpansion      =   256,  //!< The element ends the run length expansion of its last child
+        Heading                     =   512,  //!< The element is a headline (H1 ... H6)
+        List                        =  1024,  //!< The element is a list (ordered or unordered)
+        TableRowRange               =  2048,  //!< The element is a table row range (head, body or foot)
+        TableCell                   =  4096,  //!< The element is a table cell (header or data)
+        TextBlock                   =  8192,  //!< The element is a text block (division, preformatted or code)
+        InlineBox                   = 16384   //!< The element is an inline box (span or anchor)
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Combines two layout trait flags with binary OR operator
+    ///
+    /// @param left  The first layout trait flag to combine with binary OR operator
+    /// @param right The second layout trait flag to combine with binary OR operator
+    ///
+    /// @return The combination of the two indicated layout trait flags
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    constexpr LayoutTraitFlags operator|(LayoutTraitFlags left, LayoutTraitFlags right)
+    {
+        return static_cast<LayoutTraitFlags>(static_cast<int>(left) | static_cast<int>(right));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Combines two layout trait flags with binary AND operator
+    ///
+    /// @param left  The first layout trait flag to combine with binary AND operator
+    /// @param right The second layout trait flag to combine with binary AND operator
+    ///
+    /// @return The combination of the two indicated layout trait flags
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    constexpr LayoutTraitFlags operator&(LayoutTraitFlags left, LayoutTraitFlags right)
+    {
+        return static_cast<LayoutTraitFlags>(static_cast<int>(left) & static_cast<int>(right));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Determines whether the layout traits contain any of the indicated flags
+    ///
+    /// @param traits  The layout traits to test
+    /// @param flags   The flags to test for
+    ///
+    /// @return The flag whether at least one of the indicated flags is set
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    constexpr bool hasAnyLayoutTrait(LayoutTraitFlags traits, LayoutTraitFlags flags)
+    {
+        return (static_cast<int>(traits) & static_cast<int>(flags)) != 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief The result of one document of a batch parse
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct XhtmlDocumentParseResult
+    {
+        int                                                State = 0;      //!< The state with the value 0 on success, value -1 if
+                                                                           //!< the file can not be red, value -2 if the file can
+                                                                           //!< not be parsed or is empty or value -3 if no XHTML
+                                                                           //!< document root tag (<html ...></html>) is available
+        std::vector<XhtmlElement::Ptr>                     RootElements;   //!< The collection of XHTML DOM root elements
+        XhtmlDiagnostics                                   Diagnostics;    //!< The errors/warnings of the file reader and parser
+    };
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// @brief The formatted XHTML document
     ///
     /// A (specialized) XHTML formatted data holder with XHTML element support.
+    ///
+    /// Reading and parsing (the static methods read...(), detect...(), parse...() and loadXhtmlDocuments()) is reentrant:
+    /// Concurrent calls for different documents are safe, since the parser shares no mutable state between parser runs (the
+    /// tables of tags, entities and colors are compile-time constants and the DOM memory resource is bound per thread). The
+    /// resulting XHTML DOM belongs to the calling thread and may be handed over to another thread, but must not be modified
+    /// concurrently. The layout and all non-static methods must be called from the GUI thread.
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     class TGUI_API FormattedXhtmlDocument : public FormattedDocument
     {
@@ -204,7 +288,7 @@ namespace tgui  { namespace xhtml
         /// @param rootElement  The root element of the XHTML element tree
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         inline void setRootElement(XhtmlContainerElement::Ptr rootElement)
-        {   m_rootElement = rootElement;   }
+        {   m_rootElement = rootElement; m_textRunMetrics.clear();   }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Gets the root element of the registered XHTML element tree
@@ -236,22 +320,24 @@ namespace tgui  { namespace xhtml
         XhtmlStyle::Ptr getStyleElement() const;
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        /// @brief Gets the collection of applicable style elements, global ones prior local
+        /// @brief Gets the collection of applicable global style elements - the local style entry is not included
         ///
-        /// @param xhtmlElement  The XHTML element to get local style entry from
+        /// @param xhtmlElement  The XHTML element to get the matching global style entries for
         ///
-        /// @return The collection of applicable style elements, global ones prior local. Can be empty collection
+        /// @return The collection of applicable global style elements in cascade order, cached by the XHTML element (valid
+        ///         until the XHTML element or the style sheet changes). Can be empty collection
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        std::vector<XhtmlStyleEntry::Ptr> getApplicableStyleElements(XhtmlElement::Ptr xhtmlElement);
+        const std::vector<XhtmlStyleEntry::Ptr>& getApplicableStyleElements(XhtmlElement::Ptr xhtmlElement);
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Applies a list of XHTML style entries to the formatting state
         ///
-        /// @param styleEntries                             The XHTML style entries to apply
+        /// @param styleEntries                             The global XHTML style entries to apply
+        /// @param localStyleEntry                          The local XHTML style entry to apply last. Can be nullptr
         /// @param styleCategories                          The style categories to apply
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void applyStyleEntriesToFormattingState(const std::vector<XhtmlStyleEntry::Ptr> styleEntries,
-            const FormattedDocument::FontCollection& fontCollection,
+        void applyStyleEntriesToFormattingState(const std::vector<XhtmlStyleEntry::Ptr>& styleEntries,
+            const XhtmlStyleEntry::Ptr& localStyleEntry, const FormattedDocument::FontCollection& fontCollection,
             StyleCategoryFlags styleCategories = StyleCategoryFlags::ColorsAndOpacity | StyleCategoryFlags::Fonts);
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -259,11 +345,12 @@ namespace tgui  { namespace xhtml
         ///
         /// @param formattedElement                         The formatted element to apply the style entries to
         /// @param parentSize                               The parent size for the calculation of a relative defined size
-        /// @param styleEntries                             The XHTML style entries to apply
+        /// @param styleEntries                             The global XHTML style entries to apply
+        /// @param localStyleEntry                          The local XHTML style entry to apply last. Can be nullptr
         /// @param styleCategories                          The style categories to apply
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void applyStyleEntriesToFormattedElement(FormattedElement::Ptr formattedElement, const std::vector<XhtmlStyleEntry::Ptr> styleEntries,
-            Vector2f parentSize, const FormattedDocument::FontCollection& fontCollection,
+        void applyStyleEntriesToFormattedElement(FormattedElement::Ptr formattedElement, const std::vector<XhtmlStyleEntry::Ptr>& styleEntries,
+            const XhtmlStyleEntry::Ptr& localStyleEntry, Vector2f parentSize, const FormattedDocument::FontCollection& fontCollection,
             StyleCategoryFlags styleCategories = StyleCategoryFlags::ColorsAndOpacity | StyleCategoryFlags::Fonts);
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -356,6 +443,33 @@ namespace tgui  { namespace xhtml
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         static tgui::String readXhtmlDocument(const std::string filePath, tgui::String& fileEncoding, std::string& errorMessage);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Reads an XHTML file into an UTF-8 byte string (without conversion to UTF-32)
+        ///
+        /// An UTF-8 byte order mark is removed. UTF-16 encoded files are not supported.
+        ///
+        /// @param filePath         The XHTML file to read into an UTF-8 byte string
+        /// @param fileEncoding     [OUT] The file encding if recognized or an empty string otherwise
+        /// @param errorMessage     [OUT] The error message on any error or an empty string otherwise
+        ///
+        /// @return The XHTML file content on success or an empty string otherwise
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::string readXhtmlDocumentUtf8(const std::string filePath, tgui::String& fileEncoding, std::string& errorMessage);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Detects the encoding of an XHTML byte string and skips an UTF-8 byte order mark
+        ///
+        /// Works on any byte range (e. g. a memory mapped file), the byte string is neither copied nor modified.
+        ///
+        /// @param hypertextUtf8    [IN/OUT] The XHTML byte string, an UTF-8 byte order mark is removed from the view
+        /// @param fileEncoding     [OUT] The file encding if recognized or an empty string otherwise
+        /// @param errorMessage     [OUT] The error message on any error or an empty string otherwise
+        ///
+        /// @return The flag whether the XHTML byte string is supported (not empty and not UTF-16 encoded)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool detectXhtmlDocumentEncoding(tgui::CharStringView& hypertextUtf8, tgui::String& fileEncoding,
+                                                std::string& errorMessage);
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Parses an XHTML string into an XHTML DOM
         ///
@@ -369,19 +483,84 @@ namespace tgui  { namespace xhtml
                                                                  bool resolveEntities = true, bool trace = false);
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Parses an UTF-8 encoded XHTML byte string into an XHTML DOM (zero-copy mode)
+        ///
+        /// Only inner texts and tag markup are decoded, the byte string is neither copied nor converted to UTF-32 as a whole.
+        ///
+        /// @param hypertextUtf8    The UTF-8 encoded XHTML byte string to parse into an XHTML DOM
+        /// @param resolveEntities  Determine whether to resolve entities
+        /// @param trace            Determine whether to trace the result (element tree) and errors/warnings to std::cout.
+        ///
+        /// @return The collection of XHTML DOM root elements. Can be empty
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::vector<XhtmlElement::Ptr> parseXhtmlDocumentUtf8(tgui::CharStringView hypertextUtf8,
+                                                                     bool resolveEntities = true, bool trace = false);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Parses a batch of UTF-8 encoded XHTML byte strings into XHTML DOMs on a pool of worker threads
+        ///
+        /// The byte strings must stay valid until the method returns. Every byte string is parsed like by
+        /// parseXhtmlDocumentUtf8(), an UTF-8 byte order mark is skipped.
+        ///
+        /// @param hypertextsUtf8   The UTF-8 encoded XHTML byte strings to parse into XHTML DOMs
+        /// @param resolveEntities  Determine whether to resolve entities
+        /// @param threadCount      The maximum number of worker threads, or 0 to use the number of hardware threads
+        /// @param diagnosticsMode  The effort to spend on errors/warnings (collect them, count them only or ignore them)
+        ///
+        /// @return The results in the order of the byte strings
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::vector<XhtmlDocumentParseResult> parseXhtmlDocumentsUtf8(const std::vector<tgui::CharStringView>& hypertextsUtf8,
+                                                                             bool resolveEntities = true, unsigned int threadCount = 0,
+                                                                             XhtmlDiagnosticsMode diagnosticsMode = XhtmlDiagnosticsMode::Collect);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Reads and parses a batch of XHTML files into XHTML DOMs on a pool of worker threads
+        ///
+        /// Every file is read and parsed like by loadDocument() (memory mapped if supported), but without replacing the XHTML DOM
+        /// of any document. Use setRootElement() to show a result.
+        ///
+        /// @param filePaths        The XHTML files to read and parse into XHTML DOMs
+        /// @param resolveEntities  Determine whether to resolve entities
+        /// @param threadCount      The maximum number of worker threads, or 0 to use the number of hardware threads
+        /// @param diagnosticsMode  The effort to spend on errors/warnings (collect them, count them only or ignore them)
+        ///
+        /// @return The results in the order of the files
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::vector<XhtmlDocumentParseResult> loadXhtmlDocuments(const std::vector<std::string>& filePaths,
+                                                                        bool resolveEntities = true, unsigned int threadCount = 0,
+                                                                        XhtmlDiagnosticsMode diagnosticsMode = XhtmlDiagnosticsMode::Collect);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        /// @brief Calculates the best outo-line-break position, that enables the biggest possible part of the 'remainingText' to be
-        /// placed on the current FormattedTextSection assuming this FormattedTextSection has remaining 'runLengt'
+        /// @brief Calculates the best outo-line-break, that enables the biggest possible part of the remaining text from 'lineStart'
+        /// on to be placed on the current line
+        ///
+        /// The break opportunities of the text are searched by binary search over the exact run lengths of the measurement.
+        ///
+        /// @param breakOpportunities   The break opportunities of the text, as determined by the inner text element
+        /// @param lineStart            The position of the first character of the remaining text
+        /// @param textRunMeasure       The measurement of the text
+        ///
+        /// @return                     The index of the best break opportunity on success, or SIZE_MAX otherwise (which is equal
+        ///                             to std::string::npos and (size_t)-1)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        size_t calculateAutoLineBreak(const std::vector<XhtmlBreakOpportunity>& breakOpportunities, size_t lineStart,
+                                      const TextRunMeasure& textRunMeasure) const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Measures the complete text of an inner text element with the current font and text height
         ///
-        /// @param remainingText        The text to calculate the best outo-line-break position for
-        /// @param runLengt             The remaining run lengt on the current FormattedTextSection
+        /// The measurement is kept between layout passes, so a relayout for a new width (the only thing that changes while a
+        /// window is resized) reuses it and only the line breaking and positioning is calculated again.
         ///
-        /// @return                     The best outo-line-break position on success, or SIZE_MAX otherwise (which is equal to
-        ///                             std::string::npos and (size_t)-1)
+        /// @param innerText            The inner text element, that provides the text
+        /// @param text                 The text of the inner text element
+        ///
+        /// @return                     The measurement, that provides the run length of any part of the text
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        size_t calculateAutoLineBreak(const String remainingText, float runLengt) const;
+        const TextRunMeasure& measureTextRun(const XhtmlInnerText& innerText, const String& text);
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Calculates the column requested sizes of a table
@@ -419,6 +598,15 @@ namespace tgui  { namespace xhtml
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void calculateTableColumnPreferredSizes(float availableDimension, FormattedDocument::TableMetric::Ptr tableMetric);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Gets the precomputed layout traits of an XHTML element type
+        ///
+        /// @param tagId  The tag ID of the XHTML element type
+        ///
+        /// @return The layout traits of the XHTML element type
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static LayoutTraitFlags getLayoutTraits(XhtmlElementType::TagId tagId);
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Rearrange the visible content, defined by the indicated XHTML Element
         ///
@@ -434,6 +622,22 @@ namespace tgui  { namespace xhtml
                     const FormattedDocument::FontCollection& fontCollection, bool keepSelection);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief The measured prefix run lengths of the text of an inner text element
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct TextRunMetric
+        {
+            TextRunMetric()
+                : TextFont(nullptr), TextHeight(0), TextRevision(0), LayoutPass(0), Measure()
+            { }
+
+            Font                     TextFont;      //!< The font, the text has been measured with
+            unsigned int             TextHeight;    //!< The character size, the text has been measured with
+            XhtmlAttribute::Revision TextRevision;  //!< The revision of the measured text
+            size_t                   LayoutPass;    //!< The layout pass, that has used the measurement last
+            TextRunMeasure           Measure;       //!< The measured prefix run lengths
+        };
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
@@ -441,6 +645,7 @@ namespace tgui  { namespace xhtml
         std::vector<FormattedElement::Ptr>        m_content;                  //!< The collection of formatted content elements
         XhtmlContainerElement::Ptr                m_rootElement;              //!< The root element of the raw data elements
         Widget::Ptr                               m_errorNotifyDlgParent;     //!< The parent window to notify errors via dialog (if not nullptr).
+        MessageBox::Ptr                           m_errorMessageBox;          //!< The dialog to notify errors, created on first use
 
         float                                     m_defaultTextSize;          //!< The default text size (for HTML typically 16)
         Color                                     m_defaultForeColor;         //!< The default fore color
@@ -456,6 +661,9 @@ namespace tgui  { namespace xhtml
         FormattingState                           m_formattingState;          //!< The current state of all formatting attributes
         float                                     m_listPadding;              //!< The indent per list level
         float                                     m_backPadding;              //!< Back indent of the list item bullet, relative to the list item indent
+
+        std::unordered_map<const XhtmlElement*, TextRunMetric> m_textRunMetrics; //!< The text measurements, kept between layout passes
+        size_t                                    m_layoutPass;               //!< The number of layout passes, to prune unused text measurements
     };
 } }
 
@@ -0,0 +1,125 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Glyph advance cache (zlib license) provided for TGUI - Texus' Graphical User Interface
+// Copyright (C) 2023 Steffen Ploetz (Steffen.Ploetz@cityweb.de)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_GLYPH_ADVANCE_CACHE_HPP
+#define TGUI_GLYPH_ADVANCE_CACHE_HPP
+
+#include <algorithm>
+#include <vector>
+
+namespace tgui  { namespace xhtml
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief The process-wide cache of glyph advances and kernings per font, character size and boldness
+    ///
+    /// Fonts are identified by their backend font. The entries of destroyed fonts are dropped, when entries for a new font are added.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API GlyphAdvanceCache
+    {
+    public:
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Measures the prefix run lengths of a text, the same way 'Text::getLineWidth()' does
+        ///
+        /// @param text              The text to measure
+        /// @param font              The font to measure the text with
+        /// @param characterSize     The character size to measure the text with
+        /// @param bold              The flag determining whether to measure the bold glyphs
+        /// @param prefixRunLengths  The run lengths of all prefixes of the text: '[i]' is the run length of the first 'i' characters
+        /// @param kernings          The kernings: '[i]' is the kerning between the characters at 'i - 1' and 'i'
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void measure(const String& text, const Font& font, unsigned int characterSize, bool bold,
+                            std::vector<float>& prefixRunLengths, std::vector<float>& kernings);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Drops all cached glyph advances and kernings
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void clear();
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief The measured prefix run lengths of a text, that provide the run length of any part of the text in constant time
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API TextRunMeasure
+    {
+    public:
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Default constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TextRunMeasure()
+            : m_prefixRunLengths(1, 0.0f), m_kernings()
+        { }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Measures the text (replaces any previous measurement)
+        ///
+        /// @param text           The text to measure
+        /// @param font           The font to measure the text with
+        /// @param characterSize  The character size to measure the text with
+        /// @param bold           The flag determining whether to measure the bold glyphs
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        inline void measure(const String& text, const Font& font, unsigned int characterSize, bool bold = false)
+        {   GlyphAdvanceCache::measure(text, font, characterSize, bold, m_prefixRunLengths, m_kernings);   }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Gets the number of measured characters
+        ///
+        /// @return The number of measured characters
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        inline size_t getLength() const
+        {   return m_prefixRunLengths.size() - 1;   }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Gets the run length of a part of the text, as if the part would have been measured on its own
+        ///
+        /// @param begin  The position of the first character of the part
+        /// @param end    The position behind the last character of the part (clipped to the length of the text)
+        ///
+        /// @return The run length of the part of the text
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        inline float getRunLength(size_t begin, size_t end) const
+        {
+            end = std::min(end, getLength());
+            if (begin >= end)
+                return 0.0f;
+            // the kerning to the character in front of the part doesn't belong to the part
+            return m_prefixRunLengths[end] - m_prefixRunLengths[begin] - (begin > 0 ? m_kernings[begin] : 0.0f);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Gets the run length of the complete text
+        ///
+        /// @return The run length of the complete text
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        inline float getRunLength() const
+        {   return m_prefixRunLengths.back();   }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+        std::vector<float> m_prefixRunLengths; //!< The run lengths of all prefixes of the text
+        std::vector<float> m_kernings;         //!< The kernings between each character and its predecessor
+    };
+} }
+
+#endif // TGUI_GLYPH_ADVANCE_CACHE_HPP
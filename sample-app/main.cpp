@@ -9,6 +9,8 @@
 #include <thread>
 #include <cmath>
 #include <cstdint>
+#include <chrono>
+#include <functional>
 
 #include <TGUI/Config.hpp>
 #include <TGUI/TGUI.hpp>
@@ -20,7 +22,14 @@
 #include <TGUI/Backend/SFML-OpenGL3.hpp>
 #endif
 
+#ifdef TGUI_SYSTEM_LINUX
+#include <fcntl.h>
+#include <unistd.h>
+#include <malloc.h>
+#endif
+
 #include "TGUI/Xhtml/StringHelper.hpp"
+#include "TGUI/Xhtml/MappedFile.hpp"
 #include "TGUI/Xhtml/Dom/XhtmlEntityResolver.hpp"
 #include "TGUI/Xhtml/Dom/XhtmlAttributes.hpp"
 #include "TGUI/Xhtml/Dom/XhtmlElements.hpp"
@@ -610,11 +619,639 @@ public:
     }
 };
 
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief Removes the indicated file from the operating system page cache (if supported)
+///
+/// @param filePath  The file to remove from the page cache
+///
+/// @return The flag whether the file has been removed from the page cache
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+static bool evictFromPageCache(const std::string& filePath)
+{
+#ifdef TGUI_SYSTEM_LINUX
+    int fileDescriptor = ::open(filePath.c_str(), O_RDONLY);
+    if (fileDescriptor < 0)
+        return false;
+    bool evicted = (posix_fadvise(fileDescriptor, 0, 0, POSIX_FADV_DONTNEED) == 0);
+    ::close(fileDescriptor);
+    return evicted;
+#else
+    UNUSED(filePath);
+    return false;
+#endif
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief Creates a large XHTML document by repeating the body content of the indicated XHTML document
+///
+/// @param sourceFilePath  The XHTML document to take the head and body content from
+/// @param targetFilePath  The XHTML document to create
+/// @param minimumSize     The minimum size of the XHTML document to create in bytes
+///
+/// @return The flag whether the large XHTML document has been created
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+static bool createLargeDocument(const std::string& sourceFilePath, const std::string& targetFilePath, size_t minimumSize)
+{
+    std::string  errorMessage;
+    String       fileEncoding;
+    std::string  source = FormattedXhtmlDocument::readXhtmlDocumentUtf8(sourceFilePath, fileEncoding, errorMessage);
+    size_t bodyStart = source.find("<body");
+    bodyStart = (bodyStart != std::string::npos ? source.find('>', bodyStart) : bodyStart);
+    size_t bodyEnd = source.rfind("</body>");
+    if (bodyStart == std::string::npos || bodyEnd == std::string::npos || bodyEnd <= bodyStart)
+    {
+        std::cerr << "ERROR: Unable to find the body of '" << sourceFilePath << "'.\n";
+        return false;
+    }
+    bodyStart++;
+
+    std::ofstream target(targetFilePath, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!target.is_open())
+    {
+        std::cerr << "ERROR: Unable to create '" << targetFilePath << "'.\n";
+        return false;
+    }
+    size_t targetSize = bodyStart + (source.size() - bodyEnd);
+    target.write(source.data(), bodyStart);
+    while (targetSize < minimumSize)
+    {
+        target.write(source.data() + bodyStart, bodyEnd - bodyStart);
+        targetSize += bodyEnd - bodyStart;
+    }
+    target.write(source.data() + bodyEnd, source.size() - bodyEnd);
+    return target.good();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief Determines the heap memory in use (allocated and not yet released) of the current process
+///
+/// @return The heap memory in use in bytes, or 0 if not supported
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+static size_t getHeapInUse()
+{
+#if defined(TGUI_SYSTEM_LINUX) && defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+    const struct mallinfo2 heapInfo = mallinfo2();
+    return heapInfo.uordblks + heapInfo.hblkhd;
+#else
+    return 0;
+#endif
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief Compares the cold (page cache evicted) and warm (page cache filled) load times of the document loading paths
+///
+/// Additionally the heap memory, that is retained by the XHTML DOM of one load (after the source buffer is released), is
+/// measured per loading path.
+///
+/// @param filePath  The XHTML document to load
+/// @param runs      The number of runs per loading path and cache state
+///
+/// @return The application exit code
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+static int benchmarkDocumentLoad(const std::string& filePath, size_t runs)
+{
+    // Each loading path reads the file and parses it into an XHTML DOM, like FormattedXhtmlDocument::loadDocument() does.
+    std::vector<std::pair<std::string, std::function<std::vector<XhtmlElement::Ptr>()>>> loadingPaths;
+    loadingPaths.emplace_back("memory mapped, UTF-8 parser ", [&filePath]() -> std::vector<XhtmlElement::Ptr>
+        {
+            std::string errorMessage;
+            String fileEncoding;
+            MappedFile mappedFile;
+            if (!mappedFile.open(filePath, errorMessage))
+                return {};
+            CharStringView hypertextUtf8(mappedFile.getData(), mappedFile.getSize());
+            if (!FormattedXhtmlDocument::detectXhtmlDocumentEncoding(hypertextUtf8, fileEncoding, errorMessage))
+                return {};
+            return FormattedXhtmlDocument::parseXhtmlDocumentUtf8(hypertextUtf8);
+        });
+    loadingPaths.emplace_back("stream read, UTF-8 parser   ", [&filePath]() -> std::vector<XhtmlElement::Ptr>
+        {
+            std::string errorMessage;
+            String fileEncoding;
+            std::string hypertextUtf8 = FormattedXhtmlDocument::readXhtmlDocumentUtf8(filePath, fileEncoding, errorMessage);
+            return FormattedXhtmlDocument::parseXhtmlDocumentUtf8(hypertextUtf8);
+        });
+    loadingPaths.emplace_back("stream read, UTF-32 parser  ", [&filePath]() -> std::vector<XhtmlElement::Ptr>
+        {
+            std::string errorMessage;
+            String fileEncoding;
+            String hypertextString = FormattedXhtmlDocument::readXhtmlDocument(filePath, fileEncoding, errorMessage);
+            return FormattedXhtmlDocument::parseXhtmlDocument(hypertextString);
+        });
+
+    std::ifstream file(filePath, std::ios::in | std::ios::binary | std::ios::ate);
+    if (!file.is_open())
+    {
+        std::cerr << "ERROR: Unable to open '" << filePath << "'.\n";
+        return EXIT_FAILURE;
+    }
+    std::cout << "Benchmark document load of '" << filePath << "' (" << file.tellg() << " bytes, " << runs << " runs)\n";
+    file.close();
+    if (!MappedFile::isSupported())
+        std::cout << "NOTE: Memory mapped files are not supported, the 'memory mapped' path measures the failing attempt only.\n";
+    if (!evictFromPageCache(filePath))
+        std::cout << "NOTE: The page cache can not be evicted, the 'cold' load times are warm load times.\n";
+
+    for (auto& loadingPath : loadingPaths)
+    {
+        double coldMilliseconds = 0.0;
+        double warmMilliseconds = 0.0;
+        size_t rootElements = 0;
+        for (size_t run = 0; run < runs; run++)
+        {
+            evictFromPageCache(filePath);
+            auto start = std::chrono::steady_clock::now();
+            rootElements = loadingPath.second().size();
+            coldMilliseconds += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+            start = std::chrono::steady_clock::now();
+            rootElements = loadingPath.second().size();
+            warmMilliseconds += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        }
+
+        // the source buffer is released when the loading path returns, so the difference is the memory of the DOM only
+        const size_t heapBefore = getHeapInUse();
+        std::vector<XhtmlElement::Ptr> retainedRootElements = loadingPath.second();
+        const size_t heapAfter = getHeapInUse();
+        std::cout << loadingPath.first << ": cold " << coldMilliseconds / runs << " ms, warm " << warmMilliseconds / runs
+                  << " ms (" << rootElements << " root elements, ";
+        if (heapAfter > heapBefore)
+            std::cout << (heapAfter - heapBefore) / 1024 << " KiB retained)\n";
+        else
+            std::cout << "retained memory not measurable)\n";
+    }
+
+    return EXIT_SUCCESS;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief Determines the resident set size (physical memory in use) of the current process
+///
+/// @return The resident set size in bytes, or 0 if not supported
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+static size_t getResidentSetSize()
+{
+#ifdef TGUI_SYSTEM_LINUX
+    std::ifstream statm("/proc/self/statm");
+    size_t totalPages = 0;
+    size_t residentPages = 0;
+    if (statm >> totalPages >> residentPages)
+        return residentPages * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#endif
+    return 0;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief Loads the indicated document repeatedly into the same formatted document and checks the memory footprint
+///
+/// Every load replaces the previous XHTML element tree, that must be released completely. After a warm-up (10 % of the
+/// iterations) the resident set size must stay flat.
+///
+/// @param filePath    The XHTML document to load
+/// @param iterations  The number of loads
+///
+/// @return The application exit code (EXIT_FAILURE if the resident set size grows)
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+static int checkDocumentReclaim(const std::string& filePath, size_t iterations)
+{
+    const size_t tolerance = 2 * 1024 * 1024;
+    const size_t warmUpIterations = std::max<size_t>(1, iterations / 10);
+
+    auto formattedDocument = FormattedXhtmlDocument::create();
+    size_t baseline = 0;
+    for (size_t iteration = 0; iteration < iterations; iteration++)
+    {
+        if (formattedDocument->loadDocument(filePath) != 0)
+        {
+            std::cerr << "ERROR: Unable to load '" << filePath << "'.\n";
+            return EXIT_FAILURE;
+        }
+        if (iteration + 1 == warmUpIterations)
+            baseline = getResidentSetSize();
+    }
+    formattedDocument->setRootElement(nullptr);
+
+    const size_t finalSize = getResidentSetSize();
+    if (baseline == 0 || finalSize == 0)
+    {
+        std::cout << "NOTE: The resident set size can not be determined, " << iterations << " loads finished without check.\n";
+        return EXIT_SUCCESS;
+    }
+
+    std::cout << "Document reclaim check of '" << filePath << "' (" << iterations << " loads): resident set size "
+              << baseline / 1024 << " KiB after warm-up, " << finalSize / 1024 << " KiB at the end\n";
+    if (finalSize > baseline + tolerance)
+    {
+        std::cerr << "ERROR: The resident set size grows by " << (finalSize - baseline) / 1024 << " KiB, documents are not reclaimed.\n";
+        return EXIT_FAILURE;
+    }
+    std::cout << "SUCCESS: The resident set size stays flat.\n";
+    return EXIT_SUCCESS;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief Appends the structure (element types and inner texts) of an XHTML element tree to a fingerprint
+///
+/// @param element      The root of the XHTML element tree
+/// @param fingerprint  [IN/OUT] The fingerprint to append to
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+static void appendFingerprint(const XhtmlElement::Ptr& element, String& fingerprint)
+{
+    fingerprint += U'<';
+    fingerprint += element->getTypeName();
+    auto innerText = std::dynamic_pointer_cast<XhtmlInnerText>(element);
+    if (innerText)
+        fingerprint += innerText->getText();
+    auto container = std::dynamic_pointer_cast<XhtmlContainerElement>(element);
+    if (container)
+        for (size_t index = 0; index < container->countChildren(); index++)
+            appendFingerprint(container->getChild(index), fingerprint);
+    fingerprint += U'>';
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief Loads the indicated document repeatedly as a batch, first on one thread and then on a pool of worker threads,
+///        and checks that the concurrent parses produce the same XHTML DOMs and messages as the sequential parses
+///
+/// @param filePath     The XHTML document to load
+/// @param copies       The number of times the document is part of the batch
+/// @param threadCount  The number of worker threads, or 0 to use the number of hardware threads
+///
+/// @return The application exit code (EXIT_FAILURE if any concurrent result differs)
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+static int checkBatchParse(const std::string& filePath, size_t copies, unsigned int threadCount)
+{
+    std::vector<std::string> filePaths(copies, filePath);
+
+    auto start = std::chrono::steady_clock::now();
+    auto sequentialResults = FormattedXhtmlDocument::loadXhtmlDocuments(filePaths, true, 1);
+    const double sequentialMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    start = std::chrono::steady_clock::now();
+    auto concurrentResults = FormattedXhtmlDocument::loadXhtmlDocuments(filePaths, true, threadCount);
+    const double concurrentMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    if (sequentialResults.size() == 0 || sequentialResults[0].State != 0)
+    {
+        std::cerr << "ERROR: Unable to load '" << filePath << "'.\n";
+        return EXIT_FAILURE;
+    }
+
+    String expectedFingerprint;
+    for (auto& rootElement : sequentialResults[0].RootElements)
+        appendFingerprint(rootElement, expectedFingerprint);
+
+    size_t mismatches = 0;
+    for (size_t index = 0; index < copies; index++)
+    {
+        for (auto* results : { &sequentialResults, &concurrentResults })
+        {
+            String fingerprint;
+            for (auto& rootElement : (*results)[index].RootElements)
+                appendFingerprint(rootElement, fingerprint);
+            if ((*results)[index].State != 0 || fingerprint != expectedFingerprint ||
+                (*results)[index].Diagnostics.getDiagnostics().size() != sequentialResults[0].Diagnostics.getDiagnostics().size())
+                mismatches++;
+        }
+    }
+
+    std::cout << "Batch parse check of '" << filePath << "' (" << copies << " copies): sequential " << sequentialMilliseconds
+              << " ms, concurrent " << concurrentMilliseconds << " ms (" << (threadCount == 0 ? std::thread::hardware_concurrency() : threadCount)
+              << " threads)\n";
+    if (mismatches != 0)
+    {
+        std::cerr << "ERROR: " << mismatches << " results differ from the sequential parse.\n";
+        return EXIT_FAILURE;
+    }
+    std::cout << "SUCCESS: All concurrent results equal the sequential parse.\n";
+    return EXIT_SUCCESS;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief Resolves a set of entity references (as UTF-8 bytes and as UTF-32 code points) and parses documents with entity
+///        references at critical positions, and checks the results (including the resolved inner texts and attribute values)
+///
+/// @return The application exit code (EXIT_FAILURE if any entity reference resolves unexpectedly)
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+static int checkEntities()
+{
+    struct EntityCase
+    {
+        std::string  Encode;            //!< The characters to resolve (may contain '\0')
+        bool         IsAttribute;       //!< Whether the characters are part of an attribute value
+        unsigned int ExpectedLength;    //!< The expected number of processed characters, or 0 if not resolved
+        char32_t     ExpectedSubstitute; //!< The expected decoded entity
+    };
+    const std::vector<EntityCase> entityCases = {
+        { std::string("&amp;"),            false, 5, U'&'      },
+        { std::string("&amp"),             false, 4, U'&'      },
+        { std::string("&amp\0x", 6),       false, 4, U'&'      },
+        { std::string("&\0", 2),           false, 0, 0         },
+        { std::string("&not\0", 5),        false, 4, U'\u00AC' },
+        { std::string("&#x41;"),           false, 6, U'A'      },
+        { std::string("&#128;"),           false, 6, U'\u20AC' },
+        { std::string("&unknown;"),        false, 0, 0         },
+        // legacy references followed by an alphanumeric character or '=' are only kept literal within attribute values
+        { std::string("&copy2023"),        false, 5, U'\u00A9' },
+        { std::string("&copy2023"),        true,  0, 0         },
+        { std::string("&notit;"),          false, 4, U'\u00AC' },
+        { std::string("&notit;"),          true,  0, 0         },
+        { std::string("&amp=1"),           true,  0, 0         },
+        { std::string("&amp 1"),           true,  4, U'&'      },
+        { std::string("&amp;1"),           true,  5, U'&'      }
+    };
+
+    size_t failures = 0;
+    XhtmlDiagnostics diagnostics(XhtmlDiagnosticsMode::None);
+    for (const auto& entityCase : entityCases)
+    {
+        std::u32string encode32(entityCase.Encode.begin(), entityCase.Encode.end());
+        for (bool isUtf8 : {true, false})
+        {
+            char32_t substitute = 0;
+            char32_t secondSubstitute = 0;
+            const unsigned int length = (isUtf8 ?
+                XhtmlEntityResolver::resolveEntity(diagnostics, entityCase.Encode.data(), entityCase.Encode.size(), substitute, secondSubstitute,
+                                                   entityCase.IsAttribute) :
+                XhtmlEntityResolver::resolveEntity(diagnostics, encode32.data(), encode32.size(), substitute, secondSubstitute,
+                                                   entityCase.IsAttribute));
+            if (length != entityCase.ExpectedLength || (length != 0 && substitute != entityCase.ExpectedSubstitute))
+            {
+                std::cerr << "ERROR: '" << entityCase.Encode.c_str() << "' (" << (isUtf8 ? "UTF-8" : "UTF-32")
+                          << (entityCase.IsAttribute ? ", attribute" : ", text") << ") resolves to "
+                          << length << " characters, U+" << std::hex << static_cast<std::uint32_t>(substitute) << std::dec << ".\n";
+                failures++;
+            }
+        }
+    }
+
+    // entity references within documents - the parser resolves the inner text and the attribute value of the paragraph
+    struct DocumentCase
+    {
+        std::string Body;          //!< The body content of the document (may contain '\0')
+        String      ExpectedText;  //!< The expected inner text of the paragraph
+        String      ExpectedTitle; //!< The expected value of the paragraph's title attribute
+    };
+    const std::vector<DocumentCase> documentCases = {
+        { std::string("<p title=\"a &lt; b\">&quot;x&quot; &amp; y</p>"),        U"\"x\" & y",                U"a < b"       },
+        { std::string("<p title=\"&#65;&#66;\">&#169; &#8364;</p>"),             U"\u00A9 \u20AC",            U"AB"          },
+        { std::string("<p title=\"&#x41;&#X42;\">&#xA9;&#x20AC;</p>"),           U"\u00A9\u20AC",             U"AB"          },
+        { std::string("<p title=\"&copy2023 &amp\">&copy2023 &amp x &unknown;</p>"), U"\u00A92023 & x &unknown;", U"&copy2023 &" },
+        { std::string("<p title=\"&#65\">&#x41 &#169x</p>"),                     U"A \u00A9x",                U"A"           },
+        { std::string("<p>a &copy</p>"),                                         U"a \u00A9",                 U""            },
+        // a '\0' character ends the document, the entity reference in front of it is not resolved beyond it
+        { std::string("<p>&amp\0x</p>", 14),                                     U"",                         U""            },
+        { std::string("<p>&\0</p>", 10),                                         U"",                         U""            }
+    };
+
+    for (const auto& documentCase : documentCases)
+    {
+        const std::string document = "<html><body>" + documentCase.Body + "</body></html>";
+        XhtmlParser utf8Parser{CharStringView(document)};
+        XhtmlParser utf32Parser{String(document)};
+        for (XhtmlParser* parser : {&utf8Parser, &utf32Parser})
+        {
+            parser->parseDocument(true, false);
+
+            String text;
+            String title;
+            auto html = XhtmlElement::getFirstElement(parser->getRootElements(), "html");
+            auto bodies = (html != nullptr ? html->getChildren("body") : nullptr);
+            auto paragraphs = (bodies != nullptr && !bodies->empty() ? bodies->front()->getChildren("p") : nullptr);
+            if (paragraphs != nullptr && !paragraphs->empty())
+            {
+                auto paragraph = paragraphs->front();
+                auto children = paragraph->getChildren();
+                if (children != nullptr)
+                    for (const auto& child : *children)
+                        if (auto innerText = std::dynamic_pointer_cast<XhtmlInnerText>(child))
+                            text += innerText->getText();
+                if (auto titleAttribute = paragraph->getAttribute(U"title"))
+                    title = titleAttribute->getValue();
+            }
+
+            if (text != documentCase.ExpectedText || title != documentCase.ExpectedTitle)
+            {
+                std::cerr << "ERROR: '" << documentCase.Body.c_str() << "' (" << (parser == &utf8Parser ? "UTF-8" : "UTF-32")
+                          << ") resolves to the text '" << text.toStdString() << "' and the title '" << title.toStdString() << "'.\n";
+                failures++;
+            }
+        }
+    }
+
+    std::cout << "Entity check (" << entityCases.size() << " entity references, " << documentCases.size() << " documents): "
+              << failures << " failures\n";
+    return (failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief Determines the break opportunities of a set of texts, covering the supported line breaking rules, and checks the
+///        results
+///
+/// @return The application exit code (EXIT_FAILURE if any text provides unexpected break opportunities)
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+static int checkBreakOpportunities()
+{
+    struct BreakCase
+    {
+        const char*                        Description;   //!< The rule to check
+        String                             Text;          //!< The text to determine the break opportunities for
+        std::vector<XhtmlBreakOpportunity> Expected;      //!< The expected break opportunities
+    };
+    const std::vector<BreakCase> breakCases = {
+        { "space",                          U"ab cd",                    { { 2, 3, false } } },
+        { "space run",                      U"ab \t cd",                 { { 2, 5, false } } },
+        { "line break",                     U"ab\ncd",                   { { 2, 3, true } } },
+        { "hyphen within a word",           U"ab-cd",                    { { 3, 3, false } } },
+        { "hyphen before a number",         U"ab-12",                    { } },
+        { "hyphen at word start",           U"x -ab",                    { { 1, 2, false } } },
+        { "hyphen at text start",           U"-ab",                      { } },
+        { "hyphen after opening",           U"(-ab",                     { } },
+        { "OP SP*",                         U"( ab",                     { } },
+        { "SP* CL",                         U"ab  )",                    { } },
+        { "OP SP* and SP* CL",              U"x ( ab ) y",               { { 1, 2, false }, { 8, 9, false } } },
+        { "no-break space",                 U"ab\u00A0cd ef",            { { 5, 6, false } } },
+        { "narrow no-break space",          U"10\u202Fkm",               { } },
+        { "word joiner",                    U"ab\u2060cd",               { } },
+        { "soft hyphen",                    U"co\u00ADop",               { { 3, 3, false } } },
+        { "em dash",                        U"ab\u2014cd",               { { 3, 3, false } } },
+        { "CJK ideographs",                 U"\u65E5\u672C\u8A9E",       { { 1, 1, false }, { 2, 2, false } } },
+        { "CJK after Latin",                U"ab\u65E5",                 { { 2, 2, false } } },
+        { "CJK small kana",                 U"\u30C1\u30E3\u30F3",       { { 2, 2, false } } },
+        { "CJK closing punctuation",        U"\u65E5\u3002\u672C",       { { 2, 2, false } } },
+        { "CJK opening punctuation",        U"\u65E5\u300C\u672C",       { { 1, 1, false } } }
+    };
+
+    size_t failures = 0;
+    std::vector<XhtmlBreakOpportunity> opportunities;
+    for (const auto& breakCase : breakCases)
+    {
+        XhtmlInnerText::findBreakOpportunities(breakCase.Text, opportunities);
+        bool isExpected = (opportunities.size() == breakCase.Expected.size());
+        for (size_t index = 0; isExpected && index < opportunities.size(); index++)
+            isExpected = (opportunities[index].LineEnd == breakCase.Expected[index].LineEnd &&
+                          opportunities[index].NextLineStart == breakCase.Expected[index].NextLineStart &&
+                          opportunities[index].IsMandatory == breakCase.Expected[index].IsMandatory);
+        if (!isExpected)
+        {
+            std::cerr << "ERROR: " << breakCase.Description << " provides the break opportunities";
+            for (const auto& opportunity : opportunities)
+                std::cerr << " [" << opportunity.LineEnd << ", " << opportunity.NextLineStart << (opportunity.IsMandatory ? ", mandatory]" : "]");
+            std::cerr << ".\n";
+            failures++;
+        }
+    }
+
+    std::cout << "Break opportunity check (" << breakCases.size() << " texts): " << failures << " failures\n";
+    return (failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief Measures the parse time of the inline styles (the values of all style="..." attributes) of the indicated document
+///
+/// @param filePath  The XHTML document to take the inline styles from
+/// @param runs      The number of runs over all inline styles
+///
+/// @return The application exit code
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+static int benchmarkInlineStyles(const std::string& filePath, size_t runs)
+{
+    std::string errorMessage;
+    String      fileEncoding;
+    String      hypertext = FormattedXhtmlDocument::readXhtmlDocument(filePath, fileEncoding, errorMessage);
+    if (hypertext.empty())
+    {
+        std::cerr << "ERROR: Unable to read '" << filePath << "'. " << errorMessage << "\n";
+        return EXIT_FAILURE;
+    }
+
+    // collect the corpus of raw (not yet normalized) inline style values
+    std::vector<String> styles;
+    for (size_t position = hypertext.find(U"style=\""); position != String::npos; position = hypertext.find(U"style=\"", position))
+    {
+        position += 7;
+        const size_t endPosition = hypertext.find(U'\"', position);
+        if (endPosition == String::npos)
+            break;
+        if (endPosition > position)
+            styles.push_back(hypertext.substr(position, endPosition - position));
+        position = endPosition + 1;
+    }
+    if (styles.empty())
+    {
+        std::cerr << "ERROR: '" << filePath << "' contains no inline styles.\n";
+        return EXIT_FAILURE;
+    }
+
+    size_t appliedProperties = 0;
+    XhtmlDiagnostics diagnostics(XhtmlDiagnosticsMode::None);
+    auto start = std::chrono::steady_clock::now();
+    for (size_t run = 0; run < runs; run++)
+    {
+        for (const auto& style : styles)
+        {
+            XhtmlStyleEntry styleEntry;
+            styleEntry.putValue(diagnostics, style);
+            appliedProperties += (styleEntry.getStyleEntryFlags() != StyleEntryFlags::None ? 1 : 0);
+        }
+    }
+    const double milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << "Benchmark inline styles of '" << filePath << "' (" << styles.size() << " styles, " << runs << " runs): "
+              << milliseconds << " ms, " << (milliseconds * 1000000.0) / static_cast<double>(styles.size() * runs)
+              << " ns per style (" << appliedProperties / runs << " styles with properties)\n";
+    return EXIT_SUCCESS;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief Measures the resize latency of a formatted text view, that displays the indicated document
+///
+/// @param gui       The GUI to add the formatted text view to (text can only be measured with an initialized backend)
+/// @param filePath  The XHTML document to display
+/// @param steps     The number of resize steps per dimension
+///
+/// @return The application exit code
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+static int benchmarkResize(Gui& gui, const std::string& filePath, size_t steps)
+{
+    auto formattedDocument = FormattedXhtmlDocument::create();
+    if (formattedDocument->loadDocument(filePath, false) != 0)
+    {
+        std::cerr << "ERROR: Unable to load '" << filePath << "'.\n";
+        return EXIT_FAILURE;
+    }
+    auto formattedTextView = FormattedTextView::create();
+    formattedTextView->setDocument(formattedDocument);
+    gui.add(formattedTextView, "BenchmarkResize");
+
+    auto start = std::chrono::steady_clock::now();
+    formattedTextView->setSize(960, 600);
+    const double initialMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "Benchmark resize of '" << filePath << "' (" << formattedDocument->getContent().size() << " formatted elements): "
+              << "initial layout " << initialMilliseconds << " ms\n";
+
+    // drag the right or the bottom window border back and forth, like a user does
+    for (bool changeWidth : {true, false})
+    {
+        double totalMilliseconds = 0.0;
+        double maximumMilliseconds = 0.0;
+        for (size_t step = 1; step <= steps; step++)
+        {
+            const float offset = static_cast<float>(step % 32) * 10.0f;
+            start = std::chrono::steady_clock::now();
+            formattedTextView->setSize(changeWidth ? 960.0f - offset : 960.0f, changeWidth ? 600.0f : 600.0f - offset);
+            const double milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            totalMilliseconds += milliseconds;
+            maximumMilliseconds = std::max(maximumMilliseconds, milliseconds);
+        }
+        std::cout << "  " << (changeWidth ? "width " : "height") << " changes (" << steps << " steps): "
+                  << totalMilliseconds / static_cast<double>(steps) << " ms average, " << maximumMilliseconds << " ms maximum latency\n";
+    }
+
+    gui.remove(formattedTextView);
+    return EXIT_SUCCESS;
+}
+
 // Run main(int, char**) instead main() to be able to debug in Code::Blocks.
 int main(int argc, char** argv)
 {
-    UNUSED(argc);
-    UNUSED(argv);
+    // Section 0: Command line tools (don't need a window).
+    // --benchmark-load <file> [<runs> [<minimum size in MB>]]
+    //   Compare cold and warm load times. If a minimum size is given, a large document is created from the body of <file>.
+    if (argc >= 3 && std::string(argv[1]) == "--benchmark-load")
+    {
+        std::string filePath(argv[2]);
+        size_t runs = (argc >= 4 ? std::max(1ul, std::stoul(argv[3])) : 5);
+        if (argc >= 5)
+        {
+            std::string largeFilePath = filePath + ".large.htm";
+            if (!createLargeDocument(filePath, largeFilePath, std::stoul(argv[4]) * 1024 * 1024))
+                return EXIT_FAILURE;
+            filePath = largeFilePath;
+        }
+        return benchmarkDocumentLoad(filePath, runs);
+    }
+    // --reclaim-check <file> [<iterations>]
+    //   Load <file> repeatedly (default 1000 times) and fail, if the resident set size doesn't stay flat.
+    if (argc >= 3 && std::string(argv[1]) == "--reclaim-check")
+        return checkDocumentReclaim(argv[2], (argc >= 4 ? std::max(1ul, std::stoul(argv[3])) : 1000));
+    // --batch-check <file> [<copies> [<threads>]]
+    //   Load <file> as a batch of copies (default 300) sequentially and concurrently and fail, if any result differs.
+    if (argc >= 3 && std::string(argv[1]) == "--batch-check")
+        return checkBatchParse(argv[2], (argc >= 4 ? std::max(1ul, std::stoul(argv[3])) : 300),
+                               (argc >= 5 ? static_cast<unsigned int>(std::stoul(argv[4])) : 0));
+    // --entity-check
+    //   Resolve a set of entity references, including the critical ones at a '\0' character, and fail on unexpected results.
+    if (argc >= 2 && std::string(argv[1]) == "--entity-check")
+        return checkEntities();
+    // --break-check
+    //   Determine the break opportunities of a set of texts (hyphens, punctuation, no-break spaces, CJK) and fail on unexpected results.
+    if (argc >= 2 && std::string(argv[1]) == "--break-check")
+        return checkBreakOpportunities();
+    // --benchmark-styles <file> [<runs>]
+    //   Parse the values of all style="..." attributes of <file> repeatedly (default 10000 runs) and report the time per style.
+    if (argc >= 3 && std::string(argv[1]) == "--benchmark-styles")
+        return benchmarkInlineStyles(argv[2], (argc >= 4 ? std::max(1ul, std::stoul(argv[3])) : 10000));
 
     // Section 1: Native window creation.
 #ifdef TGUI_HAS_BACKEND_SFML_GRAPHICS
@@ -643,6 +1280,22 @@ int main(int argc, char** argv)
         Theme::setDefault(themeFilePath);
     auto container = gui.getContainer();
 
+    // --benchmark-resize <file> [<steps> [<minimum size in MB>]]
+    //   Resize a view of <file> (default 100 steps per dimension) and report the latency. If a minimum size is given, a large
+    //   document is created from the body of <file> (e.g. 2 MB for a manual with about 200 pages).
+    if (argc >= 3 && std::string(argv[1]) == "--benchmark-resize")
+    {
+        std::string filePath(argv[2]);
+        if (argc >= 5)
+        {
+            std::string largeFilePath = filePath + ".large.htm";
+            if (!createLargeDocument(filePath, largeFilePath, std::stoul(argv[4]) * 1024 * 1024))
+                return EXIT_FAILURE;
+            filePath = largeFilePath;
+        }
+        return benchmarkResize(gui, filePath, (argc >= 4 ? std::max(1ul, std::stoul(argv[3])) : 100));
+    }
+
     // Section 2: Sample application.
     XHTMLViewerMainForm mainForm(window, gui);
     if (!mainForm.createFrameContent())
@@ -1,4 +1,6 @@
 #include <algorithm>
+#include <atomic>
+#include <cmath>
 #include <cstdint>
 
 #include <TGUI/Config.hpp>
@@ -17,160 +19,531 @@
 #endif
 
 #include "TGUI/Xhtml/StringHelper.hpp"
+#include "TGUI/Xhtml/PerfectHashTable.hpp"
 #include "TGUI/Xhtml/Dom/XhtmlAttributes.hpp"
 
 namespace tgui  { namespace xhtml
 {
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    /// @brief The list of known web color names mapped to their color value
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    std::map<tgui::String, tgui::String> WebColorMap = {
-        {  U"maroon"                ,	U"#800000"   },
-        {  U"darkred"               ,	U"#8B0000"   },
-        {  U"brown"                 ,	U"#A52A2A"   },
-        {  U"firebrick"             ,	U"#B22222"   },
-        {  U"crimson"               ,	U"#DC143C"   },
-        {  U"red"                   ,	U"#FF0000"   },
-        {  U"tomato"                ,	U"#FF6347"   },
-        {  U"coral"                 ,	U"#FF7F50"   },
-        {  U"indianred"             ,	U"#CD5C5C"   },
-        {  U"lightcoral"            ,	U"#F08080"   },
-        {  U"darksalmon"            ,	U"#E9967A"   },
-        {  U"salmon"                ,	U"#FA8072"   },
-        {  U"lightsalmon"           ,	U"#FFA07A"   },
-        {  U"orangered"             ,	U"#FF4500"   },
-        {  U"darkorange"            ,	U"#FF8C00"   },
-        {  U"orange"                ,	U"#FFA500"   },
-        {  U"gold"                  ,	U"#FFD700"   },
-        {  U"darkgoldenrod"         ,	U"#B8860B"   },
-        {  U"goldenrod"             ,	U"#DAA520"   },
-        {  U"palegoldenrod"         ,	U"#EEE8AA"   },
-        {  U"darkkhaki"             ,	U"#BDB76B"   },
-        {  U"khaki"                 ,	U"#F0E68C"   },
-        {  U"olive"                 ,	U"#808000"   },
-        {  U"yellow"                ,	U"#FFFF00"   },
-        {  U"yellowgreen"           ,	U"#9ACD32"   },
-        {  U"darkolivegreen"        ,	U"#556B2F"   },
-        {  U"olivedrab"             ,	U"#6B8E23"   },
-        {  U"lawngreen"             ,	U"#7CFC00"   },
-        {  U"chartreuse"            ,	U"#7FFF00"   },
-        {  U"greenyellow"           ,	U"#ADFF2F"   },
-        {  U"darkgreen"             ,	U"#006400"   },
-        {  U"green"                 ,	U"#008000"   },
-        {  U"forestgreen"           ,	U"#228B22"   },
-        {  U"lime"                  ,	U"#00FF00"   },
-        {  U"limegreen"             ,	U"#32CD32"   },
-        {  U"lightgreen"            ,	U"#90EE90"   },
-        {  U"palegreen"             ,	U"#98FB98"   },
-        {  U"darkseagreen"          ,	U"#8FBC8F"   },
-        {  U"mediumspringgreen"     ,	U"#00FA9A"   },
-        {  U"springgreen"           ,	U"#00FF7F"   },
-        {  U"seagreen"              ,	U"#2E8B57"   },
-        {  U"mediumaquamarine"      ,	U"#66CDAA"   },
-        {  U"mediumseagreen"        ,	U"#3CB371"   },
-        {  U"lightseagreen"         ,	U"#20B2AA"   },
-        {  U"darkslategray"         ,	U"#2F4F4F"   },
-        {  U"teal"                  ,	U"#008080"   },
-        {  U"darkcyan"              ,	U"#008B8B"   },
-        {  U"aqua"                  ,	U"#00FFFF"   },
-        {  U"cyan"                  ,	U"#00FFFF"   },
-        {  U"lightcyan"             ,	U"#E0FFFF"   },
-        {  U"darkturquoise"         ,	U"#00CED1"   },
-        {  U"turquoise"             ,	U"#40E0D0"   },
-        {  U"mediumturquoise"       ,	U"#48D1CC"   },
-        {  U"paleturquoise"         ,	U"#AFEEEE"   },
-        {  U"aquamarine"            ,	U"#7FFFD4"   },
-        {  U"powderblue"            ,	U"#B0E0E6"   },
-        {  U"cadetblue"             ,	U"#5F9EA0"   },
-        {  U"steelblue"             ,	U"#4682B4"   },
-        {  U"cornflowerblue"        ,	U"#6495ED"   },
-        {  U"deepskyblue"           ,	U"#00BFFF"   },
-        {  U"dodgerblue"            ,	U"#1E90FF"   },
-        {  U"lightblue"             ,	U"#ADD8E6"   },
-        {  U"skyblue"               ,	U"#87CEEB"   },
-        {  U"lightskyblue"          ,	U"#87CEFA"   },
-        {  U"midnightblue"          ,	U"#191970"   },
-        {  U"navy"                  ,	U"#000080"   },
-        {  U"darkblue"              ,	U"#00008B"   },
-        {  U"mediumblue"            ,	U"#0000CD"   },
-        {  U"blue"                  ,	U"#0000FF"   },
-        {  U"royalblue"             ,	U"#4169E1"   },
-        {  U"blueviolet"            ,	U"#8A2BE2"   },
-        {  U"indigo"                ,	U"#4B0082"   },
-        {  U"darkslateblue"         ,	U"#483D8B"   },
-        {  U"slateblue"             ,	U"#6A5ACD"   },
-        {  U"mediumslateblue"       ,	U"#7B68EE"   },
-        {  U"mediumpurple"          ,	U"#9370DB"   },
-        {  U"darkmagenta"           ,	U"#8B008B"   },
-        {  U"darkviolet"            ,	U"#9400D3"   },
-        {  U"darkorchid"            ,	U"#9932CC"   },
-        {  U"mediumorchid"          ,	U"#BA55D3"   },
-        {  U"purple"                ,	U"#800080"   },
-        {  U"thistle"               ,	U"#D8BFD8"   },
-        {  U"plum"                  ,	U"#DDA0DD"   },
-        {  U"violet"                ,	U"#EE82EE"   },
-        {  U"fuchsia"               ,	U"#FF00FF"   },
-        {  U"orchid"                ,	U"#DA70D6"   },
-        {  U"mediumvioletred"       ,	U"#C71585"   },
-        {  U"palevioletred"         ,	U"#DB7093"   },
-        {  U"deeppink"              ,	U"#FF1493"   },
-        {  U"hotpink"               ,	U"#FF69B4"   },
-        {  U"lightpink"             ,	U"#FFB6C1"   },
-        {  U"pink"                  ,	U"#FFC0CB"   },
-        {  U"antiquewhite"          ,	U"#FAEBD7"   },
-        {  U"beige"                 ,	U"#F5F5DC"   },
-        {  U"bisque"                ,	U"#FFE4C4"   },
-        {  U"blanchedalmond"        ,	U"#FFEBCD"   },
-        {  U"wheat"                 ,	U"#F5DEB3"   },
-        {  U"cornsilk"              ,	U"#FFF8DC"   },
-        {  U"lemonchiffon"          ,	U"#FFFACD"   },
-        {  U"lightgoldenrodyellow"  ,	U"#FAFAD2"   },
-        {  U"lightyellow"           ,	U"#FFFFE0"   },
-        {  U"saddlebrown"           ,	U"#8B4513"   },
-        {  U"sienna"                ,	U"#A0522D"   },
-        {  U"chocolate"             ,	U"#D2691E"   },
-        {  U"peru"                  ,	U"#CD853F"   },
-        {  U"sandybrown"            ,	U"#F4A460"   },
-        {  U"burlywood"             ,	U"#DEB887"   },
-        {  U"tan"                   ,	U"#D2B48C"   },
-        {  U"rosybrown"             ,	U"#BC8F8F"   },
-        {  U"moccasin"              ,	U"#FFE4B5"   },
-        {  U"navajowhite"           ,	U"#FFDEAD"   },
-        {  U"peachpuff"             ,	U"#FFDAB9"   },
-        {  U"mistyrose"             ,	U"#FFE4E1"   },
-        {  U"lavenderblush"         ,	U"#FFF0F5"   },
-        {  U"linen"                 ,	U"#FAF0E6"   },
-        {  U"oldlace"               ,	U"#FDF5E6"   },
-        {  U"papayawhip"            ,	U"#FFEFD5"   },
-        {  U"seashell"              ,	U"#FFF5EE"   },
-        {  U"mintcream"             ,	U"#F5FFFA"   },
-        {  U"slategray"             ,	U"#708090"   },
-        {  U"lightslategray"        ,	U"#778899"   },
-        {  U"lightsteelblue"        ,	U"#B0C4DE"   },
-        {  U"lavender"              ,	U"#E6E6FA"   },
-        {  U"floralwhite"           ,	U"#FFFAF0"   },
-        {  U"aliceblue"             ,	U"#F0F8FF"   },
-        {  U"ghostwhite"            ,	U"#F8F8FF"   },
-        {  U"honeydew"              ,	U"#F0FFF0"   },
-        {  U"ivory"                 ,	U"#FFFFF0"   },
-        {  U"azure"                 ,	U"#F0FFFF"   },
-        {  U"snow"                  ,	U"#FFFAFA"   },
-        {  U"black"                 ,	U"#000000"   },
-        {  U"dimgray"               ,	U"#696969"   },
-        {  U"gray"                  ,	U"#808080"   },
-        {  U"darkgray"              ,	U"#A9A9A9"   },
-        {  U"silver"                ,	U"#C0C0C0"   },
-        {  U"lightgray"             ,	U"#D3D3D3"   },
-        {  U"gainsboro"             ,	U"#DCDCDC"   },
-        {  U"whitesmoke"            ,	U"#F5F5F5"   },
-        {  U"white"                 ,	U"#FFFFFF"   }
-    };
+    namespace
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief The list of known web color names mapped to their color value (0xRRGGBB)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        constexpr PerfectHashEntry<std::uint32_t> WebColorEntries[] =
+        {
+            {   "maroon",                0x800000   },
+            {   "darkred",               0x8B0000   },
+            {   "brown",                 0xA52A2A   },
+            {   "firebrick",             0xB22222   },
+            {   "crimson",               0xDC143C   },
+            {   "red",                   0xFF0000   },
+            {   "tomato",                0xFF6347   },
+            {   "coral",                 0xFF7F50   },
+            {   "indianred",             0xCD5C5C   },
+            {   "lightcoral",            0xF08080   },
+            {   "darksalmon",            0xE9967A   },
+            {   "salmon",                0xFA8072   },
+            {   "lightsalmon",           0xFFA07A   },
+            {   "orangered",             0xFF4500   },
+            {   "darkorange",            0xFF8C00   },
+            {   "orange",                0xFFA500   },
+            {   "gold",                  0xFFD700   },
+            {   "darkgoldenrod",         0xB8860B   },
+            {   "goldenrod",             0xDAA520   },
+            {   "palegoldenrod",         0xEEE8AA   },
+            {   "darkkhaki",             0xBDB76B   },
+            {   "khaki",                 0xF0E68C   },
+            {   "olive",                 0x808000   },
+            {   "yellow",                0xFFFF00   },
+            {   "yellowgreen",           0x9ACD32   },
+            {   "darkolivegreen",        0x556B2F   },
+            {   "olivedrab",             0x6B8E23   },
+            {   "lawngreen",             0x7CFC00   },
+            {   "chartreuse",            0x7FFF00   },
+            {   "greenyellow",           0xADFF2F   },
+            {   "darkgreen",             0x006400   },
+            {   "green",                 0x008000   },
+            {   "forestgreen",           0x228B22   },
+            {   "lime",                  0x00FF00   },
+            {   "limegreen",             0x32CD32   },
+            {   "lightgreen",            0x90EE90   },
+            {   "palegreen",             0x98FB98   },
+            {   "darkseagreen",          0x8FBC8F   },
+            {   "mediumspringgreen",     0x00FA9A   },
+            {   "springgreen",           0x00FF7F   },
+            {   "seagreen",              0x2E8B57   },
+            {   "mediumaquamarine",      0x66CDAA   },
+            {   "mediumseagreen",        0x3CB371   },
+            {   "lightseagreen",         0x20B2AA   },
+            {   "darkslategray",         0x2F4F4F   },
+            {   "teal",                  0x008080   },
+            {   "darkcyan",              0x008B8B   },
+            {   "aqua",                  0x00FFFF   },
+            {   "cyan",                  0x00FFFF   },
+            {   "lightcyan",             0xE0FFFF   },
+            {   "darkturquoise",         0x00CED1   },
+            {   "turquoise",             0x40E0D0   },
+            {   "mediumturquoise",       0x48D1CC   },
+            {   "paleturquoise",         0xAFEEEE   },
+            {   "aquamarine",            0x7FFFD4   },
+            {   "powderblue",            0xB0E0E6   },
+            {   "cadetblue",             0x5F9EA0   },
+            {   "steelblue",             0x4682B4   },
+            {   "cornflowerblue",        0x6495ED   },
+            {   "deepskyblue",           0x00BFFF   },
+            {   "dodgerblue",            0x1E90FF   },
+            {   "lightblue",             0xADD8E6   },
+            {   "skyblue",               0x87CEEB   },
+            {   "lightskyblue",          0x87CEFA   },
+            {   "midnightblue",          0x191970   },
+            {   "navy",                  0x000080   },
+            {   "darkblue",              0x00008B   },
+            {   "mediumblue",            0x0000CD   },
+            {   "blue",                  0x0000FF   },
+            {   "royalblue",             0x4169E1   },
+            {   "blueviolet",            0x8A2BE2   },
+            {   "indigo",                0x4B0082   },
+            {   "darkslateblue",         0x483D8B   },
+            {   "slateblue",             0x6A5ACD   },
+            {   "mediumslateblue",       0x7B68EE   },
+            {   "mediumpurple",          0x9370DB   },
+            {   "darkmagenta",           0x8B008B   },
+            {   "darkviolet",            0x9400D3   },
+            {   "darkorchid",            0x9932CC   },
+            {   "mediumorchid",          0xBA55D3   },
+            {   "purple",                0x800080   },
+            {   "thistle",               0xD8BFD8   },
+            {   "plum",                  0xDDA0DD   },
+            {   "violet",                0xEE82EE   },
+            {   "fuchsia",               0xFF00FF   },
+            {   "orchid",                0xDA70D6   },
+            {   "mediumvioletred",       0xC71585   },
+            {   "palevioletred",         0xDB7093   },
+            {   "deeppink",              0xFF1493   },
+            {   "hotpink",               0xFF69B4   },
+            {   "lightpink",             0xFFB6C1   },
+            {   "pink",                  0xFFC0CB   },
+            {   "antiquewhite",          0xFAEBD7   },
+            {   "beige",                 0xF5F5DC   },
+            {   "bisque",                0xFFE4C4   },
+            {   "blanchedalmond",        0xFFEBCD   },
+            {   "wheat",                 0xF5DEB3   },
+            {   "cornsilk",              0xFFF8DC   },
+            {   "lemonchiffon",          0xFFFACD   },
+            {   "lightgoldenrodyellow",  0xFAFAD2   },
+            {   "lightyellow",           0xFFFFE0   },
+            {   "saddlebrown",           0x8B4513   },
+            {   "sienna",                0xA0522D   },
+            {   "chocolate",             0xD2691E   },
+            {   "peru",                  0xCD853F   },
+            {   "sandybrown",            0xF4A460   },
+            {   "burlywood",             0xDEB887   },
+            {   "tan",                   0xD2B48C   },
+            {   "rosybrown",             0xBC8F8F   },
+            {   "moccasin",              0xFFE4B5   },
+            {   "navajowhite",           0xFFDEAD   },
+            {   "peachpuff",             0xFFDAB9   },
+            {   "mistyrose",             0xFFE4E1   },
+            {   "lavenderblush",         0xFFF0F5   },
+            {   "linen",                 0xFAF0E6   },
+            {   "oldlace",               0xFDF5E6   },
+            {   "papayawhip",            0xFFEFD5   },
+            {   "seashell",              0xFFF5EE   },
+            {   "mintcream",             0xF5FFFA   },
+            {   "slategray",             0x708090   },
+            {   "lightslategray",        0x778899   },
+            {   "lightsteelblue",        0xB0C4DE   },
+            {   "lavender",              0xE6E6FA   },
+            {   "floralwhite",           0xFFFAF0   },
+            {   "aliceblue",             0xF0F8FF   },
+            {   "ghostwhite",            0xF8F8FF   },
+            {   "honeydew",              0xF0FFF0   },
+            {   "ivory",                 0xFFFFF0   },
+            {   "azure",                 0xF0FFFF   },
+            {   "snow",                  0xFFFAFA   },
+            {   "black",                 0x000000   },
+            {   "dimgray",               0x696969   },
+            {   "gray",                  0x808080   },
+            {   "darkgray",              0xA9A9A9   },
+            {   "silver",                0xC0C0C0   },
+            {   "lightgray",             0xD3D3D3   },
+            {   "gainsboro",             0xDCDCDC   },
+            {   "whitesmoke",            0xF5F5F5   },
+            {   "white",                 0xFFFFFF   }
+        };
+
+        /// @brief The web colors by (case insensitive) name, built at compile time
+        /// Building the web colors and the CSS properties hash tables takes up to 1M constant evaluation operations (GCC counts),
+        /// above the MSVC default budget - TGUI-XHTML.vcxproj raises it with /constexpr:steps (the GCC default suffices).
+        constexpr auto WebColors = createPerfectHashTable(WebColorEntries, true);
+        static_assert(WebColors.isValid(), "The web color names must be unique!");
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief The enumeration of CSS properties, that are applied by a style entry
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        enum class StyleProperty : std::uint8_t
+        {
+            Opacity,         //!< The 'opacity' property
+            BackgroundColor, //!< The 'background' or 'background-color' property
+            Color,           //!< The 'color' property
+            BorderColor,     //!< The 'border-color' property
+            FontStyle,       //!< The 'font-style' property
+            FontWeight,      //!< The 'font-weight' property
+            BorderStyle,     //!< The 'border-style' property
+            BorderWidth,     //!< The 'border-width' property
+            Border,          //!< The 'border' shorthand property
+            Margin,          //!< The 'margin' shorthand property
+            MarginTop,       //!< The 'margin-top' property
+            MarginRight,     //!< The 'margin-right' property
+            MarginBottom,    //!< The 'margin-bottom' property
+            MarginLeft,      //!< The 'margin-left' property
+            Padding,         //!< The 'padding' shorthand property
+            PaddingTop,      //!< The 'padding-top' property
+            PaddingRight,    //!< The 'padding-right' property
+            PaddingBottom,   //!< The 'padding-bottom' property
+            PaddingLeft,     //!< The 'padding-left' property
+            Height,          //!< The 'height' property
+            Width            //!< The 'width' property
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief The list of supported CSS property names mapped to their property
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        constexpr PerfectHashEntry<StyleProperty> StylePropertyEntries[] =
+        {
+            {   "opacity",               StyleProperty::Opacity           },
+            {   "background",            StyleProperty::BackgroundColor   },
+            {   "background-color",      StyleProperty::BackgroundColor   },
+            {   "color",                 StyleProperty::Color             },
+            {   "border-color",          StyleProperty::BorderColor       },
+            {   "font-style",            StyleProperty::FontStyle         },
+            {   "font-weight",           StyleProperty::FontWeight        },
+            {   "border-style",          StyleProperty::BorderStyle       },
+            {   "border-width",          StyleProperty::BorderWidth       },
+            {   "border",                StyleProperty::Border            },
+            {   "margin",                StyleProperty::Margin            },
+            {   "margin-top",            StyleProperty::MarginTop         },
+            {   "margin-right",          StyleProperty::MarginRight       },
+            {   "margin-bottom",         StyleProperty::MarginBottom      },
+            {   "margin-left",           StyleProperty::MarginLeft        },
+            {   "padding",               StyleProperty::Padding           },
+            {   "padding-top",           StyleProperty::PaddingTop        },
+            {   "padding-right",         StyleProperty::PaddingRight      },
+            {   "padding-bottom",        StyleProperty::PaddingBottom     },
+            {   "padding-left",          StyleProperty::PaddingLeft       },
+            {   "height",                StyleProperty::Height            },
+            {   "width",                 StyleProperty::Width             }
+        };
+
+        /// @brief The CSS properties by (case insensitive) name, built at compile time
+        constexpr auto StyleProperties = createPerfectHashTable(StylePropertyEntries, true);
+        static_assert(StyleProperties.isValid(), "The CSS property names must be unique!");
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief The list of CSS border style names mapped to their border style
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        constexpr PerfectHashEntry<BorderStyle> BorderStyleEntries[] =
+        {
+            {   "none",                  BorderStyle::None                },
+            {   "hidden",                BorderStyle::Hidden              },
+            {   "dotted",                BorderStyle::Dotted              },
+            {   "dashed",                BorderStyle::Dashed              },
+            {   "solid",                 BorderStyle::Solid               },
+            {   "double",                BorderStyle::Double              },
+            {   "groove",                BorderStyle::Groove              },
+            {   "ridge",                 BorderStyle::Ridge               },
+            {   "inset",                 BorderStyle::Inset               },
+            {   "outset",                BorderStyle::Outset              }
+        };
+
+        /// @brief The CSS border styles by (case insensitive) name, built at compile time
+        constexpr auto BorderStyles = createPerfectHashTable(BorderStyleEntries, true);
+        static_assert(BorderStyles.isValid(), "The CSS border style names must be unique!");
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief A span of characters within a style value, that is not owned
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct CssSpan
+        {
+            const char32_t* Data;   //!< The first character of the span
+            size_t          Length; //!< The number of characters of the span
+        };
+
+        /// @brief The maximum number of words, a CSS value is split into (one more than any property accepts)
+        constexpr size_t MaxCssWords = 5;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes the leading and trailing white-space characters from the indicated span
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        CssSpan trimCssSpan(CssSpan span)
+        {
+            while (span.Length > 0 && tgui::isWhitespace(span.Data[0]))
+            {
+                span.Data++;
+                span.Length--;
+            }
+            while (span.Length > 0 && tgui::isWhitespace(span.Data[span.Length - 1]))
+                span.Length--;
+            return span;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Maps upper case ASCII letters to lower case
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        inline char32_t foldCase(char32_t character)
+        {   return (character >= U'A' && character <= U'Z' ? character + (U'a' - U'A') : character);   }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Determines whether the span contains the (lower case ASCII) pattern, ignoring the case of ASCII letters
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool containsIgnoreCase(CssSpan span, const char* pattern)
+        {
+            size_t patternLength = 0;
+            while (pattern[patternLength] != '\0')
+                patternLength++;
+
+            for (size_t position = 0; position + patternLength <= span.Length; position++)
+            {
+                size_t index = 0;
+                while (index < patternLength && foldCase(span.Data[position + index]) == static_cast<char32_t>(pattern[index]))
+                    index++;
+                if (index == patternLength)
+                    return true;
+            }
+            return false;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Splits the span at white-space characters into words, skipping empty words
+        ///
+        /// @return The number of words, at most MaxCssWords are stored and counted
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        size_t splitCssWords(CssSpan span, CssSpan (&words)[MaxCssWords])
+        {
+            size_t wordCount = 0;
+            size_t position = 0;
+            while (wordCount < MaxCssWords)
+            {
+                while (position < span.Length && tgui::isWhitespace(span.Data[position]))
+                    position++;
+                if (position >= span.Length)
+                    break;
+
+                const size_t wordBegin = position;
+                while (position < span.Length && !tgui::isWhitespace(span.Data[position]))
+                    position++;
+                words[wordCount++] = { span.Data + wordBegin, position - wordBegin };
+            }
+            return wordCount;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Parses the leading decimal number of the span (like strtof(), but locale independent), 0 if there is none
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float parseCssNumber(CssSpan span)
+        {
+            size_t position = 0;
+            while (position < span.Length && tgui::isWhitespace(span.Data[position]))
+                position++;
+
+            bool isNegative = false;
+            if (position < span.Length && (span.Data[position] == U'-' || span.Data[position] == U'+'))
+                isNegative = (span.Data[position++] == U'-');
+
+            // up to 18 significant digits are exact in a 64 bit mantissa, more digits only change the exponent
+            std::uint64_t mantissa = 0;
+            int           significantDigits = 0;
+            int           exponent = 0;
+            bool          hasDigits = false;
+            for (bool isFraction = false; position < span.Length; position++)
+            {
+                const char32_t character = span.Data[position];
+                if (character == U'.' && !isFraction)
+                {
+                    isFraction = true;
+                    continue;
+                }
+                if (character < U'0' || character > U'9')
+                    break;
+
+                hasDigits = true;
+                if (significantDigits < 18)
+                {
+                    if (mantissa != 0 || character != U'0')
+                        significantDigits++;
+                    mantissa = mantissa * 10 + static_cast<std::uint64_t>(character - U'0');
+                    exponent -= (isFraction ? 1 : 0);
+                }
+                else
+                    exponent += (isFraction ? 0 : 1);
+            }
+            if (!hasDigits)
+                return 0.0f;
+
+            // the exponent part is taken only, if it contains digits (e.g. '1em' is 1 followed by the unit 'em')
+            if (position + 1 < span.Length && (span.Data[position] == U'e' || span.Data[position] == U'E'))
+            {
+                size_t exponentPosition = position + 1;
+                bool   isNegativeExponent = false;
+                if (span.Data[exponentPosition] == U'-' || span.Data[exponentPosition] == U'+')
+                    isNegativeExponent = (span.Data[exponentPosition++] == U'-');
+                if (exponentPosition < span.Length && span.Data[exponentPosition] >= U'0' && span.Data[exponentPosition] <= U'9')
+                {
+                    int exponentValue = 0;
+                    for (; exponentPosition < span.Length && span.Data[exponentPosition] >= U'0' && span.Data[exponentPosition] <= U'9'; exponentPosition++)
+                        exponentValue = std::min(exponentValue * 10 + static_cast<int>(span.Data[exponentPosition] - U'0'), 1000);
+                    exponent += (isNegativeExponent ? -exponentValue : exponentValue);
+                }
+            }
+
+            // dividing by an exact power of 10 keeps the result correctly rounded for all usual CSS values
+            double value = static_cast<double>(mantissa);
+            if (exponent < 0)
+                value /= std::pow(10.0, -exponent);
+            else if (exponent > 0)
+                value *= std::pow(10.0, exponent);
+            return static_cast<float>(isNegative ? -value : value);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Parses a CSS length value, optionally accepting the border width keywords 'thin', 'medium' and 'thick'
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float parseCssLength(CssSpan word, bool acceptBorderWidthKeywords, SizeType& sizeType)
+        {
+            if (acceptBorderWidthKeywords)
+            {
+                const float keywordWidth = (containsIgnoreCase(word, "thin")   ? 1.0f :
+                                           (containsIgnoreCase(word, "medium") ? 3.0f :
+                                           (containsIgnoreCase(word, "thick")  ? 5.0f : 0.0f)));
+                if (keywordWidth > 0.0f)
+                {
+                    sizeType = SizeType::Pixel;
+                    return keywordWidth;
+                }
+            }
+
+            sizeType = FourDimSize::determineSizeType(word.Data, word.Length);
+            return parseCssNumber(word);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Parses one to four CSS lengths (top, right, bottom, left - like FourDimSize::parse()), the size type is
+        ///        taken from the first length
+        ///
+        /// @return The flag whether the value consists of one to four lengths, otherwise the size remains unchanged
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool parseCssFourDimSize(CssSpan value, bool acceptBorderWidthKeywords, FourDimSize& size)
+        {
+            CssSpan      words[MaxCssWords];
+            const size_t wordCount = splitCssWords(value, words);
+            if (wordCount < 1 || wordCount > 4)
+                return false;
+
+            SizeType sizeTypes[4] = {};
+            float    lengths[4] = {};
+            for (size_t index = 0; index < wordCount; index++)
+                lengths[index] = parseCssLength(words[index], acceptBorderWidthKeywords, sizeTypes[index]);
+
+            size.sizeType = sizeTypes[0];
+            size.top      = lengths[0];
+            size.right    = (wordCount >= 2 ? lengths[1] : lengths[0]);
+            size.bottom   = (wordCount >= 3 ? lengths[2] : lengths[0]);
+            size.left     = (wordCount == 4 ? lengths[3] : size.right);
+            return true;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Parses one to four CSS border styles (top, right, bottom, left - like FourDimBorderStyle::tryParse())
+        ///
+        /// @return The flag whether all border styles are recognized, otherwise the border style remains unchanged
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool tryParseCssBorderStyle(CssSpan value, FourDimBorderStyle& borderStyle)
+        {
+            CssSpan      words[MaxCssWords];
+            const size_t wordCount = splitCssWords(value, words);
+            if (wordCount < 1 || wordCount > 4)
+                return false;
+
+            BorderStyle styles[4] = {};
+            for (size_t index = 0; index < wordCount; index++)
+            {
+                const BorderStyle* style = BorderStyles.find(words[index].Data, words[index].Length);
+                if (style == nullptr)
+                    return false;
+                styles[index] = *style;
+            }
+
+            borderStyle.top    = styles[0];
+            borderStyle.right  = (wordCount >= 2 ? styles[1] : styles[0]);
+            borderStyle.bottom = (wordCount >= 3 ? styles[2] : styles[0]);
+            borderStyle.left   = (wordCount == 4 ? styles[3] : borderStyle.right);
+            return true;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Normalizes the raw attribute value and resolves the entity references into the indicated value
+        ///
+        /// The leading and trailing white-space characters are trimmed, line feeds are removed and the other line breaking
+        /// white-space characters are replaced by blanks within one copy; the entity references are resolved in place after.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void decodeRawValue(XhtmlDiagnostics& diagnostics, const char32_t* rawValue, size_t length, tgui::String& value)
+        {
+            size_t beginPosition = 0;
+            while (beginPosition < length && tgui::isWhitespace(rawValue[beginPosition]))
+                beginPosition++;
+            while (length > beginPosition && tgui::isWhitespace(rawValue[length - 1]))
+                length--;
+
+            value.clear();
+            value.reserve(length - beginPosition);
+            bool hasEntityReference = false;
+            for (size_t position = beginPosition; position < length; position++)
+            {
+                const char32_t character = rawValue[position];
+                if (character == U'\n')
+                    continue;
+                if (character == U'\r' || character == U'\t' || character == U'\v')
+                    value += U' ';
+                else
+                    value += character;
+                hasEntityReference = hasEntityReference || character == U'&';
+            }
+            if (!hasEntityReference)
+                return;
+
+            /** resolve entity reference(s) - a substitution never grows the value, so it is compacted in place */
+            char32_t*    data = value.data();
+            const size_t valueLength = value.length();
+            size_t       readPosition = 0;
+            size_t       writePosition = 0;
+            while (readPosition < valueLength)
+            {
+                if (data[readPosition] == U'&')
+                {
+                    char32_t     substituteCharacter = 0;
+                    char32_t     secondSubstituteCharacter = 0;
+                    unsigned int substitutionLength = XhtmlEntityResolver::resolveEntity(diagnostics, data + readPosition, valueLength - readPosition,
+                                                                                         substituteCharacter, secondSubstituteCharacter, true);
+                    if (substitutionLength >= (secondSubstituteCharacter != 0 ? 2u : 1u))
+                    {
+                        data[writePosition++] = substituteCharacter;
+                        if (secondSubstituteCharacter != 0)
+                            data[writePosition++] = secondSubstituteCharacter;
+                        readPosition += substitutionLength;
+                        continue;
+                    }
+                }
+                data[writePosition++] = data[readPosition++];
+            }
+            value.resize(writePosition);
+        }
+    }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    XhtmlAttribute::Ptr XhtmlAttribute::createFromStr(std::vector<std::tuple<MessageType, tgui::String>>& messages, const tgui::String& buffer,
+    XhtmlAttribute::Ptr XhtmlAttribute::createFromStr(XhtmlDiagnostics& diagnostics, const SourcePtr& source,
         const size_t beginPosition, size_t& processedLength)
     {
         processedLength = 0;
@@ -178,13 +551,14 @@ namespace tgui  { namespace xhtml
 #ifdef LOG_ATTRIBUTE
         // std::wcout << U"  Begin parsing attribute. ";
 #endif
-        if (buffer.empty())
+        if (source == nullptr || source->empty())
         {
-            tgui::String message(U"XhtmlAttribute::createFromStr() -> Invalid buffer!");
-            messages.push_back(std::make_tuple(MessageType::ERROR, message));
+            diagnostics.report(XhtmlDiagnosticCode::AttributeBufferInvalid);
             return nullptr;
         }
 
+        const tgui::String& buffer = *source;
+
         XhtmlAttribute::Ptr attribute = nullptr;
         size_t  workPosition = beginPosition;
         size_t  endPosition = beginPosition;
@@ -214,8 +588,7 @@ namespace tgui  { namespace xhtml
             {
                 if (endPosition == workPosition)
                 {
-                    tgui::String message(U"XhtmlAttribute::createFromStr() -> Attribute is of length 0, but shouldn't!");
-                    messages.push_back(std::make_tuple(MessageType::ERROR, message));
+                    diagnostics.report(XhtmlDiagnosticCode::AttributeNameEmpty);
 
                     // probably no attribute but an inner text
                     return nullptr;
@@ -244,9 +617,9 @@ namespace tgui  { namespace xhtml
         // success
         tgui::String attributeString = buffer.substr(workPosition, endPosition - workPosition);
         if (attributeString.equalIgnoreCase(XhtmlStyleEntry::TypeName))
-            attribute = std::make_shared<XhtmlStyleEntry>();
+            attribute = XhtmlMemoryResource::makeShared<XhtmlStyleEntry>();
         else
-            attribute = std::make_shared<XhtmlAttribute>(attributeString);
+            attribute = XhtmlMemoryResource::makeShared<XhtmlAttribute>(attributeString);
 
         // process inner-text or attribute without value
         if (buffer[endPosition] != U'=')
@@ -304,8 +677,8 @@ namespace tgui  { namespace xhtml
             std::wcout << U"  Set name '" << attribute->getName() << U"' to attribute." << std::endl;
 #endif
             if (endPosition != workPosition)
-                // normalize data and resolve references
-                attribute->putValue(messages, buffer.substr(workPosition, endPosition - workPosition));
+                // keep the span - normalizing data and resolving references is deferred to the first read
+                attribute->putRawValue(diagnostics, source, workPosition, endPosition - workPosition);
 
 #ifdef LOG_ATTRIBUTE
             std::wcout << U"  End parsing attribute successfully with value '" << attribute->getValue() << U"'." << std::endl;
@@ -318,40 +691,93 @@ namespace tgui  { namespace xhtml
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void XhtmlAttribute::putValue(std::vector<std::tuple<MessageType, String>>& messages, const tgui::String& rawValue)
+    XhtmlAttribute::Revision XhtmlAttribute::nextRevision()
+    {
+        static std::atomic<Revision> lastRevision(0);
+        return lastRevision.fetch_add(1, std::memory_order_relaxed) + 1;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void XhtmlAttribute::putValue(XhtmlDiagnostics& diagnostics, const tgui::String& rawValue)
     {
         if (rawValue.empty())
         {
-            tgui::String message(U"XhtmlAttribute::putValue() -> Invalid rawValue!");
-            messages.push_back(std::make_tuple(MessageType::ERROR, message));
+            diagnostics.report(XhtmlDiagnosticCode::AttributeValueInvalid);
             return;
         }
 
-        m_value = rawValue;
+        m_source = nullptr;
+        decodeRawValue(diagnostics, rawValue.data(), rawValue.length(), m_value);
+        m_revision = nextRevision();
+    }
 
-        // clean the value
-        m_value = m_value.trim();
-        m_value.remove(U'\n');
-        m_value.replace(U'\r', U' ');
-        m_value.replace(U'\t', U' ');
-        m_value.replace(U'\v', U' ');
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        /** resolve entity reference(s) */
-        size_t       workPosition = -1;
-        unsigned int substitutionLength = 0;
-        char32_t     substituteCharacter = 0;
-        do
+    void XhtmlAttribute::putRawValue(XhtmlDiagnostics& diagnostics, const SourcePtr& source, size_t offset, size_t length)
+    {
+        if (source == nullptr || length == 0 || offset + length > source->length())
+        {
+            diagnostics.report(XhtmlDiagnosticCode::AttributeValueInvalid);
+            return;
+        }
+
+        m_revision = nextRevision();
+        if (length * sizeof(char32_t) <= PendingValueOverhead)
         {
-            if ((workPosition = m_value.find(U'&', ++workPosition)) == tgui::String::npos)
-                break;
+            m_source = nullptr;
+            decodeRawValue(diagnostics, source->data() + offset, length, m_value);
+            return;
+        }
 
-            substitutionLength = XhtmlEntityResolver::resolveEntity(messages, m_value.substr(workPosition).c_str(), substituteCharacter);
-            if (substitutionLength)
-            {
-                tgui::String strSubst; strSubst += substituteCharacter;
-                m_value.replace(m_value.substr(workPosition, substitutionLength), strSubst);
-            }
-        } while (true);
+        m_source = source;
+        m_sourceOffset = offset;
+        m_sourceLength = length;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void XhtmlAttribute::sliceSources(const std::vector<XhtmlAttribute::Ptr>& attributes)
+    {
+        // determine the range, that covers all raw values referring to the same source buffer (the buffer of one tag)
+        SourcePtr source = nullptr;
+        size_t    beginPosition = tgui::String::npos;
+        size_t    endPosition = 0;
+        for (const XhtmlAttribute::Ptr& attribute : attributes)
+        {
+            if (attribute == nullptr || attribute->m_source == nullptr)
+                continue;
+            if (source == nullptr)
+                source = attribute->m_source;
+            else if (attribute->m_source != source)
+                continue;
+            beginPosition = std::min(beginPosition, attribute->m_sourceOffset);
+            endPosition = std::max(endPosition, attribute->m_sourceOffset + attribute->m_sourceLength);
+        }
+        if (source == nullptr || (beginPosition == 0 && endPosition == source->length()))
+            return;
+
+        const SourcePtr slice = std::make_shared<const tgui::String>(source->substr(beginPosition, endPosition - beginPosition));
+        for (const XhtmlAttribute::Ptr& attribute : attributes)
+        {
+            if (attribute == nullptr || attribute->m_source != source)
+                continue;
+            attribute->m_source = slice;
+            attribute->m_sourceOffset -= beginPosition;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void XhtmlAttribute::decodeValue() const
+    {
+        if (m_source == nullptr)
+            return;
+
+        // the parser run is over, so there is no receiver for the errors/warnings anymore
+        XhtmlDiagnostics diagnostics(XhtmlDiagnosticsMode::None);
+        decodeRawValue(diagnostics, m_source->data() + m_sourceOffset, m_sourceLength, m_value);
+        m_source = nullptr;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -428,291 +854,273 @@ namespace tgui  { namespace xhtml
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void XhtmlStyleEntry::putValue(std::vector<std::tuple<tgui::xhtml::MessageType, String>>& messages, const tgui::String& rawValue)
+    void XhtmlStyleEntry::putRawValue(XhtmlDiagnostics& diagnostics, const SourcePtr& source, size_t offset, size_t length)
     {
-        XhtmlAttribute::putValue(messages, rawValue);
-        auto styleEntryValues = StringEx::split(m_value, U';', true);
-        for (auto styleEntryValue : styleEntryValues)
+        if (source == nullptr || length == 0 || offset + length > source->length())
         {
-            styleEntryValue.remove(U';');
-            styleEntryValue = styleEntryValue.trim();
+            diagnostics.report(XhtmlDiagnosticCode::AttributeValueInvalid);
+            return;
+        }
 
-            if (styleEntryValue.size() == 0)
-                continue;
-            if (styleEntryValue.size() <= 3)
-            {
-                tgui::String message(U"XhtmlAttribute::putValue() -> Unable to recognize style value from '" + styleEntryValue + U"'!");
-                messages.push_back(std::make_tuple(MessageType::ERROR, message));
-                continue;
-            }
+        putValue(diagnostics, source->substr(offset, length));
+    }
 
-            auto styleEntryParts = StringEx::split(styleEntryValue, U':', true);
-            if (styleEntryParts.size() != 2)
-            {
-                tgui::String message(U"XhtmlAttribute::putValue() -> Unable to split style value '" + styleEntryValue + U"' into key and value(s)!");
-                messages.push_back(std::make_tuple(MessageType::ERROR, message));
-                continue;
-            }
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-            styleEntryParts[0] = styleEntryParts[0].trim();
-            styleEntryParts[1] = styleEntryParts[1].trim();
-            std::transform(styleEntryParts[0].begin(), styleEntryParts[0].end(), styleEntryParts[0].begin(), ::tolower);
-            std::transform(styleEntryParts[1].begin(), styleEntryParts[1].end(), styleEntryParts[1].begin(), ::tolower);
+    void XhtmlStyleEntry::putValue(XhtmlDiagnostics& diagnostics, const tgui::String& rawValue)
+    {
+        XhtmlAttribute::putValue(diagnostics, rawValue);
 
-            if (styleEntryParts[0].size() <= 1 || styleEntryParts[1].size() <= 1)
-            {
-                tgui::String message(U"XhtmlAttribute::putValue() -> Unable to recognize key and value from style value '" + styleEntryValue + U"'!");
-                messages.push_back(std::make_tuple(MessageType::ERROR, message));
-                continue;
-            }
+        const char32_t* value = m_value.data();
+        const size_t    valueLength = m_value.length();
+        for (size_t declarationBegin = 0; declarationBegin < valueLength; )
+        {
+            size_t declarationEnd = declarationBegin;
+            while (declarationEnd < valueLength && value[declarationEnd] != U';')
+                declarationEnd++;
+            const CssSpan declaration = trimCssSpan({ value + declarationBegin, declarationEnd - declarationBegin });
+            declarationBegin = declarationEnd + 1;
 
-            if      (styleEntryParts[0].equalIgnoreCase(U"opacity"))
-            {
-                auto opacity = styleEntryParts[1].toFloat();
-                setOpacity(opacity);
-                continue;
-            }
-            else if (styleEntryParts[0].equalIgnoreCase(U"background") ||
-                     styleEntryParts[0].equalIgnoreCase(U"background-color"))
-            {
-                try
-                {
-                    auto colorValue = WebColorMap.find(styleEntryParts[1]) != WebColorMap.end() ? WebColorMap[styleEntryParts[1]] : styleEntryParts[1];
-                    if (colorValue[0] != U'#')
-                        colorValue = U"#" + colorValue;
-                    Color color(colorValue);
-                    setBackgroundColor(color);
-                }
-                catch(const Exception&)
-                {
-                    tgui::String message(U"XhtmlAttribute::putValue() -> Unable to recognize value from style value '" + styleEntryValue + U"'!");
-                    messages.push_back(std::make_tuple(MessageType::ERROR, message));
-                }
+            if (declaration.Length == 0)
                 continue;
-            }
-            else if (styleEntryParts[0].equalIgnoreCase(U"color"))
+            if (declaration.Length <= 3)
             {
-                Color colorValue = Color::Transparent;
-                if (tryParseColor(styleEntryParts[1], colorValue))
-                    setColor(colorValue);
-                else
-                {
-                    tgui::String message(U"XhtmlAttribute::putValue() -> Unable to recognize color value from style value '" + styleEntryValue + U"'!");
-                    messages.push_back(std::make_tuple(MessageType::ERROR, message));
-                }
+                diagnostics.report(XhtmlDiagnosticCode::StyleValueUnrecognized, declaration.Data, declaration.Length);
                 continue;
             }
-            else if (styleEntryParts[0].equalIgnoreCase(U"border-color"))
-            {
-                Color colorValue = Color::Transparent;
-                if (tryParseColor(styleEntryParts[1], colorValue))
-                    setBorderColor(colorValue);
-                else
-                {
-                    tgui::String message(U"XhtmlAttribute::putValue() -> Unable to recognize color value from style value '" + styleEntryValue + U"'!");
-                    messages.push_back(std::make_tuple(MessageType::ERROR, message));
-                }
-                continue;
-            }
-            else if (styleEntryParts[0].equalIgnoreCase(U"font-style"))
+
+            // split into property name and property value - empty parts don't count
+            CssSpan parts[2] = {};
+            size_t  partCount = 0;
+            for (size_t position = 0, partBegin = 0; position <= declaration.Length; position++)
             {
-                if (styleEntryParts[1].find(U"italic") != SIZE_MAX || styleEntryParts[1].find(U"oblique") != SIZE_MAX)
-                    setItalic(true);
-                else
-                {
-                    tgui::String message(U"XhtmlAttribute::putValue() -> Unable to recognize value from style value '" + styleEntryValue + U"'!");
-                    messages.push_back(std::make_tuple(MessageType::ERROR, message));
-                }
-                continue;
+                if (position < declaration.Length && declaration.Data[position] != U':')
+                    continue;
+                if (position > partBegin && partCount++ < 2)
+                    parts[partCount - 1] = { declaration.Data + partBegin, position - partBegin };
+                partBegin = position + 1;
             }
-            else if (styleEntryParts[0].equalIgnoreCase(U"font-weight"))
+            if (partCount != 2)
             {
-                if (styleEntryParts[1].find(U"bold") != SIZE_MAX)
-                    setBold(true);
-                else
-                {
-                    tgui::String message(U"XhtmlAttribute::putValue() -> Unable to recognize  value from style value '" + styleEntryValue + U"'!");
-                    messages.push_back(std::make_tuple(MessageType::ERROR, message));
-                }
+                diagnostics.report(XhtmlDiagnosticCode::StyleValueNotSplittable, declaration.Data, declaration.Length);
                 continue;
             }
-            else if (styleEntryParts[0].equalIgnoreCase(U"border-style"))
+
+            const CssSpan name = trimCssSpan(parts[0]);
+            const CssSpan propertyValue = trimCssSpan(parts[1]);
+            if (name.Length <= 1 || propertyValue.Length <= 1)
             {
-                FourDimBorderStyle borderStyle = getBorderStyle();
-                if (borderStyle.tryParse(StringEx::split(styleEntryParts[1], U' ')))
-                    setBorderStyle(borderStyle);
+                diagnostics.report(XhtmlDiagnosticCode::StyleKeyValueUnrecognized, declaration.Data, declaration.Length);
                 continue;
             }
-            else if (styleEntryParts[0].equalIgnoreCase(U"border-width"))
+
+            const StyleProperty* property = StyleProperties.find(name.Data, name.Length);
+            if (property == nullptr)
             {
-                styleEntryParts[1].replace(U"thin", U"1px");
-                styleEntryParts[1].replace(U"medium", U"3px");
-                styleEntryParts[1].replace(U"thick", U"5px");
-                FourDimSize borderWidth = getBorderWidth();
-                borderWidth.parse(StringEx::split(styleEntryParts[1], U' '));
-                setBorderWidth(borderWidth);
+                diagnostics.report(XhtmlDiagnosticCode::StyleValueInvalid, declaration.Data, declaration.Length);
                 continue;
             }
-            else if (styleEntryParts[0].equalIgnoreCase(U"border"))
-            {
-                styleEntryParts[1].replace(U"thin", U"1px");
-                styleEntryParts[1].replace(U"medium", U"3px");
-                styleEntryParts[1].replace(U"thick", U"5px");
 
-                auto styleEntrySubParts = StringEx::split(styleEntryParts[1], U' ', true);
-                for (size_t subPartIndex = 0; subPartIndex < styleEntrySubParts.size() && subPartIndex < 3; subPartIndex++)
-                    styleEntrySubParts[subPartIndex] = styleEntrySubParts[subPartIndex].trim();
-
-                if (styleEntrySubParts.size() == 1)
+            Color    colorValue = Color::Transparent;
+            SizeType sizeType = SizeType::Pixel;
+            switch (*property)
+            {
+                case StyleProperty::Opacity:
+                    setOpacity(parseCssNumber(propertyValue));
+                    break;
+                case StyleProperty::BackgroundColor:
+                    if (tryParseColor(propertyValue.Data, propertyValue.Length, colorValue))
+                        setBackgroundColor(colorValue);
+                    else
+                        diagnostics.report(XhtmlDiagnosticCode::StyleValueInvalid, declaration.Data, declaration.Length);
+                    break;
+                case StyleProperty::Color:
+                    if (tryParseColor(propertyValue.Data, propertyValue.Length, colorValue))
+                        setColor(colorValue);
+                    else
+                        diagnostics.report(XhtmlDiagnosticCode::StyleColorInvalid, declaration.Data, declaration.Length);
+                    break;
+                case StyleProperty::BorderColor:
+                    if (tryParseColor(propertyValue.Data, propertyValue.Length, colorValue))
+                        setBorderColor(colorValue);
+                    else
+                        diagnostics.report(XhtmlDiagnosticCode::StyleColorInvalid, declaration.Data, declaration.Length);
+                    break;
+                case StyleProperty::FontStyle:
+                    if (containsIgnoreCase(propertyValue, "italic") || containsIgnoreCase(propertyValue, "oblique"))
+                        setItalic(true);
+                    else
+                        diagnostics.report(XhtmlDiagnosticCode::StyleValueInvalid, declaration.Data, declaration.Length);
+                    break;
+                case StyleProperty::FontWeight:
+                    if (containsIgnoreCase(propertyValue, "bold"))
+                        setBold(true);
+                    else
+                        diagnostics.report(XhtmlDiagnosticCode::StyleValueInvalid, declaration.Data, declaration.Length);
+                    break;
+                case StyleProperty::BorderStyle:
                 {
-                    // border CSS consists of style
                     FourDimBorderStyle borderStyle = getBorderStyle();
-                    if (borderStyle.tryParse({ styleEntrySubParts[0] }))
+                    if (tryParseCssBorderStyle(propertyValue, borderStyle))
                         setBorderStyle(borderStyle);
+                    break;
                 }
-                else if (styleEntrySubParts.size() == 2)
+                case StyleProperty::BorderWidth:
                 {
-                    // border CSS consists of width and sytyle OR style and color
+                    FourDimSize borderWidth = getBorderWidth();
+                    parseCssFourDimSize(propertyValue, true, borderWidth);
+                    setBorderWidth(borderWidth);
+                    break;
+                }
+                case StyleProperty::Border:
+                {
+                    // the border shorthand consists of "style", "style color", "width style" or "width style color"
+                    CssSpan            words[MaxCssWords];
+                    const size_t       wordCount = splitCssWords(propertyValue, words);
                     FourDimBorderStyle borderStyle = getBorderStyle();
-                    if (borderStyle.tryParse({ styleEntrySubParts[0] }))
+                    FourDimSize        borderWidth = getBorderWidth();
+                    CssSpan            color = { nullptr, 0 };
+                    if (wordCount == 1)
                     {
-                        // border CSS consists of style and color
-                        setBorderStyle(borderStyle);
-
-                        Color colorValue = Color::Transparent;
-                        if (tryParseColor(styleEntrySubParts[1], colorValue))
-                            setBorderColor(colorValue);
-                        else
+                        if (tryParseCssBorderStyle(words[0], borderStyle))
+                            setBorderStyle(borderStyle);
+                    }
+                    else if (wordCount == 2)
+                    {
+                        if (tryParseCssBorderStyle(words[0], borderStyle))
+                        {
+                            setBorderStyle(borderStyle);
+                            color = words[1];
+                        }
+                        else if (tryParseCssBorderStyle(words[1], borderStyle))
                         {
-                            tgui::String message(U"XhtmlAttribute::putValue() -> Unable to recognize color value from style value '" + styleEntryValue + U"'!");
-                            messages.push_back(std::make_tuple(MessageType::ERROR, message));
+                            setBorderStyle(borderStyle);
+                            parseCssFourDimSize(words[0], true, borderWidth);
+                            setBorderWidth(borderWidth);
                         }
                     }
-                    else if (borderStyle.tryParse({ styleEntrySubParts[1] }))
+                    else if (wordCount == 3)
                     {
-                        // border CSS consists of width and sytyle
-                        setBorderStyle(borderStyle);
-
-                        FourDimSize borderWidth = getBorderWidth();
-                        borderWidth.parse({ styleEntrySubParts[0] });
+                        parseCssFourDimSize(words[0], true, borderWidth);
                         setBorderWidth(borderWidth);
-                        continue;
+                        if (tryParseCssBorderStyle(words[1], borderStyle))
+                            setBorderStyle(borderStyle);
+                        color = words[2];
+                    }
+
+                    if (color.Data != nullptr)
+                    {
+                        if (tryParseColor(color.Data, color.Length, colorValue))
+                            setBorderColor(colorValue);
+                        else
+                            diagnostics.report(XhtmlDiagnosticCode::StyleColorInvalid, declaration.Data, declaration.Length);
                     }
+                    break;
                 }
-                else if (styleEntrySubParts.size() == 3)
+                case StyleProperty::Margin:
+                case StyleProperty::MarginTop:
+                case StyleProperty::MarginRight:
+                case StyleProperty::MarginBottom:
+                case StyleProperty::MarginLeft:
                 {
-                    // border CSS consists of width and sytyle OR style and color
-                    FourDimSize borderWidth = getBorderWidth();
-                    borderWidth.parse({ styleEntrySubParts[0] });
-                    setBorderWidth(borderWidth);
-
-                    FourDimBorderStyle borderStyle = getBorderStyle();
-                    if (borderStyle.tryParse({ styleEntrySubParts[1] }))
-                        setBorderStyle(borderStyle);
-
-                    Color colorValue = Color::Transparent;
-                    if (tryParseColor(styleEntrySubParts[2], colorValue))
-                        setBorderColor(colorValue);
+                    FourDimSize margin = getMargin();
+                    if (*property == StyleProperty::Margin)
+                        parseCssFourDimSize(propertyValue, false, margin);
                     else
                     {
-                        tgui::String message(U"XhtmlAttribute::putValue() -> Unable to recognize color value from style value '" + styleEntryValue + U"'!");
-                            messages.push_back(std::make_tuple(MessageType::ERROR, message));
+                        const float length = parseCssLength(propertyValue, false, sizeType);
+                        if      (*property == StyleProperty::MarginTop)    margin.top    = length;
+                        else if (*property == StyleProperty::MarginRight)  margin.right  = length;
+                        else if (*property == StyleProperty::MarginBottom) margin.bottom = length;
+                        else                                                margin.left   = length;
+                        margin.sizeType = sizeType;
                     }
+                    setMargin(margin);
+                    break;
                 }
-            }
-            else if (XhtmlStyleEntry::containsAnyIgnoreCase(styleEntryParts[0],
-                        {U"margin", U"margin-top", U"margin-left", U"margin-bottom", U"margin-right"}))
-            {
-                FourDimSize margin = getMargin();
-                if (styleEntryParts[0].equalIgnoreCase(U"margin"))
-                    margin.parse(StringEx::split(styleEntryParts[1], U' ', true));
-                else
+                case StyleProperty::Padding:
+                case StyleProperty::PaddingTop:
+                case StyleProperty::PaddingRight:
+                case StyleProperty::PaddingBottom:
+                case StyleProperty::PaddingLeft:
                 {
-                    if (styleEntryParts[0].equalIgnoreCase(U"margin-top"))
-                        margin.top = styleEntryParts[1].toFloat();
-                    else if (styleEntryParts[0].equalIgnoreCase(U"margin-left"))
-                        margin.left = styleEntryParts[1].toFloat();
-                    else if (styleEntryParts[0].equalIgnoreCase(U"margin-bottom"))
-                        margin.bottom = styleEntryParts[1].toFloat();
-                    else if (styleEntryParts[0].equalIgnoreCase(U"margin-right"))
-                        margin.right = styleEntryParts[1].toFloat();
-
-                    margin.sizeType = FourDimSize::determineSizeType(styleEntryParts[1]);
+                    FourDimSize padding = getPadding();
+                    if (*property == StyleProperty::Padding)
+                        parseCssFourDimSize(propertyValue, false, padding);
+                    else
+                    {
+                        const float length = parseCssLength(propertyValue, false, sizeType);
+                        if      (*property == StyleProperty::PaddingTop)    padding.top    = length;
+                        else if (*property == StyleProperty::PaddingRight)  padding.right  = length;
+                        else if (*property == StyleProperty::PaddingBottom) padding.bottom = length;
+                        else                                                  padding.left   = length;
+                        padding.sizeType = sizeType;
+                    }
+                    setPadding(padding);
+                    break;
                 }
-                setMargin(margin);
-                continue;
-            }
-            else if (XhtmlStyleEntry::containsAnyIgnoreCase(styleEntryParts[0],
-                        {U"padding", U"padding-top", U"padding-left", U"padding-bottom", U"padding-right"}))
-            {
-                FourDimSize padding = getPadding();
-                if (styleEntryParts[0].equalIgnoreCase(U"padding"))
-                    padding.parse(StringEx::split(styleEntryParts[1], U' ', true));
-                else
+                case StyleProperty::Height:
                 {
-                    if (styleEntryParts[0].equalIgnoreCase(U"padding-top") == 0)
-                        padding.top = styleEntryParts[1].toFloat();
-                    else if (styleEntryParts[0].equalIgnoreCase(U"padding-left") == 0)
-                        padding.left = styleEntryParts[1].toFloat();
-                    else if (styleEntryParts[0].equalIgnoreCase(U"padding-bottom") == 0)
-                        padding.bottom = styleEntryParts[1].toFloat();
-                    else if (styleEntryParts[0].equalIgnoreCase(U"padding-right") == 0)
-                        padding.right = styleEntryParts[1].toFloat();
-
-                    padding.sizeType = FourDimSize::determineSizeType(styleEntryParts[1]);
+                    OneDimSize height = getHeight();
+                    height.value = parseCssNumber(propertyValue);
+                    setHeight(height);
+                    break;
+                }
+                case StyleProperty::Width:
+                {
+                    OneDimSize width = getWidth();
+                    width.value = parseCssNumber(propertyValue);
+                    setWidth(width);
+                    break;
                 }
-                setPadding(padding);
-                continue;
-            }
-            else if (styleEntryParts[0].equalIgnoreCase(U"height"))
-            {
-                OneDimSize height = getHeight();
-                height.value = styleEntryParts[1].toFloat();
-                setHeight(height);
-                continue;
-            }
-            else if (styleEntryParts[0].equalIgnoreCase(U"width"))
-            {
-                OneDimSize width = getWidth();
-                width.value = styleEntryParts[1].toFloat();
-                setWidth(width);
-                continue;
             }
-            tgui::String message(U"XhtmlAttribute::putValue() -> Unable to recognize  value from style value '" + styleEntryValue + U"'!");
-            messages.push_back(std::make_tuple(MessageType::ERROR, message));
-            continue;
         }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool XhtmlStyleEntry::containsAnyIgnoreCase(const tgui::String& nocaseLeft, const std::vector<tgui::String>& patterns)
+    bool XhtmlStyleEntry::tryParseColor(const char32_t* colorString, size_t length, Color& colorValue)
     {
-        auto left = nocaseLeft.toLower();
-        for (auto pattern : patterns)
-            if (left.contains(pattern))
-                return true;
-
-        return false;
-    }
-
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        if (colorString == nullptr)
+            return false;
 
-    bool XhtmlStyleEntry::tryParseColor(const tgui::String& colorString, Color& colorValue)
-    {
-        try
+        const std::uint32_t* webColor = WebColors.find(colorString, length);
+        if (webColor != nullptr)
         {
-            auto finalColorString = WebColorMap.find(colorString) != WebColorMap.end() ? WebColorMap[colorString] : colorString;
-            if (finalColorString[0] != U'#')
-                finalColorString = U"#" + finalColorString;
-            Color color(finalColorString);
-            colorValue = color;
+            colorValue = Color(static_cast<std::uint8_t>(*webColor >> 16), static_cast<std::uint8_t>(*webColor >> 8),
+                               static_cast<std::uint8_t>(*webColor));
             return true;
         }
-        catch (const Exception&)
-        {
+
+        // Accept "#RGB", "#RGBA", "#RRGGBB" and "#RRGGBBAA" - the leading '#' is optional.
+        const size_t offset = (length > 0 && colorString[0] == U'#') ? 1 : 0;
+        const size_t digitCount = length - offset;
+        if (digitCount != 3 && digitCount != 4 && digitCount != 6 && digitCount != 8)
             return false;
+
+        std::uint8_t digits[8] = {};
+        for (size_t index = 0; index < digitCount; index++)
+        {
+            const char32_t character = colorString[offset + index];
+            if      (character >= U'0' && character <= U'9')
+                digits[index] = static_cast<std::uint8_t>(character - U'0');
+            else if (character >= U'a' && character <= U'f')
+                digits[index] = static_cast<std::uint8_t>(character - U'a' + 10);
+            else if (character >= U'A' && character <= U'F')
+                digits[index] = static_cast<std::uint8_t>(character - U'A' + 10);
+            else
+                return false;
         }
+
+        std::uint8_t components[4] = { 0, 0, 0, 255 };
+        const size_t componentCount = (digitCount == 3 || digitCount == 6) ? 3 : 4;
+        const bool   isShortForm    = (digitCount == 3 || digitCount == 4);
+        for (size_t index = 0; index < componentCount; index++)
+            components[index] = isShortForm ? static_cast<std::uint8_t>(digits[index] * 17)
+                                            : static_cast<std::uint8_t>(digits[2 * index] * 16 + digits[2 * index + 1]);
+
+        colorValue = Color(components[0], components[1], components[2], components[3]);
+        return true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,233 @@
+#include <tuple>
+#include <vector>
+
+#include <TGUI/Config.hpp>
+#include <TGUI/TGUI.hpp>
+
+// MSC needs a clear distiction between "__declspec(dllimport)" (above) and "__declspec(dllexport)" (below) this comment.
+// So in the case of direct source file integration (in contrast to library creation and linking), the API must be 'dllexport'.
+#ifndef TGUI_STATIC
+#ifdef TGUI_SYSTEM_WINDOWS
+#undef TGUI_API
+#define TGUI_API __declspec(dllexport)
+#endif
+#endif
+
+#include "TGUI/Xhtml/Dom/XhtmlDiagnostics.hpp"
+
+namespace tgui  { namespace xhtml
+{
+    namespace
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief The message type and message text template of one diagnostic code
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct DiagnosticTemplate
+        {
+            XhtmlDiagnosticCode Code;  //!< The diagnostic code (to verify the table order)
+            MessageType         Type;  //!< The message type
+            const char32_t*     Text;  //!< The message text, "%1" and "%2" are replaced by the arguments
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief The message types and message text templates, in the order of the diagnostic codes
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        constexpr DiagnosticTemplate DiagnosticTemplates[] =
+        {
+            { XhtmlDiagnosticCode::DocumentNotReadable,           MessageType::ERROR,
+              U"%1" },
+            { XhtmlDiagnosticCode::FeedNotIncremental,            MessageType::ERROR,
+              U"XhtmlParser::feed() -> The parser has not been created for incremental parsing!" },
+            { XhtmlDiagnosticCode::FeedAfterFinish,               MessageType::ERROR,
+              U"XhtmlParser::feed() -> The parser has already been finished!" },
+            { XhtmlDiagnosticCode::CommentNotClosed,              MessageType::ERROR,
+              U"XhtmlParser::parseComment() -> Probably not closed comment tag!" },
+            { XhtmlDiagnosticCode::CommentIncomplete,             MessageType::ERROR,
+              U"XhtmlParser::parseComment() -> Probably incomplete character stream at the end of comment tag!" },
+            { XhtmlDiagnosticCode::CommentNotAccuratelyClosed,    MessageType::ERROR,
+              U"XhtmlParser::parseComment() -> Probably not accurate closed comment tag!" },
+            { XhtmlDiagnosticCode::ElementBufferInvalid,          MessageType::ERROR,
+              U"XhtmlParser::parseElement() -> Invalid buffer!" },
+            { XhtmlDiagnosticCode::ElementIndexOverrun,           MessageType::ERROR,
+              U"XhtmlParser::parseElement() -> Index overrun!" },
+            { XhtmlDiagnosticCode::ElementTooLong,                MessageType::ERROR,
+              U"XhtmlParser::parseElement() -> Tag should be delimited within the maximum tag length, but isn't!" },
+            { XhtmlDiagnosticCode::ElementNotCreated,             MessageType::ERROR,
+              U"XhtmlParser::parseDocument() -> An XHTML element should be created, but isn't!" },
+            { XhtmlDiagnosticCode::InnerTextParentInvalid,        MessageType::ERROR,
+              U"XhtmlParser::parseDocument() -> An inner text '%1' should have a parent style element or parent container "
+              U"element, but parent element is of type '%2'!" },
+            { XhtmlDiagnosticCode::InnerTextParentMissing,        MessageType::ERROR,
+              U"XhtmlParser::parseDocument() -> An inner text '%1' should have a parent container element, but hasn't!" },
+            { XhtmlDiagnosticCode::RemainingCharacters,           MessageType::ERROR,
+              U"XhtmlParser::parseDocument() -> There are remaining characters '%1' after the end of document parsing!" },
+            { XhtmlDiagnosticCode::MultipleHtmlRoots,             MessageType::ERROR,
+              U"XhtmlParser::parseDocument() -> There is more than 1 'html' root element, but shouldn't!" },
+            { XhtmlDiagnosticCode::EndTagMismatch,                MessageType::WARNING,
+              U"XhtmlParser::parseDocument_checkStartEndTagParity() -> Can't close tag of type '%1' with tag of type '%2'!" },
+            { XhtmlDiagnosticCode::EndTagUnmatched,               MessageType::WARNING,
+              U"XhtmlParser::parseDocument_checkStartEndTagParity() -> Can't find matching open tag for tag of type '%1'!" },
+            { XhtmlDiagnosticCode::TagBufferInvalid,              MessageType::ERROR,
+              U"XhtmlElement::createFromParseStr() -> Invalid buffer!" },
+            { XhtmlDiagnosticCode::TagStartInvalid,               MessageType::ERROR,
+              U"XhtmlElement::createFromParseStr() -> Invalid start character!" },
+            { XhtmlDiagnosticCode::TagTypeNameNotEmpty,           MessageType::ERROR,
+              U"XhtmlElement::createFromParseStr() -> Element type name should be empty, but isn't!" },
+            { XhtmlDiagnosticCode::TagClosingReached,             MessageType::ERROR,
+              U"XhtmlElement::createFromParseStr() -> Closing tag should not be reached, but is!" },
+            { XhtmlDiagnosticCode::TagTypeNameStartInvalid,       MessageType::ERROR,
+              U"XhtmlElement::createFromParseStr() -> Element type name should start with an alphabet character, but doesn't!" },
+            { XhtmlDiagnosticCode::TagTypeNameEmpty,              MessageType::ERROR,
+              U"XhtmlElement::createFromParseStr() -> Element is of length 0, but shouldn't!" },
+            { XhtmlDiagnosticCode::TagTypeNameInvalid,            MessageType::ERROR,
+              U"XhtmlElement::createFromParseStr() -> Element type name should consist of alpha-numerical characters, "
+              U"underscores, hyphen, colons and periods only, but doesn't!" },
+            { XhtmlDiagnosticCode::ScriptTagNotClosed,            MessageType::WARNING,
+              U"XhtmlElement::createFromParseStr() -> Element of type '%1' (anticipated type is script) should be closed, "
+              U"but isn't! We assume it is a tag inside the script code and continue." },
+            { XhtmlDiagnosticCode::ScriptClosingTagExpected,      MessageType::WARNING,
+              U"XhtmlElement::createFromParseStr() -> Element of type '%1' (anticipated type is script) closing tag expected, "
+              U"but isn't! We assume it is a tag inside the script code and continue." },
+            { XhtmlDiagnosticCode::ClosingTagEndExpected,         MessageType::ERROR,
+              U"XhtmlElement::createFromParseStr() -> Element of type '%1' closing tag end delimiter expected, but isn't!" },
+            { XhtmlDiagnosticCode::ClosingTagTypeNameEmpty,       MessageType::ERROR,
+              U"XhtmlElement::createFromParseStr() -> Element type name should not be empty for the closing tag, but is!" },
+            { XhtmlDiagnosticCode::TagNotAutoClosable,            MessageType::ERROR,
+              U"XhtmlElement::createFromParseStr() -> Element of type '%1' should be delimited by '</...>', but is delimited "
+              U"by <.../>!" },
+            { XhtmlDiagnosticCode::TagNotDelimitedAfterInnerText, MessageType::ERROR,
+              U"XhtmlElement::createFromParseStr() -> Element of type '%1' should be delimited after the inner text, but "
+              U"isn't (EOF found)!" },
+            { XhtmlDiagnosticCode::TagNotOpenedBeforeEndSymbol,   MessageType::ERROR,
+              U"XhtmlElement::createFromParseStr() -> Element of type '%1' should be opened before the occurence of the end "
+              U"tag symbol'/', but isn't!" },
+            { XhtmlDiagnosticCode::TagNotDelimited,               MessageType::ERROR,
+              U"XhtmlElement::createFromParseStr() -> Element of type '%1' should be delimited by '>', but isn't!" },
+            { XhtmlDiagnosticCode::ElementTypeUnknown,            MessageType::WARNING,
+              U"XhtmlElement::createFromParseData() -> Couldn't recognize element type for tag type '%1', continue with "
+              U"'empty' - but this is unsafe!" },
+            { XhtmlDiagnosticCode::AttributesBufferInvalid,       MessageType::ERROR,
+              U"XhtmlElement::parseAttributesFromStr() -> Invalid buffer!" },
+            { XhtmlDiagnosticCode::AttributeBufferInvalid,        MessageType::ERROR,
+              U"XhtmlAttribute::createFromStr() -> Invalid buffer!" },
+            { XhtmlDiagnosticCode::AttributeNameEmpty,            MessageType::ERROR,
+              U"XhtmlAttribute::createFromStr() -> Attribute is of length 0, but shouldn't!" },
+            { XhtmlDiagnosticCode::AttributeValueInvalid,         MessageType::ERROR,
+              U"XhtmlAttribute::putValue() -> Invalid rawValue!" },
+            { XhtmlDiagnosticCode::StyleValueUnrecognized,        MessageType::ERROR,
+              U"XhtmlAttribute::putValue() -> Unable to recognize style value from '%1'!" },
+            { XhtmlDiagnosticCode::StyleValueNotSplittable,       MessageType::ERROR,
+              U"XhtmlAttribute::putValue() -> Unable to split style value '%1' into key and value(s)!" },
+            { XhtmlDiagnosticCode::StyleKeyValueUnrecognized,     MessageType::ERROR,
+              U"XhtmlAttribute::putValue() -> Unable to recognize key and value from style value '%1'!" },
+            { XhtmlDiagnosticCode::StyleValueInvalid,             MessageType::ERROR,
+              U"XhtmlAttribute::putValue() -> Unable to recognize value from style value '%1'!" },
+            { XhtmlDiagnosticCode::StyleColorInvalid,             MessageType::ERROR,
+              U"XhtmlAttribute::putValue() -> Unable to recognize color value from style value '%1'!" },
+            { XhtmlDiagnosticCode::StyleSheetBlockNotClosed,      MessageType::ERROR,
+              U"XhtmlStyleSheet::compile() -> Block or comment not closed until the end of the style sheet!" },
+            { XhtmlDiagnosticCode::StyleSheetRuleIncomplete,      MessageType::ERROR,
+              U"XhtmlStyleSheet::compile() -> Rule '%1' has no declaration block!" },
+            { XhtmlDiagnosticCode::StyleSheetAtRuleIgnored,       MessageType::WARNING,
+              U"XhtmlStyleSheet::compile() -> At-rule '%1' is not supported and skipped." },
+            { XhtmlDiagnosticCode::StyleSheetSelectorUnsupported, MessageType::WARNING,
+              U"XhtmlStyleSheet::compile() -> Selector '%1' is not supported and skipped." },
+            { XhtmlDiagnosticCode::EntityInvalid,                 MessageType::ERROR,
+              U"XhtmlEntityResolver::resolveEntity() -> Entity to encode not valid!" }
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Verifies at compile time, that the message text templates are in the order of the diagnostic codes
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        constexpr bool isDiagnosticTemplateOrderValid()
+        {
+            for (size_t index = 0; index < sizeof(DiagnosticTemplates) / sizeof(DiagnosticTemplates[0]); index++)
+                if (static_cast<size_t>(DiagnosticTemplates[index].Code) != index)
+                    return false;
+            return true;
+        }
+
+        static_assert(sizeof(DiagnosticTemplates) / sizeof(DiagnosticTemplates[0]) == static_cast<size_t>(XhtmlDiagnosticCode::Count),
+                      "Every diagnostic code requires a message text template!");
+        static_assert(isDiagnosticTemplateOrderValid(), "The message text templates must be in the order of the diagnostic codes!");
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void XhtmlDiagnostics::clear()
+    {
+        m_errorCount   = 0;
+        m_warningCount = 0;
+        m_offset       = 0;
+        m_line         = 0;
+        m_column       = 0;
+        m_diagnostics.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<std::tuple<MessageType, tgui::String>> XhtmlDiagnostics::toMessages() const
+    {
+        std::vector<std::tuple<MessageType, tgui::String>> messages;
+        messages.reserve(m_diagnostics.size());
+        for (auto& diagnostic : m_diagnostics)
+            messages.push_back(std::make_tuple(getMessageType(diagnostic.Code), format(diagnostic)));
+        return messages;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    MessageType XhtmlDiagnostics::getMessageType(XhtmlDiagnosticCode code)
+    {
+        if (code >= XhtmlDiagnosticCode::Count)
+            return MessageType::ERROR;
+        return DiagnosticTemplates[static_cast<size_t>(code)].Type;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    tgui::String XhtmlDiagnostics::format(const XhtmlDiagnostic& diagnostic)
+    {
+        if (diagnostic.Code >= XhtmlDiagnosticCode::Count)
+            return tgui::String(U"Unknown diagnostic code!");
+
+        tgui::String message;
+        for (const char32_t* text = DiagnosticTemplates[static_cast<size_t>(diagnostic.Code)].Text; *text != U'\0'; text++)
+        {
+            if (text[0] == U'%' && (text[1] == U'1' || text[1] == U'2'))
+            {
+                message.append(text[1] == U'1' ? diagnostic.Argument : diagnostic.SecondArgument);
+                text++;
+            }
+            else
+                message.append(1, *text);
+        }
+
+        if (diagnostic.Line != 0)
+        {
+            message.append(U" (line ").append(tgui::String::fromNumber(diagnostic.Line));
+            message.append(U", column ").append(tgui::String::fromNumber(diagnostic.Column));
+            message.append(U", offset ").append(tgui::String::fromNumber(diagnostic.Offset)).append(U")");
+        }
+        return message;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void XhtmlDiagnostics::collect(XhtmlDiagnosticCode code, const tgui::String* argument, const tgui::String* secondArgument)
+    {
+        XhtmlDiagnostic diagnostic;
+        diagnostic.Code   = code;
+        diagnostic.Offset = m_offset;
+        diagnostic.Line   = m_line;
+        diagnostic.Column = m_column;
+        if (argument != nullptr)
+            diagnostic.Argument = *argument;
+        if (secondArgument != nullptr)
+            diagnostic.SecondArgument = *secondArgument;
+        m_diagnostics.push_back(std::move(diagnostic));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+} }
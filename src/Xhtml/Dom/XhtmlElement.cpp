@@ -74,6 +74,9 @@ namespace tgui  { namespace xhtml
     constexpr const char  XhtmlElementType::Anchor[];
     constexpr const char  XhtmlElementType::Image[];
     constexpr const char  XhtmlElementType::Script[];
+    constexpr const char  XhtmlElementType::Empty[];
+
+    constexpr XhtmlElementType::TagId XhtmlElementType::EmptyTagId;
 #endif
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -93,7 +96,175 @@ namespace tgui  { namespace xhtml
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    XhtmlElementType XhtmlElementType::m_dataTypes[] =
+    namespace
+    {
+        constexpr size_t TagHashTableSize = 128; //!< The number of slots of the perfect hash table (must be a power of 2)
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Calculates the slot of an element type name within the perfect hash table
+        ///
+        /// The multipliers are chosen to map all supported element type names to distinct slots, which is verified at compile
+        /// time by createTagHashTable(). Since 'c | 0x20' maps upper case ASCII letters to lower case, the hash is case
+        /// insensitive for all element type names.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <typename CharT>
+        constexpr size_t hashTagName(const CharT* typeName, size_t length)
+        {
+            const size_t first  = static_cast<size_t>(typeName[0]) | 0x20;
+            const size_t second = (length > 1 ? static_cast<size_t>(typeName[1]) | 0x20 : 0);
+            const size_t last   = static_cast<size_t>(typeName[length - 1]) | 0x20;
+            return (length + first + 10 * last + 15 * second) & (TagHashTableSize - 1);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Compares a (lower case) element type name with a case insensitive name, that needs not to be zero terminated
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <typename CharT>
+        inline bool equalTagName(const char* tagName, const CharT* typeName, size_t length)
+        {
+            for (size_t index = 0; index < length; index++)
+            {
+                auto c = static_cast<char32_t>(typeName[index]);
+                if (c >= U'A' && c <= U'Z')
+                    c += U'a' - U'A';
+                if (tagName[index] == '\0' || c != static_cast<char32_t>(static_cast<unsigned char>(tagName[index])))
+                    return false;
+            }
+            return tagName[length] == '\0';
+        }
+
+        /// @brief The perfect hash table, that maps element type name hashes to tag IDs
+        struct TagHashTable
+        {
+            XhtmlElementType::TagId TagIds[TagHashTableSize]; //!< The tag IDs per slot, unused slots contain EmptyTagId
+            size_t                  MaxLength;                //!< The length of the longest element type name
+            bool                    IsCollisionFree;          //!< The flag indicating whether no two names share a slot
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates the perfect hash table from the supported XHTML element types at compile time
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <size_t N>
+        constexpr TagHashTable createTagHashTable(const XhtmlElementType (&dataTypes)[N])
+        {
+            TagHashTable table = {};
+            for (size_t slot = 0; slot < TagHashTableSize; slot++)
+                table.TagIds[slot] = XhtmlElementType::EmptyTagId;
+            table.MaxLength = 0;
+            table.IsCollisionFree = true;
+
+            for (size_t index = 0; index < N; index++)
+            {
+                size_t length = 0;
+                while (dataTypes[index].TypeName[length] != '\0')
+                    length++;
+
+                const size_t slot = hashTagName(dataTypes[index].TypeName, length);
+                if (table.TagIds[slot] != XhtmlElementType::EmptyTagId)
+                    table.IsCollisionFree = false;
+                table.TagIds[slot] = static_cast<XhtmlElementType::TagId>(index);
+                if (table.MaxLength < length)
+                    table.MaxLength = length;
+            }
+            return table;
+        }
+
+        /// @brief The factory of one XHTML element type, the index within ElementFactories is the tag ID
+        struct ElementFactory
+        {
+            const char*       TypeName;                                           //!< The element type name
+            XhtmlElement::Ptr (*Create)(const char* typeName, XhtmlElement::Ptr parent); //!< The creator of the element
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates a generic XHTML element, that has no dedicated class
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        XhtmlElement::Ptr createGenericElement(const char* typeName, XhtmlElement::Ptr parent)
+        {
+            auto element = XhtmlMemoryResource::makeShared<XhtmlElement>(typeName);
+            XhtmlElement::addChildAndSetPatent(parent, element);
+            return element;
+        }
+
+        // The sequence must be identical to XhtmlElementType::m_dataTypes, this is verified at compile time.
+        constexpr ElementFactory ElementFactories[] =
+        {
+            {   XhtmlElementType::DocType,         createGenericElement                                                                       },
+            {   XhtmlElementType::Document,        createGenericElement                                                                       },
+            {   XhtmlElementType::Meta,            createGenericElement                                                                       },
+            {   XhtmlElementType::Title,           createGenericElement                                                                       },
+            {   XhtmlElementType::Style,           [](const char*, XhtmlElement::Ptr parent) -> XhtmlElement::Ptr { return XhtmlElement::createStyle(parent); }            },
+            {   XhtmlElementType::Link,            createGenericElement                                                                       },
+            {   XhtmlElementType::Html,            [](const char*, XhtmlElement::Ptr parent) -> XhtmlElement::Ptr { return XhtmlElement::createHtml(parent); }             },
+            {   XhtmlElementType::Head,            [](const char*, XhtmlElement::Ptr parent) -> XhtmlElement::Ptr { return XhtmlElement::createHead(parent); }             },
+            {   XhtmlElementType::Body,            [](const char*, XhtmlElement::Ptr parent) -> XhtmlElement::Ptr { return XhtmlElement::createBody(parent); }             },
+            {   XhtmlElementType::Label,           createGenericElement                                                                       },
+            {   XhtmlElementType::Input,           createGenericElement                                                                       },
+
+            {   XhtmlElementType::H1,              [](const char*, XhtmlElement::Ptr parent) -> XhtmlElement::Ptr { return XhtmlElement::createH1(parent); }               },
+            {   XhtmlElementType::H2,              [](const char*, XhtmlElement::Ptr parent) -> XhtmlElement::Ptr { return XhtmlElement::createH2(parent); }               },
+            {   XhtmlElementType::H3,              [](const char*, XhtmlElement::Ptr parent) -> XhtmlElement::Ptr { return XhtmlElement::createH3(parent); }               },
+            {   XhtmlElementType::H4,              [](const char*, XhtmlElement::Ptr parent) -> XhtmlElement::Ptr { return XhtmlElement::createH4(parent); }               },
+            {   XhtmlElementType::H5,              [](const char*, XhtmlElement::Ptr parent) -> XhtmlElement::Ptr { return XhtmlElement::createH5(parent); }               },
+            {   XhtmlElementType::H6,              [](const char*, XhtmlElement::Ptr parent) -> XhtmlElement::Ptr { return XhtmlElement::createH6(parent); }               },
+
+            {   XhtmlElementType::Table,           [](const char*, XhtmlElement::Ptr parent) -> XhtmlElement::Ptr { return XhtmlElement::createTable(parent); }            },
+            {   XhtmlElementType::TableHead,       [](const char*, XhtmlElement::Ptr parent) -> XhtmlElement::Ptr { return XhtmlElement::createTableHead(parent); }        },
+            {   XhtmlElementType::TableBody,       [](const char*, XhtmlElement::Ptr parent) -> XhtmlElement::Ptr { return XhtmlElement::createTableBody(parent); }        },
+            {   XhtmlElementType::TableFoot,       [](const char*, XhtmlElement::Ptr parent) -> XhtmlElement::Ptr { return XhtmlElement::createTableFoot(parent); }        },
+            {   XhtmlElementType::TableRow,        [](const char*, XhtmlElement::Ptr parent) -> XhtmlElement::Ptr { return XhtmlElement::createTableRow(parent); }         },
+            {   XhtmlElementType::TableHeaderCell, [](const char*, XhtmlElement::Ptr parent) -> XhtmlElement::Ptr { return XhtmlElement::createTableHeaderCell(parent); }  },
+            {   XhtmlElementType::TableDataCell,   [](const char*, XhtmlElement::Ptr parent) -> XhtmlElement::Ptr { return XhtmlElement::createTableDataCell(parent); }    },
+
+            {   XhtmlElementType::UnorderedList,   [](const char*, XhtmlElement::Ptr parent) -> XhtmlElement::Ptr { return XhtmlElement::createUnorderedList(parent); }    },
+            {   XhtmlElementType::OrderedList,     [](const char*, XhtmlElement::Ptr parent) -> XhtmlElement::Ptr { return XhtmlElement::createOrderedList(parent); }      },
+            {   XhtmlElementType::ListItem,        [](const char*, XhtmlElement::Ptr parent) -> XhtmlElement::Ptr { return XhtmlElement::createListItem(parent); }         },
+            {   XhtmlElementType::Span,            [](const char*, XhtmlElement::Ptr parent) -> XhtmlElement::Ptr { return XhtmlElement::createSpan(parent); }             },
+            {   XhtmlElementType::Division,        [](const char*, XhtmlElement::Ptr parent) -> XhtmlElement::Ptr { return XhtmlElement::createDivision(parent); }         },
+            {   XhtmlElementType::Preformatted,    [](const char*, XhtmlElement::Ptr parent) -> XhtmlElement::Ptr { return XhtmlElement::createPreformatted(parent); }     },
+            {   XhtmlElementType::Code,            [](const char*, XhtmlElement::Ptr parent) -> XhtmlElement::Ptr { return XhtmlElement::createCode(parent); }             },
+            {   XhtmlElementType::Paragraph,       [](const char*, XhtmlElement::Ptr parent) -> XhtmlElement::Ptr { return XhtmlElement::createParagraph(parent); }        },
+            {   XhtmlElementType::Anchor,          [](const char*, XhtmlElement::Ptr parent) -> XhtmlElement::Ptr { return XhtmlElement::createAnchor(parent); }           },
+            {   XhtmlElementType::Image,           [](const char*, XhtmlElement::Ptr parent) -> XhtmlElement::Ptr { return XhtmlElement::createImage(parent); }            },
+
+            {   XhtmlElementType::Emphasized,      [](const char*, XhtmlElement::Ptr parent) -> XhtmlElement::Ptr { return XhtmlElement::createEmphasized(parent); }       },
+            {   XhtmlElementType::Italic,          [](const char*, XhtmlElement::Ptr parent) -> XhtmlElement::Ptr { return XhtmlElement::createItalic(parent); }           },
+            {   XhtmlElementType::Strong,          [](const char*, XhtmlElement::Ptr parent) -> XhtmlElement::Ptr { return XhtmlElement::createStrong(parent); }           },
+            {   XhtmlElementType::Bold,            [](const char*, XhtmlElement::Ptr parent) -> XhtmlElement::Ptr { return XhtmlElement::createBold(parent); }             },
+            {   XhtmlElementType::Underline,       [](const char*, XhtmlElement::Ptr parent) -> XhtmlElement::Ptr { return XhtmlElement::createUnderline(parent); }        },
+            {   XhtmlElementType::Superscript,     [](const char*, XhtmlElement::Ptr parent) -> XhtmlElement::Ptr { return XhtmlElement::createSuperscript(parent); }      },
+            {   XhtmlElementType::Subscript,       [](const char*, XhtmlElement::Ptr parent) -> XhtmlElement::Ptr { return XhtmlElement::createSubscript(parent); }        },
+            {   XhtmlElementType::Break,           [](const char*, XhtmlElement::Ptr parent) -> XhtmlElement::Ptr { return XhtmlElement::createBreak(parent); }            },
+
+            {   XhtmlElementType::Text,            [](const char*, XhtmlElement::Ptr parent) -> XhtmlElement::Ptr { return XhtmlElement::createInnerText(parent); }        },
+            {   XhtmlElementType::Script,          [](const char*, XhtmlElement::Ptr parent) -> XhtmlElement::Ptr
+                                                   {
+                                                       auto element = XhtmlMemoryResource::makeShared<XhtmlStyleableNoncontainerElement>(XhtmlElementType::Script);
+                                                       XhtmlElement::addChildAndSetPatent(parent, element);
+                                                       return element;
+                                                   }                                                                                          },
+
+            {   XhtmlElementType::Empty,           createGenericElement                                                                       }
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Checks at compile time, whether the element factories match the supported XHTML element types one by one
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <size_t N, size_t M>
+        constexpr bool matchElementFactories(const XhtmlElementType (&dataTypes)[N], const ElementFactory (&factories)[M])
+        {
+            if (N != M)
+                return false;
+            for (size_t index = 0; index < N; index++)
+                if (dataTypes[index].TypeName != factories[index].TypeName)
+                    return false;
+            return true;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    constexpr XhtmlElementType XhtmlElementType::m_dataTypes[] =
     {
         //                                     IsAutoClosed  IsStyleable IsContainer IsStructuringBlock IsTextBlock // IsContainer ==> empty means no closing tag
         //  Declarative tags
@@ -149,18 +320,61 @@ namespace tgui  { namespace xhtml
         {   XhtmlElementType::Text,            true,         false,      false,      false,             false   },
         {   XhtmlElementType::Script,          false,        true,       false,      false,             false   },
 
-        {   "empty",                           false,        false,      false,      false,             false   }
+        {   XhtmlElementType::Empty,           false,        false,      false,      false,             false   }
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     XhtmlElementType XhtmlElementType::getType(const char* typeName)
     {
-        auto size = sizeof(XhtmlElementType::m_dataTypes) / sizeof(m_dataTypes[0]);
-        for (size_t index = 0; index < size; index++)
-            if (tgui::viewEqualIgnoreCase(m_dataTypes[index].TypeName, typeName))
-                return m_dataTypes[index];
-        return m_dataTypes[size - 1];
+        return getTypeById(getTagId(typeName));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const XhtmlElementType& XhtmlElementType::getTypeById(TagId tagId)
+    {
+        return m_dataTypes[tagId < EmptyTagId ? tagId : EmptyTagId];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    XhtmlElementType::TagId XhtmlElementType::getTagId(const char* typeName)
+    {
+        if (typeName == nullptr)
+            return EmptyTagId;
+        return lookupTagId(typeName, strlen(typeName));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    XhtmlElementType::TagId XhtmlElementType::getTagId(const char* typeName, size_t length)
+    {
+        return lookupTagId(typeName, length);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    XhtmlElementType::TagId XhtmlElementType::getTagId(const char32_t* typeName, size_t length)
+    {
+        return lookupTagId(typeName, length);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    template <typename CharT>
+    XhtmlElementType::TagId XhtmlElementType::lookupTagId(const CharT* typeName, size_t length)
+    {
+        static constexpr TagHashTable hashTable = createTagHashTable(m_dataTypes);
+        static_assert(hashTable.IsCollisionFree, "The tag name hash must map every element type name to a distinct slot!");
+        static_assert(sizeof(m_dataTypes) / sizeof(m_dataTypes[0]) == EmptyTagId + 1u, "The element type 'empty' must be the last one!");
+        static_assert(matchElementFactories(m_dataTypes, ElementFactories), "The element factories must match the element types!");
+
+        if (typeName == nullptr || length == 0 || length > hashTable.MaxLength)
+            return EmptyTagId;
+
+        const TagId tagId = hashTable.TagIds[hashTagName(typeName, length)];
+        return equalTagName(m_dataTypes[tagId].TypeName, typeName, length) ? tagId : EmptyTagId;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -212,112 +426,17 @@ namespace tgui  { namespace xhtml
     XhtmlElement::Ptr XhtmlElement::createAuto(const char* typeName, XhtmlElement::Ptr parent,
         const size_t beginPosition, const size_t endPosition, const bool isParsedAsAutoClosed)
     {
-        XhtmlElement::Ptr element = nullptr;
-        if (tgui::viewEqualIgnoreCase(typeName, XhtmlElementType::DocType) ||
-            tgui::viewEqualIgnoreCase(typeName, XhtmlElementType::Document))
-        {
-            element = std::make_shared<XhtmlElement>(typeName);
-            addChildAndSetPatent(parent, element);
-        }
-        else if (tgui::viewEqualIgnoreCase(typeName, XhtmlElementType::Style))
-            element = XhtmlElement::createStyle(parent);
-        else if (tgui::viewEqualIgnoreCase(typeName, XhtmlElementType::Break))
-            element = XhtmlElement::createBreak(parent);
-        else if (tgui::viewEqualIgnoreCase(typeName, XhtmlElementType::Text))
-            element = XhtmlElement::createInnerText(parent);
-        else if (tgui::viewEqualIgnoreCase(typeName, XhtmlElementType::Html))
-            element = XhtmlElement::createHtml(parent);
-        else if (tgui::viewEqualIgnoreCase(typeName, XhtmlElementType::Head))
-            element = XhtmlElement::createHead(parent);
-        else if (tgui::viewEqualIgnoreCase(typeName, XhtmlElementType::Meta) ||
-                 tgui::viewEqualIgnoreCase(typeName, XhtmlElementType::Link) ||
-                 tgui::viewEqualIgnoreCase(typeName, XhtmlElementType::Title))
-        {
-            element = std::make_shared<XhtmlElement>(typeName);
-            addChildAndSetPatent(parent, element);
-        }
-        else if (tgui::viewEqualIgnoreCase(typeName, XhtmlElementType::Body))
-            element = XhtmlElement::createBody(parent);
-        else if (tgui::viewEqualIgnoreCase(typeName, XhtmlElementType::Input) ||
-                 tgui::viewEqualIgnoreCase(typeName, XhtmlElementType::Label))
-        {
-            element = std::make_shared<XhtmlElement>(typeName);
-            addChildAndSetPatent(parent, element);
-        }
-        else if (tgui::viewEqualIgnoreCase(typeName, XhtmlElementType::H1))
-            element = XhtmlElement::createH1(parent);
-        else if (tgui::viewEqualIgnoreCase(typeName, XhtmlElementType::H2))
-            element = XhtmlElement::createH2(parent);
-        else if (tgui::viewEqualIgnoreCase(typeName, XhtmlElementType::H3))
-            element = XhtmlElement::createH3(parent);
-        else if (tgui::viewEqualIgnoreCase(typeName, XhtmlElementType::H4))
-            element = XhtmlElement::createH4(parent);
-        else if (tgui::viewEqualIgnoreCase(typeName, XhtmlElementType::H5))
-            element = XhtmlElement::createH5(parent);
-        else if (tgui::viewEqualIgnoreCase(typeName, XhtmlElementType::H6))
-            element = XhtmlElement::createH6(parent);
-
-        else if (tgui::viewEqualIgnoreCase(typeName, XhtmlElementType::Emphasized))
-            element = XhtmlElement::createEmphasized(parent);
-        else if (tgui::viewEqualIgnoreCase(typeName, XhtmlElementType::Italic))
-            element = XhtmlElement::createItalic(parent);
-        else if (tgui::viewEqualIgnoreCase(typeName, XhtmlElementType::Strong))
-            element = XhtmlElement::createStrong(parent);
-        else if (tgui::viewEqualIgnoreCase(typeName, XhtmlElementType::Bold))
-            element = XhtmlElement::createBold(parent);
-        else if (tgui::viewEqualIgnoreCase(typeName, XhtmlElementType::Underline))
-            element = XhtmlElement::createUnderline(parent);
-        else if (tgui::viewEqualIgnoreCase(typeName, XhtmlElementType::Superscript))
-            element = XhtmlElement::createSuperscript(parent);
-        else if (tgui::viewEqualIgnoreCase(typeName, XhtmlElementType::Subscript))
-            element = XhtmlElement::createSubscript(parent);
-
-        else if (tgui::viewEqualIgnoreCase(typeName, XhtmlElementType::UnorderedList))
-            element = XhtmlElement::createUnorderedList(parent);
-        else if (tgui::viewEqualIgnoreCase(typeName, XhtmlElementType::OrderedList))
-            element = XhtmlElement::createOrderedList(parent);
-        else if (tgui::viewEqualIgnoreCase(typeName, XhtmlElementType::ListItem))
-            element = XhtmlElement::createListItem(parent);
-
-        else if (tgui::viewEqualIgnoreCase(typeName, XhtmlElementType::Table))
-            element = XhtmlElement::createTable(parent);
-        else if (tgui::viewEqualIgnoreCase(typeName, XhtmlElementType::TableHead))
-            element = XhtmlElement::createTableHead(parent);
-        else if (tgui::viewEqualIgnoreCase(typeName, XhtmlElementType::TableBody))
-            element = XhtmlElement::createTableBody(parent);
-        else if (tgui::viewEqualIgnoreCase(typeName, XhtmlElementType::TableFoot))
-            element = XhtmlElement::createTableFoot(parent);
-        else if (tgui::viewEqualIgnoreCase(typeName, XhtmlElementType::TableRow))
-            element = XhtmlElement::createTableRow(parent);
-        else if (tgui::viewEqualIgnoreCase(typeName, XhtmlElementType::TableHeaderCell))
-            element = XhtmlElement::createTableHeaderCell(parent);
-        else if (tgui::viewEqualIgnoreCase(typeName, XhtmlElementType::TableDataCell))
-            element = XhtmlElement::createTableDataCell(parent);
-
-        else if (tgui::viewEqualIgnoreCase(typeName, XhtmlElementType::Span))
-            element = XhtmlElement::createSpan(parent);
-        else if (tgui::viewEqualIgnoreCase(typeName, XhtmlElementType::Division))
-            element = XhtmlElement::createDivision(parent);
-        else if (tgui::viewEqualIgnoreCase(typeName, XhtmlElementType::Preformatted))
-            element = XhtmlElement::createPreformatted(parent);
-        else if (tgui::viewEqualIgnoreCase(typeName, XhtmlElementType::Code))
-            element = XhtmlElement::createCode(parent);
-        else if (tgui::viewEqualIgnoreCase(typeName, XhtmlElementType::Paragraph))
-            element = XhtmlElement::createParagraph(parent);
-        else if (tgui::viewEqualIgnoreCase(typeName, XhtmlElementType::Anchor))
-            element = XhtmlElement::createAnchor(parent);
-        else if (tgui::viewEqualIgnoreCase(typeName, XhtmlElementType::Image))
-            element = XhtmlElement::createImage(parent);
-        else if (tgui::viewEqualIgnoreCase(typeName, XhtmlElementType::Script))
-        {
-            element = std::make_shared<XhtmlStyleableNoncontainerElement>(XhtmlElementType::Script);
-            addChildAndSetPatent(parent, element);
-        }
-        else
-        {
-            element = std::make_shared<XhtmlElement>(typeName);
-            addChildAndSetPatent(parent, element);
-        }
+        return createAuto(XhtmlElementType::getTagId(typeName), parent, beginPosition, endPosition, isParsedAsAutoClosed);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    XhtmlElement::Ptr XhtmlElement::createAuto(XhtmlElementType::TagId tagId, XhtmlElement::Ptr parent,
+        const size_t beginPosition, const size_t endPosition, const bool isParsedAsAutoClosed)
+    {
+        // The element type 'empty' is the last one, so any invalid tag ID falls back to the generic element.
+        const auto& factory = ElementFactories[tagId < XhtmlElementType::EmptyTagId ? tagId : XhtmlElementType::EmptyTagId];
+        XhtmlElement::Ptr element = factory.Create(factory.TypeName, parent);
         element->setStartTagPositions(beginPosition, endPosition);
         element->setParsedAsAutoClosed(isParsedAsAutoClosed);
         return element;
@@ -327,7 +446,7 @@ namespace tgui  { namespace xhtml
 
     std::shared_ptr<XhtmlStyle> XhtmlElement::createStyle(XhtmlElement::Ptr parent)
     {
-        auto element = std::make_shared<XhtmlStyle>();
+        auto element = XhtmlMemoryResource::makeShared<XhtmlStyle>();
         addChildAndSetPatent(parent, element);
         return element;
     }
@@ -336,7 +455,7 @@ namespace tgui  { namespace xhtml
 
     XhtmlElement::Ptr XhtmlElement::createBreak(XhtmlElement::Ptr parent)
     {
-        auto element = std::make_shared<XhtmlElement>(XhtmlElementType::Break);
+        auto element = XhtmlMemoryResource::makeShared<XhtmlElement>(XhtmlElementType::Break);
         addChildAndSetPatent(parent, element);
         return element;
     }
@@ -345,7 +464,7 @@ namespace tgui  { namespace xhtml
 
     std::shared_ptr<XhtmlInnerText> XhtmlElement::createInnerText(XhtmlElement::Ptr parent)
     {
-        auto element = std::make_shared<XhtmlInnerText>();
+        auto element = XhtmlMemoryResource::makeShared<XhtmlInnerText>();
         addChildAndSetPatent(parent, element);
         return element;
     }
@@ -354,7 +473,7 @@ namespace tgui  { namespace xhtml
 
     std::shared_ptr<XhtmlInnerText> XhtmlElement::createInnerText(XhtmlElement::Ptr parent, String text)
     {
-        auto element = std::make_shared<XhtmlInnerText>(text);
+        auto element = XhtmlMemoryResource::makeShared<XhtmlInnerText>(text);
         addChildAndSetPatent(parent, element);
         return element;
     }
@@ -365,7 +484,7 @@ namespace tgui  { namespace xhtml
 
     std::shared_ptr<XhtmlContainerElement> XhtmlElement::createContainer(const char* elementType, XhtmlElement::Ptr parent, XhtmlElement::Ptr child)
     {
-        auto element = std::make_shared<XhtmlContainerElement>(elementType);
+        auto element = XhtmlMemoryResource::makeShared<XhtmlContainerElement>(elementType);
         addChildAndSetPatent(parent, element);
         addChildAndSetPatent(element, child);
         return element;
@@ -375,7 +494,7 @@ namespace tgui  { namespace xhtml
 
     std::shared_ptr<XhtmlContainerElement> XhtmlElement::createContainer(const char* elementType, XhtmlElement::Ptr parent, const std::vector<XhtmlElement::Ptr> children)
     {
-        auto element = std::make_shared<XhtmlContainerElement>(elementType);
+        auto element = XhtmlMemoryResource::makeShared<XhtmlContainerElement>(elementType);
         addChildAndSetPatent(parent, element);
         addChildrenAndSetPatent(element, children);
         return element;
@@ -387,7 +506,7 @@ namespace tgui  { namespace xhtml
 
     std::shared_ptr<XhtmlStyleableContainerElement> XhtmlElement::createStyleableContainer(const char* elementType, XhtmlElement::Ptr parent, XhtmlElement::Ptr child)
     {
-        auto element = std::make_shared<XhtmlStyleableContainerElement>(elementType);
+        auto element = XhtmlMemoryResource::makeShared<XhtmlStyleableContainerElement>(elementType);
         addChildAndSetPatent(parent, element);
         addChildAndSetPatent(element, child);
         return element;
@@ -397,7 +516,7 @@ namespace tgui  { namespace xhtml
 
     std::shared_ptr<XhtmlStyleableContainerElement> XhtmlElement::createStyleableContainer(const char* elementType, XhtmlElement::Ptr parent, const std::vector<XhtmlElement::Ptr> children)
     {
-        auto element = std::make_shared<XhtmlStyleableContainerElement>(elementType);
+        auto element = XhtmlMemoryResource::makeShared<XhtmlStyleableContainerElement>(elementType);
         addChildAndSetPatent(parent, element);
         addChildrenAndSetPatent(element, children);
         return element;
@@ -407,7 +526,7 @@ namespace tgui  { namespace xhtml
 
     std::shared_ptr<XhtmlStyleableContainerElement> XhtmlElement::createStyleableContainer(const char* elementType, XhtmlElement::Ptr parent, XhtmlStyleEntry::Ptr styleEntry, XhtmlElement::Ptr child)
     {
-        auto element = std::make_shared<XhtmlStyleableContainerElement>(elementType, styleEntry);
+        auto element = XhtmlMemoryResource::makeShared<XhtmlStyleableContainerElement>(elementType, styleEntry);
         addChildAndSetPatent(parent, element);
         addChildAndSetPatent(element, child);
         return element;
@@ -417,7 +536,7 @@ namespace tgui  { namespace xhtml
 
     std::shared_ptr<XhtmlStyleableContainerElement> XhtmlElement::createStyleableContainer(const char* elementType, XhtmlElement::Ptr parent, XhtmlStyleEntry::Ptr styleEntry, const std::vector<XhtmlElement::Ptr> children)
     {
-        auto element = std::make_shared<XhtmlStyleableContainerElement>(elementType, styleEntry);
+        auto element = XhtmlMemoryResource::makeShared<XhtmlStyleableContainerElement>(elementType, styleEntry);
         addChildAndSetPatent(parent, element);
         addChildrenAndSetPatent(element, children);
         return element;
@@ -429,7 +548,7 @@ namespace tgui  { namespace xhtml
 
     std::shared_ptr<XhtmlStyleableContainerElement> XhtmlElement::createBody(XhtmlElement::Ptr parent, XhtmlElement::Ptr child)
     {
-        auto styleEntry = std::make_shared<XhtmlStyleEntry>();
+        auto styleEntry = XhtmlMemoryResource::makeShared<XhtmlStyleEntry>();
         styleEntry->setPadding(FourDimSize(SizeType::Pixel, 8));
 
         return createStyleableContainer(XhtmlElementType::Body, parent, styleEntry, child);
@@ -439,7 +558,7 @@ namespace tgui  { namespace xhtml
 
     std::shared_ptr<XhtmlStyleableContainerElement> XhtmlElement::createBody(XhtmlElement::Ptr parent, const std::vector<XhtmlElement::Ptr> children)
     {
-        auto styleEntry = std::make_shared<XhtmlStyleEntry>();
+        auto styleEntry = XhtmlMemoryResource::makeShared<XhtmlStyleEntry>();
         styleEntry->setPadding(FourDimSize(SizeType::Pixel, 8));
 
         return createStyleableContainer(XhtmlElementType::Body, parent, styleEntry, children);
@@ -471,7 +590,7 @@ namespace tgui  { namespace xhtml
 
     std::shared_ptr<XhtmlListItem> XhtmlElement::createListItem(XhtmlElement::Ptr parent, XhtmlElement::Ptr child)
     {
-        auto element = std::make_shared<XhtmlListItem>();
+        auto element = XhtmlMemoryResource::makeShared<XhtmlListItem>();
         addChildAndSetPatent(parent, element);
         addChildAndSetPatent(element, child);
         return element;
@@ -481,7 +600,7 @@ namespace tgui  { namespace xhtml
 
     std::shared_ptr<XhtmlListItem> XhtmlElement::createListItem(XhtmlElement::Ptr parent, const std::vector<XhtmlElement::Ptr> children)
     {
-        auto element = std::make_shared<XhtmlListItem>();
+        auto element = XhtmlMemoryResource::makeShared<XhtmlListItem>();
         addChildAndSetPatent(parent, element);
         addChildrenAndSetPatent(element, children);
         return element;
@@ -491,7 +610,7 @@ namespace tgui  { namespace xhtml
 
     std::shared_ptr<XhtmlListItem> XhtmlElement::createListItem(XhtmlElement::Ptr parent, const XhtmlStyleEntry::Ptr styleEntry, XhtmlElement::Ptr child)
     {
-        auto element = std::make_shared<XhtmlListItem>(styleEntry);
+        auto element = XhtmlMemoryResource::makeShared<XhtmlListItem>(styleEntry);
         addChildAndSetPatent(parent, element);
         addChildAndSetPatent(element, child);
         return element;
@@ -501,7 +620,7 @@ namespace tgui  { namespace xhtml
 
     std::shared_ptr<XhtmlListItem> XhtmlElement::createListItem(XhtmlElement::Ptr parent, const XhtmlStyleEntry::Ptr styleEntry, const std::vector<XhtmlElement::Ptr> children)
     {
-        auto element = std::make_shared<XhtmlListItem>(styleEntry);
+        auto element = XhtmlMemoryResource::makeShared<XhtmlListItem>(styleEntry);
         addChildAndSetPatent(parent, element);
         addChildrenAndSetPatent(element, children);
         return element;
@@ -513,7 +632,7 @@ namespace tgui  { namespace xhtml
 
     std::shared_ptr<XhtmlStyleableNoncontainerElement> XhtmlElement::createImage(XhtmlElement::Ptr parent)
     {
-        auto element = std::make_shared<XhtmlStyleableNoncontainerElement>(XhtmlElementType::Image);
+        auto element = XhtmlMemoryResource::makeShared<XhtmlStyleableNoncontainerElement>(XhtmlElementType::Image);
         addChildAndSetPatent(parent, element);
         return element;
     }
@@ -522,7 +641,7 @@ namespace tgui  { namespace xhtml
 
     std::shared_ptr<XhtmlStyleableNoncontainerElement> XhtmlElement::createImage(XhtmlElement::Ptr parent, XhtmlStyleEntry::Ptr styleEntry)
     {
-        auto element = std::make_shared<XhtmlStyleableNoncontainerElement>(XhtmlElementType::Image, styleEntry);
+        auto element = XhtmlMemoryResource::makeShared<XhtmlStyleableNoncontainerElement>(XhtmlElementType::Image, styleEntry);
         addChildAndSetPatent(parent, element);
         return element;
     }
@@ -563,6 +682,15 @@ namespace tgui  { namespace xhtml
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    XhtmlMatchedStyle& XhtmlElement::getMatchedStyle() const
+    {
+        if (m_matchedStyle == nullptr)
+            m_matchedStyle = XhtmlMemoryResource::makeShared<XhtmlMatchedStyle>();
+        return *m_matchedStyle;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     XhtmlAttribute::Ptr XhtmlElement::getAttribute(const tgui::String& name) const
     {
         if (m_attributes == nullptr)
@@ -641,6 +769,30 @@ namespace tgui  { namespace xhtml
             return 0;  }
 
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void XhtmlElement::releaseChildren()
+    {
+        if (m_children == nullptr)
+            return;
+
+        std::vector<XhtmlElement::Ptr> pendingElements;
+        pendingElements.swap(*m_children);
+        while (pendingElements.size() > 0)
+        {
+            XhtmlElement::Ptr element = std::move(pendingElements.back());
+            pendingElements.pop_back();
+
+            // adopt the children of an element, that is about to be destroyed, to prevent the recursive destruction
+            if (element.use_count() == 1 && element->m_children != nullptr && element->m_children.use_count() == 1)
+            {
+                for (XhtmlElement::Ptr& child : *element->m_children)
+                    pendingElements.push_back(std::move(child));
+                element->m_children->clear();
+            }
+        }
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     size_t XhtmlElement::countSiblings(XhtmlElement::Ptr element, bool includePreviousSiblings)
@@ -778,7 +930,8 @@ namespace tgui  { namespace xhtml
         XhtmlAttribute::Ptr attribute;
         tgui::String identity = ((attribute = getAttribute(U"id")) != nullptr ? U", id: '" + attribute->getValue() + U"'" :
             ((attribute = getAttribute(U"class")) != nullptr ? U", class: '" + attribute->getValue() + U"'" : U""));
-        tgui::String parent = U", parent: " + (m_parent == nullptr ? U"none" : U"'" + m_parent->getTypeNameU32() + U"'");
+        auto parentElement = m_parent.lock();
+        tgui::String parent = U", parent: " + (parentElement == nullptr ? U"none" : U"'" + parentElement->getTypeNameU32() + U"'");
         tgui::String children = (m_children != nullptr ? U", children: " + tgui::String(m_children->size()) : U"");
 
         tgui::String content = U"";
@@ -808,19 +961,20 @@ namespace tgui  { namespace xhtml
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    const XhtmlElement::Ptr XhtmlElement::createElementFromParseStr(std::vector<std::tuple<MessageType, tgui::String>>& messages,
-        XhtmlElement::Ptr parent, const tgui::String& buffer, const size_t beginPosition,
+    const XhtmlElement::Ptr XhtmlElement::createElementFromParseStr(XhtmlDiagnostics& diagnostics,
+        XhtmlElement::Ptr parent, const XhtmlAttribute::SourcePtr& source, const size_t beginPosition,
         bool& isOpeningTag, bool& isClosingTag, bool& isInsideScript, size_t& processedLength, bool parseInnerText)
     {
         processedLength = 0;
 
-        if (buffer.empty())
+        if (source == nullptr || source->empty())
         {
-            tgui::String message(U"XhtmlElement::createFromParseStr() -> Invalid buffer!");
-            messages.push_back(std::make_tuple(MessageType::ERROR, message));
+            diagnostics.report(XhtmlDiagnosticCode::TagBufferInvalid);
             return nullptr;
         }
 
+        const tgui::String&              buffer = *source;
+
         bool                             elementOpened = false;
         bool                             elementClosed = false;
         tgui::String                     typeName;
@@ -836,8 +990,7 @@ namespace tgui  { namespace xhtml
         // HTML tags always begin with a less-than symbol
         if (buffer[workPosition] != U'<')
         {
-            tgui::String message(U"XhtmlElement::createFromParseStr() -> Invalid start character!");
-            messages.push_back(std::make_tuple(MessageType::ERROR, message));
+            diagnostics.report(XhtmlDiagnosticCode::TagStartInvalid);
             // don't update the processedLength, if no element is created
             return nullptr;
         }
@@ -854,21 +1007,19 @@ namespace tgui  { namespace xhtml
         {
             if (!typeName.empty())
             {
-                tgui::String message(U"XhtmlElement::createFromParseStr() -> Element type name should be empty, but isn't!");
-                messages.push_back(std::make_tuple(MessageType::ERROR, message));
+                diagnostics.report(XhtmlDiagnosticCode::TagTypeNameNotEmpty);
                 // don't update the processedLength, if no element is created
                 return nullptr;
             }
             if (elementClosed)
             {
-                tgui::String message(U"XhtmlElement::createFromParseStr() -> Closing tag should not be reached, but is!");
-                messages.push_back(std::make_tuple(MessageType::ERROR, message));
+                diagnostics.report(XhtmlDiagnosticCode::TagClosingReached);
                 // don't update the processedLength, if no element is created
                 return nullptr;
             }
 
             processedLength = endPosition - workPosition;
-            return createElementFromParseData(messages, isOpeningTag, isClosingTag, elementOpened, elementClosed, typeName,
+            return createElementFromParseData(diagnostics, isOpeningTag, isClosingTag, elementOpened, elementClosed, typeName,
                                               parent, beginPosition, endPosition, attributesBuffer);
         }
 
@@ -884,8 +1035,7 @@ namespace tgui  { namespace xhtml
             }
             else
             {
-                tgui::String message(U"XhtmlElement::createFromParseStr() -> Element type name should start with an alphabet character, but doesn't!");
-                messages.push_back(std::make_tuple(MessageType::ERROR, message));
+                diagnostics.report(XhtmlDiagnosticCode::TagTypeNameStartInvalid);
                 // don't update the processedLength, if no element is created
                 return nullptr;
             }
@@ -912,8 +1062,7 @@ namespace tgui  { namespace xhtml
                 {
                     if (endPosition == workPosition)
                     {
-                        tgui::String message(U"XhtmlElement::createFromParseStr() -> Element is of length 0, but shouldn't!");
-                        messages.push_back(std::make_tuple(MessageType::ERROR, message));
+                        diagnostics.report(XhtmlDiagnosticCode::TagTypeNameEmpty);
                         // don't update the processedLength, if no element is created
                         return nullptr;
                     }
@@ -928,9 +1077,7 @@ namespace tgui  { namespace xhtml
                 }
 
                 // any other character will fail parsing process
-                tgui::String message(U"XhtmlElement::createFromParseStr() -> Element type name should consist of ");
-                message.append(U"alpha-numerical characters, underscores, hyphen, colons and periods only, but doesn't!");
-                messages.push_back(std::make_tuple(MessageType::ERROR, message));
+                diagnostics.report(XhtmlDiagnosticCode::TagTypeNameInvalid);
                 // don't update the processedLength, if no element is created
                 return nullptr;
             }
@@ -948,20 +1095,14 @@ namespace tgui  { namespace xhtml
         {
             if (!elementClosed)
             {
-                tgui::String message(U"XhtmlElement::parseFromStr() -> Element of type '");
-                message.append(typeName).append(U"' (anticipated type is script) should be closed, but isn't!");
-                message.append(U" We assume it is a tag inside the script code and continue.");
-                messages.push_back(std::make_tuple(MessageType::WARNING, message));
+                diagnostics.report(XhtmlDiagnosticCode::ScriptTagNotClosed, typeName);
                 // don't update the processedLength, if no element is created
                 return nullptr;
             }
 
             if (!typeName.equalIgnoreCase(U"script"))
             {
-                tgui::String message(U"XhtmlElement::createFromParseStr() -> Element of type '");
-                message.append(typeName).append(U"' (anticipated type is script) closing tag expected, but isn't!");
-                message.append(U" We assume it is a tag inside the script code and continue.");
-                messages.push_back(std::make_tuple(MessageType::WARNING, message));
+                diagnostics.report(XhtmlDiagnosticCode::ScriptClosingTagExpected, typeName);
                 // don't update the processedLength, if no element is created
                 return nullptr;
             }
@@ -979,9 +1120,7 @@ namespace tgui  { namespace xhtml
             // else will result in parsing failure
             if (buffer[endPosition] != U'>')
             {
-                tgui::String message(U"XhtmlElement::createFromParseStr() -> Element of type '");
-                message.append(typeName).append(U"' closing tag end delimiter expected, but isn't!");
-                messages.push_back(std::make_tuple(MessageType::ERROR, message));
+                diagnostics.report(XhtmlDiagnosticCode::ClosingTagEndExpected, typeName);
                 // don't update the processedLength, if no element is created
                 return nullptr;
             }
@@ -991,14 +1130,12 @@ namespace tgui  { namespace xhtml
 
             if (typeName.empty())
             {
-                tgui::String message(U"XhtmlElement::createFromParseStr() -> Element type name should not be empty "
-                                     U"for the closing tag, but is!");
-                messages.push_back(std::make_tuple(MessageType::ERROR, message));
+                diagnostics.report(XhtmlDiagnosticCode::ClosingTagTypeNameEmpty);
                 // don't update the processedLength, if no element is created
                 return nullptr;
             }
             processedLength = endPosition - beginPosition;
-            return createElementFromParseData(messages, isOpeningTag, isClosingTag, elementOpened, elementClosed, typeName,
+            return createElementFromParseData(diagnostics, isOpeningTag, isClosingTag, elementOpened, elementClosed, typeName,
                                               parent, beginPosition, endPosition, attributesBuffer);
         }
 
@@ -1016,7 +1153,7 @@ namespace tgui  { namespace xhtml
             if (parseInnerText)
             {
                 // delegate parsing process
-                parsedLength = XhtmlElement::createAttributesFromParseStr(messages, attributesBuffer, buffer, workPosition);
+                parsedLength = XhtmlElement::createAttributesFromParseStr(diagnostics, attributesBuffer, source, workPosition);
             }
 
             // attribute (key/value pair) parsing is disabled, returns without any attribute or has parsing error
@@ -1027,11 +1164,10 @@ namespace tgui  { namespace xhtml
                 if (workPosition == std::max(workPosition, buffer.find(U"/>", workPosition)))
                 {
                     // This is either the end of a auto-closing tag (like <br/>) or an error.
-                    if (!XhtmlElementType::getType(cleanTypeName(typeName).toStdString().c_str()).IsAutoClosed)
+                    const auto cleanedTypeName = cleanTypeName(typeName);
+                    if (!XhtmlElementType::getTypeById(XhtmlElementType::getTagId(cleanedTypeName.data(), cleanedTypeName.length())).IsAutoClosed)
                     {
-                        tgui::String message(U"XhtmlElement::createFromParseStr() -> Element of type '");
-                        message.append(typeName).append(U"' should be delimited by '</...>', but is delimited by <.../>!");
-                        messages.push_back(std::make_tuple(MessageType::ERROR, message));
+                        diagnostics.report(XhtmlDiagnosticCode::TagNotAutoClosable, typeName);
                         // don't update the processedLength, if no element is created
                         return nullptr;
                     }
@@ -1050,9 +1186,7 @@ namespace tgui  { namespace xhtml
                 {
                     attributesBuffer.clear();
 
-                    tgui::String message(U"XhtmlElement::createFromParseStr() -> Element of type '");
-                    message.append(typeName).append(U"' should be delimited after the inner text, but isn't (EOF found)!");
-                    messages.push_back(std::make_tuple(MessageType::ERROR, message));
+                    diagnostics.report(XhtmlDiagnosticCode::TagNotDelimitedAfterInnerText, typeName);
                     // don't update the processedLength, if no element is created
                     return nullptr;
                 }
@@ -1063,9 +1197,7 @@ namespace tgui  { namespace xhtml
             {
                 if (!elementOpened)
                 {
-                    tgui::String message(U"XhtmlElement::createFromParseStr() -> Element of type '");
-                    message.append(typeName).append(U"' should be opened before the occurence of the end tag symbol'/', but isn't!");
-                    messages.push_back(std::make_tuple(MessageType::ERROR, message));
+                    diagnostics.report(XhtmlDiagnosticCode::TagNotOpenedBeforeEndSymbol, typeName);
                     // don't update the processedLength, if no element is created
                     return nullptr;
                 }
@@ -1082,9 +1214,7 @@ namespace tgui  { namespace xhtml
         {
             attributesBuffer.clear();
 
-            tgui::String message(U"XhtmlElement::createFromParseStr() -> Element of type '");
-            message.append(typeName).append(U"' should be delimited by '>', but isn't!");
-            messages.push_back(std::make_tuple(MessageType::ERROR, message));
+            diagnostics.report(XhtmlDiagnosticCode::TagNotDelimited, typeName);
             // don't update the processedLength, if no element is created
             return nullptr;
         }
@@ -1092,13 +1222,13 @@ namespace tgui  { namespace xhtml
             endPosition++;
 
         processedLength = endPosition - beginPosition;
-        return createElementFromParseData(messages, isOpeningTag, isClosingTag, elementOpened, elementClosed, typeName,
+        return createElementFromParseData(diagnostics, isOpeningTag, isClosingTag, elementOpened, elementClosed, typeName,
                                           parent, beginPosition, endPosition, attributesBuffer);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    const XhtmlElement::Ptr XhtmlElement::createElementFromParseData(std::vector<std::tuple<MessageType, String>>& messages,
+    const XhtmlElement::Ptr XhtmlElement::createElementFromParseData(XhtmlDiagnostics& diagnostics,
         bool& isOpeningTag, bool& isClosingTag, bool elementOpened, bool elementClosed, tgui::String& typeName,
         XhtmlElement::Ptr& parent, const size_t& beginPosition, const size_t& endPosition,
         std::vector<XhtmlAttribute::Ptr>& attributesBuffer)
@@ -1112,15 +1242,14 @@ namespace tgui  { namespace xhtml
         std::wcout << U"Set name '" << typeName << U"' to" << (isOpeningTag ? " opening" : "") << (isClosingTag ? " closing" : "") << " element with " << attributesBuffer.size() << " attributes.\r\n";
 #endif
 
-        auto element = XhtmlElement::createAuto(typeName.toStdString().c_str(), parent, beginPosition, endPosition, elementClosed && elementOpened);
+        auto element = XhtmlElement::createAuto(XhtmlElementType::getTagId(typeName.data(), typeName.length()), parent,
+                                                beginPosition, endPosition, elementClosed && elementOpened);
         element->addAttributes(attributesBuffer);
         attributesBuffer.clear();
 
-        if (tgui::viewEqualIgnoreCase(element->getTypeName(), "empty"))
+        if (element->getTagId() == XhtmlElementType::EmptyTagId)
         {
-            tgui::String message(U"XhtmlElement::createFromParseData() -> Couldn't recognize element type for tag type '");
-            message.append(typeName).append(U"', continue with 'empty' - but this is unsafe!");
-            messages.push_back(std::make_tuple(MessageType::WARNING, message));
+            diagnostics.report(XhtmlDiagnosticCode::ElementTypeUnknown, typeName);
         }
 
         return element;
@@ -1128,16 +1257,17 @@ namespace tgui  { namespace xhtml
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    size_t XhtmlElement::createAttributesFromParseStr(std::vector<std::tuple<MessageType, String>>& messages,
-        std::vector<XhtmlAttribute::Ptr>& attributes, const tgui::String& buffer, const size_t beginPosition)
+    size_t XhtmlElement::createAttributesFromParseStr(XhtmlDiagnostics& diagnostics,
+        std::vector<XhtmlAttribute::Ptr>& attributes, const XhtmlAttribute::SourcePtr& source, const size_t beginPosition)
     {
-        if (buffer.empty())
+        if (source == nullptr || source->empty())
         {
-            tgui::String message(U"XhtmlElement::parseAttributesFromStr() -> Invalid buffer!");
-            messages.push_back(std::make_tuple(MessageType::ERROR, message));
+            diagnostics.report(XhtmlDiagnosticCode::AttributesBufferInvalid);
             return 0;
         }
 
+        const tgui::String&              buffer = *source;
+
         std::vector<XhtmlAttribute::Ptr> workAttributes;
         const size_t                     remainingPositions = buffer.size() - beginPosition;
         size_t                           offsetFromBegin = 0;
@@ -1146,7 +1276,7 @@ namespace tgui  { namespace xhtml
         do
         {
             // try to parse an attribute/value pair from the rest of the string
-            XhtmlAttribute::Ptr workAttribute = XhtmlAttribute::createFromStr(messages, buffer, beginPosition + offsetFromBegin, offsetFromWorkPosition);
+            XhtmlAttribute::Ptr workAttribute = XhtmlAttribute::createFromStr(diagnostics, source, beginPosition + offsetFromBegin, offsetFromWorkPosition);
             if (offsetFromWorkPosition == 0)
             {
                 // parsing not successful
@@ -1167,6 +1297,9 @@ namespace tgui  { namespace xhtml
         // do we still have something in the buffer to parse?
         while (offsetFromBegin < remainingPositions);
 
+        // the not yet decoded values must not keep the complete buffer alive
+        XhtmlAttribute::sliceSources(workAttributes);
+
         for (XhtmlAttribute::Ptr attribute : workAttributes)
             attributes.push_back(attribute);
         workAttributes.clear();
@@ -1201,31 +1334,9 @@ namespace tgui  { namespace xhtml
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void XhtmlStyle::createEntriesFromParseData(std::vector<std::tuple<MessageType, String>>& messages, const tgui::String& buffer)
+    void XhtmlStyle::createEntriesFromParseData(XhtmlDiagnostics& diagnostics, const tgui::String& buffer)
     {
-        auto styleEntries = StringEx::split(buffer, U'}', true);
-        for (auto styleEntry : styleEntries)
-        {
-            styleEntry = styleEntry.trim();
-
-            if (styleEntry.size() == 0)
-                continue;
-
-            auto styleEntryParts = StringEx::split(styleEntry, U'{', true);
-            if (styleEntryParts.size() != 2)
-                continue;
-
-            styleEntryParts[0] = styleEntryParts[0].trim();
-            styleEntryParts[1] = styleEntryParts[1].trim();
-
-            if (styleEntryParts[0].size() == 0 || styleEntryParts[1].size() == 0)
-                continue;
-
-            auto se = std::make_shared<XhtmlStyleEntry>();
-            se->putValue(messages, styleEntryParts[1]);
-            m_entries[styleEntryParts[0]] = se;
-        }
-        return;
+        m_styleSheet.compile(diagnostics, buffer);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1235,20 +1346,157 @@ namespace tgui  { namespace xhtml
         if (typeName != nullptr && strlen(typeName) > 0 && className.size() > 0)
         {
             tgui::String styleName(typeName); styleName += U"."; styleName += className;
-            return ( m_entries.find(styleName) != m_entries.end() ? m_entries[styleName] : nullptr);
+            return getEntry(styleName);
         }
         else if (typeName != nullptr && (strlen(typeName) > 0))
-        {
-            tgui::String styleName(typeName);
-            return (m_entries.find(styleName) != m_entries.end() ? m_entries[styleName] : nullptr);
-        }
+            return getEntry(tgui::String(typeName));
         else if (className.size() > 0)
+            return getEntry(className);
+
+        return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    namespace
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief The line break classes (a simplified subset of the UAX #14 line break classes)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        enum class LineBreakClass
         {
-            tgui::String styleName = className;
-            return (m_entries.find(styleName) != m_entries.end() ? m_entries[styleName] : nullptr);
+            Other,              //!< Letters, digits and everything without special treatment (AL, NU, ...)
+            Numeric,            //!< Digits (NU)
+            Mandatory,          //!< Line break characters (BK, CR, LF, NL)
+            Space,              //!< Breaking spaces (SP, ZW)
+            Glue,               //!< No-break spaces and joiners (GL, WJ)
+            Hyphen,             //!< The hyphen-minus (HY)
+            BreakAfter,         //!< Hyphens and dashes, that break after them (BA, B2)
+            Ideographic,        //!< Ideographic characters, that break in front of and after them (ID, H2, H3)
+            OpenPunctuation,    //!< Opening punctuation, that doesn't break after it (OP)
+            ClosePunctuation    //!< Closing punctuation and non-starters, that don't break in front of them (CL, CP, EX, IS, NS)
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Determines the line break class of a character
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        LineBreakClass getLineBreakClass(char32_t c)
+        {
+            if (c < 0x80)
+            {
+                switch (c)
+                {
+                case U'\n': case U'\v': case U'\f': case U'\r':
+                    return LineBreakClass::Mandatory;
+                case U' ': case U'\t':
+                    return LineBreakClass::Space;
+                case U'-':
+                    return LineBreakClass::Hyphen;
+                case U'(': case U'[': case U'{':
+                    return LineBreakClass::OpenPunctuation;
+                case U')': case U']': case U'}': case U'!': case U'?': case U',': case U'.': case U':': case U';':
+                    return LineBreakClass::ClosePunctuation;
+                default:
+                    return (c >= U'0' && c <= U'9' ? LineBreakClass::Numeric : LineBreakClass::Other);
+                }
+            }
+
+            switch (c)
+            {
+            case 0x0085: case 0x2028: case 0x2029:
+                return LineBreakClass::Mandatory;
+            case 0x1680: case 0x2008: case 0x2009: case 0x200A: case 0x200B: case 0x205F: case 0x3000:
+                return LineBreakClass::Space;
+            case 0x00A0: case 0x2007: case 0x2011: case 0x202F: case 0x2060: case 0xFEFF:
+                return LineBreakClass::Glue;
+            case 0x00AD: case 0x058A: case 0x2010: case 0x2012: case 0x2013: case 0x2014:
+                return LineBreakClass::BreakAfter;
+            case 0x3008: case 0x300A: case 0x300C: case 0x300E: case 0x3010: case 0x3014: case 0x3016: case 0x3018: case 0x301A:
+            case 0xFF08: case 0xFF3B: case 0xFF5B: case 0xFF5F:
+                return LineBreakClass::OpenPunctuation;
+            case 0x3001: case 0x3002: case 0x3009: case 0x300B: case 0x300D: case 0x300F: case 0x3011: case 0x3015: case 0x3017:
+            case 0x3019: case 0x301B: case 0x3005: case 0x303B: case 0x309D: case 0x309E: case 0x30FB: case 0x30FC: case 0x30FD:
+            case 0x30FE: case 0xFF01: case 0xFF09: case 0xFF0C: case 0xFF0E: case 0xFF1A: case 0xFF1B: case 0xFF1F: case 0xFF3D:
+            case 0xFF5D: case 0xFF60: case 0xFF61: case 0xFF64:
+                return LineBreakClass::ClosePunctuation;
+            // the small kana are non-starters
+            case 0x3041: case 0x3043: case 0x3045: case 0x3047: case 0x3049: case 0x3063: case 0x3083: case 0x3085: case 0x3087:
+            case 0x308E: case 0x3095: case 0x3096: case 0x30A1: case 0x30A3: case 0x30A5: case 0x30A7: case 0x30A9: case 0x30C3:
+            case 0x30E3: case 0x30E5: case 0x30E7: case 0x30EE: case 0x30F5: case 0x30F6:
+                return LineBreakClass::ClosePunctuation;
+            default:
+                break;
+            }
+
+            if (c >= 0x2000 && c <= 0x2006)
+                return LineBreakClass::Space;
+            if ((c >= 0x2E80 && c <= 0x2FFF) || (c >= 0x3040 && c <= 0x31FF) || (c >= 0x3400 && c <= 0x4DBF) ||
+                (c >= 0x4E00 && c <= 0x9FFF) || (c >= 0xA000 && c <= 0xA4CF) || (c >= 0xAC00 && c <= 0xD7A3) ||
+                (c >= 0xF900 && c <= 0xFAFF) || (c >= 0xFF01 && c <= 0xFF60) || (c >= 0x20000 && c <= 0x3FFFD))
+                return LineBreakClass::Ideographic;
+            return LineBreakClass::Other;
         }
+    }
 
-        return nullptr;
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void XhtmlInnerText::findBreakOpportunities(const tgui::String& text, std::vector<XhtmlBreakOpportunity>& opportunities)
+    {
+        opportunities.clear();
+
+        const size_t   size = text.size();
+        LineBreakClass previousClass = LineBreakClass::Mandatory; // the start of text acts like the start of a line
+        size_t         position = 0;
+        while (position < size)
+        {
+            LineBreakClass currentClass = getLineBreakClass(text[position]);
+
+            if (currentClass == LineBreakClass::Mandatory)
+            {
+                opportunities.emplace_back(static_cast<std::uint32_t>(position), static_cast<std::uint32_t>(position + 1), true);
+                previousClass = currentClass;
+                position++;
+                continue;
+            }
+
+            if (currentClass == LineBreakClass::Space)
+            {
+                // a run of spaces is one break opportunity, the spaces are dropped at the line break
+                size_t spacesEnd = position + 1;
+                while (spacesEnd < size && getLineBreakClass(text[spacesEnd]) == LineBreakClass::Space)
+                    spacesEnd++;
+                auto nextClass = (spacesEnd < size ? getLineBreakClass(text[spacesEnd]) : LineBreakClass::Other);
+                if (previousClass != LineBreakClass::OpenPunctuation && nextClass != LineBreakClass::ClosePunctuation)
+                    opportunities.emplace_back(static_cast<std::uint32_t>(position), static_cast<std::uint32_t>(spacesEnd), false);
+                previousClass = LineBreakClass::Space;
+                position = spacesEnd;
+                continue;
+            }
+
+            // a break in front of the current character (spaces and line breaks are already handled)
+            if (position > 0 && previousClass != LineBreakClass::Space && previousClass != LineBreakClass::Mandatory &&
+                previousClass != LineBreakClass::Glue && previousClass != LineBreakClass::OpenPunctuation &&
+                currentClass != LineBreakClass::Glue && currentClass != LineBreakClass::ClosePunctuation &&
+                currentClass != LineBreakClass::Hyphen && currentClass != LineBreakClass::BreakAfter)
+            {
+                bool canBreak = (previousClass == LineBreakClass::Ideographic || currentClass == LineBreakClass::Ideographic ||
+                                 previousClass == LineBreakClass::BreakAfter);
+                // a hyphen breaks after it, but not in front of a number and not at the beginning of a word
+                if (previousClass == LineBreakClass::Hyphen)
+                {
+                    auto beforeHyphenClass = (position > 1 ? getLineBreakClass(text[position - 2]) : LineBreakClass::Mandatory);
+                    canBreak = (currentClass != LineBreakClass::Numeric && beforeHyphenClass != LineBreakClass::Space &&
+                                beforeHyphenClass != LineBreakClass::Mandatory && beforeHyphenClass != LineBreakClass::OpenPunctuation);
+                }
+                if (canBreak)
+                    opportunities.emplace_back(static_cast<std::uint32_t>(position), static_cast<std::uint32_t>(position), false);
+            }
+
+            previousClass = currentClass;
+            position++;
+        }
     }
 
 } }
@@ -1,4 +1,4 @@
-#include <algorithm>
+#include <cstddef>
 #include <cstdint>
 
 #include <TGUI/Config.hpp>
@@ -13,253 +13,2507 @@
 #endif
 #endif
 
-#include "TGUI/Xhtml/StringHelper.hpp"
 #include "TGUI/Xhtml/Dom/XhtmlEntityResolver.hpp"
 
 namespace tgui  { namespace xhtml
 {
+#if TGUI_COMPILED_WITH_CPP_VER < 17 && !defined(_MSC_VER)
+    constexpr unsigned int XhtmlEntityResolver::MaxEntityLength;
+#endif
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    std::map<tgui::String, char32_t> XhtmlEntityResolver::m_charEntityRefs
+    namespace
     {
-        /** C0 Controls and Basic Latin */
-        {  U"quot",    U'\x22'  },
-        {  U"amp",     U'\x26'  },
-        {  U"apos",    U'\x27'  },
-        {  U"lt",      U'\x3C'  },
-        {  U"gt",      U'\x3E'  },
-        /** ISO 8859-1 (Latin-1) characters */
-        {  U"nbsp",    U'\xA0'  },
-        {  U"iexcl",   U'\xA1'  },
-        {  U"cent",    U'\xA2'  },
-        {  U"pound",   U'\xA3'  },
-        {  U"current", U'\xA4'  },
-        {  U"yen",     U'\xA5'  },
-        {  U"brvbar",  U'\xA6'  },
-        {  U"sect",    U'\xA7'  },
-        {  U"uml",     U'\xA8'  },
-        {  U"copy",    U'\xA9'  },
-        {  U"ordf",    U'\xAA'  },
-        {  U"laquo",   U'\xAB'  },
-        {  U"not",     U'\xAC'  },
-        {  U"shy",     U'\xAD'  },
-        {  U"reg",     U'\xAE'  },
-        {  U"macr",    U'\xAF'  },
-        {  U"deg",     U'\xB0'  },
-        {  U"plusmn",  U'\xB1'  },
-        {  U"sup2",    U'\xB2'  },
-        {  U"sup3",    U'\xB3'  },
-        {  U"acute",   U'\xB4'  },
-        {  U"micro",   U'\xB5'  },
-        {  U"para",    U'\xB6'  },
-        {  U"middot",  U'\xB7'  },
-        {  U"cedil",   U'\xB8'  },
-        {  U"sup1",    U'\xB9'  },
-        {  U"ordm",    U'\xBA'  },
-        {  U"raquo",   U'\xBB'  },
-        {  U"frac14",  U'\xBC'  },
-        {  U"frac12",  U'\xBD'  },
-        {  U"frac34",  U'\xBE'  },
-        {  U"iquest",  U'\xBF'  },
-        {  U"Agrave",  U'\xC0'  },
-        {  U"Aacute",  U'\xC1'  },
-        {  U"Acirc",   U'\xC2'  },
-        {  U"Atilde",  U'\xC3'  },
-        {  U"Auml",    U'\xC4'  },
-        {  U"Aring",   U'\xC5'  },
-        {  U"AElig",   U'\xC6'  },
-        {  U"Ccedil",  U'\xC7'  },
-        {  U"Egrave",  U'\xC8'  },
-        {  U"Eacute",  U'\xC9'  },
-        {  U"Ecirc",   U'\xCA'  },
-        {  U"Euml",    U'\xCB'  },
-        {  U"Igrave",  U'\xCC'  },
-        {  U"Iacute",  U'\xCD'  },
-        {  U"Icirc",   U'\xCE'  },
-        {  U"Iuml",    U'\xCF'  },
-        {  U"ETH",     U'\xD0'  },
-        {  U"Ntilde",  U'\xD1'  },
-        {  U"Ograve",  U'\xD2'  },
-        {  U"Oacute",  U'\xD3'  },
-        {  U"Ocirc",   U'\xD4'  },
-        {  U"Otilde",  U'\xD5'  },
-        {  U"Ouml",    U'\xD6'  },
-        {  U"times",   U'\xD7'  },
-        {  U"Oslash",  U'\xD8'  },
-        {  U"Ugrave",  U'\xD9'  },
-        {  U"Uacute",  U'\xDA'  },
-        {  U"Ucirc",   U'\xDB'  },
-        {  U"Uuml",    U'\xDC'  },
-        {  U"Yacute",  U'\xDD'  },
-        {  U"THORN",   U'\xDE'  },
-        {  U"szlig",   U'\xDF'  },
-        {  U"agrave",  U'\xE0'  },
-        {  U"aacute",  U'\xE1'  },
-        {  U"acirc",   U'\xE2'  },
-        {  U"atilde",  U'\xE3'  },
-        {  U"auml",    U'\xE4'  },
-        {  U"aring",   U'\xE5'  },
-        {  U"aelig",   U'\xE6'  },
-        {  U"ccedil",  U'\xE7'  },
-        {  U"egrave",  U'\xE8'  },
-        {  U"eacute",  U'\xE9'  },
-        {  U"ecirc",   U'\xEA'  },
-        {  U"euml",    U'\xEB'  },
-        {  U"igrave",  U'\xEC'  },
-        {  U"iacute",  U'\xED'  },
-        {  U"icirc",   U'\xEE'  },
-        {  U"iuml",    U'\xEF'  },
-        {  U"eth",     U'\xF0'  },
-        {  U"ntilde",  U'\xF1'  },
-        {  U"ograve",  U'\xF2'  },
-        {  U"oacute",  U'\xF3'  },
-        {  U"ocirc",   U'\xF4'  },
-        {  U"otilde",  U'\xF5'  },
-        {  U"ouml",    U'\xF6'  },
-        {  U"divide",  U'\xF7'  },
-        {  U"oslash",  U'\xF8'  },
-        {  U"ugrave",  U'\xF9'  },
-        {  U"uacute",  U'\xFA'  },
-        {  U"ucirc",   U'\xFB'  },
-        {  U"uuml",    U'\xFC'  },
-        {  U"yacute",  U'\xFD'  },
-        {  U"thorn",   U'\xFE'  },
-        {  U"yuml",    U'\xFF'  }
-    };
-
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-    unsigned int XhtmlEntityResolver::resolveEntity(std::vector<std::tuple<tgui::xhtml::MessageType,String>>& messages, const char32_t* encode, char32_t& substitute)
-    {
-        if (m_charEntityRefs.empty())
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Provides one named character reference
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct NamedEntity
         {
-            tgui::String message(U"XhtmlEntityResolver::resolveEntity() -> Entity references not initialized!");
-            messages.push_back(std::make_tuple(MessageType::ERROR, message));
-            return 0;
-        }
+            const char* Name;            //!< The name without the leading '&' (but with the terminating ';', if required)
+            char32_t    Character;       //!< The decoded entity
+            char32_t    SecondCharacter; //!< The second decoded entity, or 0
+        };
 
-        if (encode == nullptr)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief The full HTML5 set of named character references, sorted by name (in byte order)
+        ///
+        /// The sorted table is used as a trie: All names sharing a prefix form a contiguous range of the table, so every trie
+        /// node is a range and the child node for the next character is found by narrowing the range (binary search).
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        constexpr NamedEntity NamedEntities[] =
         {
-            tgui::String message(U"XhtmlEntityResolver::resolveEntity() -> Entity to encode not valid!");
-            messages.push_back(std::make_tuple(MessageType::ERROR, message));
-            return 0;
-        }
+            {  "AElig",                            U'\xC6',     0         },
+            {  "AElig;",                           U'\xC6',     0         },
+            {  "AMP",                              U'\x26',     0         },
+            {  "AMP;",                             U'\x26',     0         },
+            {  "Aacute",                           U'\xC1',     0         },
+            {  "Aacute;",                          U'\xC1',     0         },
+            {  "Abreve;",                          U'\x102',    0         },
+            {  "Acirc",                            U'\xC2',     0         },
+            {  "Acirc;",                           U'\xC2',     0         },
+            {  "Acy;",                             U'\x410',    0         },
+            {  "Afr;",                             U'\x1D504',  0         },
+            {  "Agrave",                           U'\xC0',     0         },
+            {  "Agrave;",                          U'\xC0',     0         },
+            {  "Alpha;",                           U'\x391',    0         },
+            {  "Amacr;",                           U'\x100',    0         },
+            {  "And;",                             U'\x2A53',   0         },
+            {  "Aogon;",                           U'\x104',    0         },
+            {  "Aopf;",                            U'\x1D538',  0         },
+            {  "ApplyFunction;",                   U'\x2061',   0         },
+            {  "Aring",                            U'\xC5',     0         },
+            {  "Aring;",                           U'\xC5',     0         },
+            {  "Ascr;",                            U'\x1D49C',  0         },
+            {  "Assign;",                          U'\x2254',   0         },
+            {  "Atilde",                           U'\xC3',     0         },
+            {  "Atilde;",                          U'\xC3',     0         },
+            {  "Auml",                             U'\xC4',     0         },
+            {  "Auml;",                            U'\xC4',     0         },
+            {  "Backslash;",                       U'\x2216',   0         },
+            {  "Barv;",                            U'\x2AE7',   0         },
+            {  "Barwed;",                          U'\x2306',   0         },
+            {  "Bcy;",                             U'\x411',    0         },
+            {  "Because;",                         U'\x2235',   0         },
+            {  "Bernoullis;",                      U'\x212C',   0         },
+            {  "Beta;",                            U'\x392',    0         },
+            {  "Bfr;",                             U'\x1D505',  0         },
+            {  "Bopf;",                            U'\x1D539',  0         },
+            {  "Breve;",                           U'\x2D8',    0         },
+            {  "Bscr;",                            U'\x212C',   0         },
+            {  "Bumpeq;",                          U'\x224E',   0         },
+            {  "CHcy;",                            U'\x427',    0         },
+            {  "COPY",                             U'\xA9',     0         },
+            {  "COPY;",                            U'\xA9',     0         },
+            {  "Cacute;",                          U'\x106',    0         },
+            {  "Cap;",                             U'\x22D2',   0         },
+            {  "CapitalDifferentialD;",            U'\x2145',   0         },
+            {  "Cayleys;",                         U'\x212D',   0         },
+            {  "Ccaron;",                          U'\x10C',    0         },
+            {  "Ccedil",                           U'\xC7',     0         },
+            {  "Ccedil;",                          U'\xC7',     0         },
+            {  "Ccirc;",                           U'\x108',    0         },
+            {  "Cconint;",                         U'\x2230',   0         },
+            {  "Cdot;",                            U'\x10A',    0         },
+            {  "Cedilla;",                         U'\xB8',     0         },
+            {  "CenterDot;",                       U'\xB7',     0         },
+            {  "Cfr;",                             U'\x212D',   0         },
+            {  "Chi;",                             U'\x3A7',    0         },
+            {  "CircleDot;",                       U'\x2299',   0         },
+            {  "CircleMinus;",                     U'\x2296',   0         },
+            {  "CirclePlus;",                      U'\x2295',   0         },
+            {  "CircleTimes;",                     U'\x2297',   0         },
+            {  "ClockwiseContourIntegral;",        U'\x2232',   0         },
+            {  "CloseCurlyDoubleQuote;",           U'\x201D',   0         },
+            {  "CloseCurlyQuote;",                 U'\x2019',   0         },
+            {  "Colon;",                           U'\x2237',   0         },
+            {  "Colone;",                          U'\x2A74',   0         },
+            {  "Congruent;",                       U'\x2261',   0         },
+            {  "Conint;",                          U'\x222F',   0         },
+            {  "ContourIntegral;",                 U'\x222E',   0         },
+            {  "Copf;",                            U'\x2102',   0         },
+            {  "Coproduct;",                       U'\x2210',   0         },
+            {  "CounterClockwiseContourIntegral;", U'\x2233',   0         },
+            {  "Cross;",                           U'\x2A2F',   0         },
+            {  "Cscr;",                            U'\x1D49E',  0         },
+            {  "Cup;",                             U'\x22D3',   0         },
+            {  "CupCap;",                          U'\x224D',   0         },
+            {  "DD;",                              U'\x2145',   0         },
+            {  "DDotrahd;",                        U'\x2911',   0         },
+            {  "DJcy;",                            U'\x402',    0         },
+            {  "DScy;",                            U'\x405',    0         },
+            {  "DZcy;",                            U'\x40F',    0         },
+            {  "Dagger;",                          U'\x2021',   0         },
+            {  "Darr;",                            U'\x21A1',   0         },
+            {  "Dashv;",                           U'\x2AE4',   0         },
+            {  "Dcaron;",                          U'\x10E',    0         },
+            {  "Dcy;",                             U'\x414',    0         },
+            {  "Del;",                             U'\x2207',   0         },
+            {  "Delta;",                           U'\x394',    0         },
+            {  "Dfr;",                             U'\x1D507',  0         },
+            {  "DiacriticalAcute;",                U'\xB4',     0         },
+            {  "DiacriticalDot;",                  U'\x2D9',    0         },
+            {  "DiacriticalDoubleAcute;",          U'\x2DD',    0         },
+            {  "DiacriticalGrave;",                U'\x60',     0         },
+            {  "DiacriticalTilde;",                U'\x2DC',    0         },
+            {  "Diamond;",                         U'\x22C4',   0         },
+            {  "DifferentialD;",                   U'\x2146',   0         },
+            {  "Dopf;",                            U'\x1D53B',  0         },
+            {  "Dot;",                             U'\xA8',     0         },
+            {  "DotDot;",                          U'\x20DC',   0         },
+            {  "DotEqual;",                        U'\x2250',   0         },
+            {  "DoubleContourIntegral;",           U'\x222F',   0         },
+            {  "DoubleDot;",                       U'\xA8',     0         },
+            {  "DoubleDownArrow;",                 U'\x21D3',   0         },
+            {  "DoubleLeftArrow;",                 U'\x21D0',   0         },
+            {  "DoubleLeftRightArrow;",            U'\x21D4',   0         },
+            {  "DoubleLeftTee;",                   U'\x2AE4',   0         },
+            {  "DoubleLongLeftArrow;",             U'\x27F8',   0         },
+            {  "DoubleLongLeftRightArrow;",        U'\x27FA',   0         },
+            {  "DoubleLongRightArrow;",            U'\x27F9',   0         },
+            {  "DoubleRightArrow;",                U'\x21D2',   0         },
+            {  "DoubleRightTee;",                  U'\x22A8',   0         },
+            {  "DoubleUpArrow;",                   U'\x21D1',   0         },
+            {  "DoubleUpDownArrow;",               U'\x21D5',   0         },
+            {  "DoubleVerticalBar;",               U'\x2225',   0         },
+            {  "DownArrow;",                       U'\x2193',   0         },
+            {  "DownArrowBar;",                    U'\x2913',   0         },
+            {  "DownArrowUpArrow;",                U'\x21F5',   0         },
+            {  "DownBreve;",                       U'\x311',    0         },
+            {  "DownLeftRightVector;",             U'\x2950',   0         },
+            {  "DownLeftTeeVector;",               U'\x295E',   0         },
+            {  "DownLeftVector;",                  U'\x21BD',   0         },
+            {  "DownLeftVectorBar;",               U'\x2956',   0         },
+            {  "DownRightTeeVector;",              U'\x295F',   0         },
+            {  "DownRightVector;",                 U'\x21C1',   0         },
+            {  "DownRightVectorBar;",              U'\x2957',   0         },
+            {  "DownTee;",                         U'\x22A4',   0         },
+            {  "DownTeeArrow;",                    U'\x21A7',   0         },
+            {  "Downarrow;",                       U'\x21D3',   0         },
+            {  "Dscr;",                            U'\x1D49F',  0         },
+            {  "Dstrok;",                          U'\x110',    0         },
+            {  "ENG;",                             U'\x14A',    0         },
+            {  "ETH",                              U'\xD0',     0         },
+            {  "ETH;",                             U'\xD0',     0         },
+            {  "Eacute",                           U'\xC9',     0         },
+            {  "Eacute;",                          U'\xC9',     0         },
+            {  "Ecaron;",                          U'\x11A',    0         },
+            {  "Ecirc",                            U'\xCA',     0         },
+            {  "Ecirc;",                           U'\xCA',     0         },
+            {  "Ecy;",                             U'\x42D',    0         },
+            {  "Edot;",                            U'\x116',    0         },
+            {  "Efr;",                             U'\x1D508',  0         },
+            {  "Egrave",                           U'\xC8',     0         },
+            {  "Egrave;",                          U'\xC8',     0         },
+            {  "Element;",                         U'\x2208',   0         },
+            {  "Emacr;",                           U'\x112',    0         },
+            {  "EmptySmallSquare;",                U'\x25FB',   0         },
+            {  "EmptyVerySmallSquare;",            U'\x25AB',   0         },
+            {  "Eogon;",                           U'\x118',    0         },
+            {  "Eopf;",                            U'\x1D53C',  0         },
+            {  "Epsilon;",                         U'\x395',    0         },
+            {  "Equal;",                           U'\x2A75',   0         },
+            {  "EqualTilde;",                      U'\x2242',   0         },
+            {  "Equilibrium;",                     U'\x21CC',   0         },
+            {  "Escr;",                            U'\x2130',   0         },
+            {  "Esim;",                            U'\x2A73',   0         },
+            {  "Eta;",                             U'\x397',    0         },
+            {  "Euml",                             U'\xCB',     0         },
+            {  "Euml;",                            U'\xCB',     0         },
+            {  "Exists;",                          U'\x2203',   0         },
+            {  "ExponentialE;",                    U'\x2147',   0         },
+            {  "Fcy;",                             U'\x424',    0         },
+            {  "Ffr;",                             U'\x1D509',  0         },
+            {  "FilledSmallSquare;",               U'\x25FC',   0         },
+            {  "FilledVerySmallSquare;",           U'\x25AA',   0         },
+            {  "Fopf;",                            U'\x1D53D',  0         },
+            {  "ForAll;",                          U'\x2200',   0         },
+            {  "Fouriertrf;",                      U'\x2131',   0         },
+            {  "Fscr;",                            U'\x2131',   0         },
+            {  "GJcy;",                            U'\x403',    0         },
+            {  "GT",                               U'\x3E',     0         },
+            {  "GT;",                              U'\x3E',     0         },
+            {  "Gamma;",                           U'\x393',    0         },
+            {  "Gammad;",                          U'\x3DC',    0         },
+            {  "Gbreve;",                          U'\x11E',    0         },
+            {  "Gcedil;",                          U'\x122',    0         },
+            {  "Gcirc;",                           U'\x11C',    0         },
+            {  "Gcy;",                             U'\x413',    0         },
+            {  "Gdot;",                            U'\x120',    0         },
+            {  "Gfr;",                             U'\x1D50A',  0         },
+            {  "Gg;",                              U'\x22D9',   0         },
+            {  "Gopf;",                            U'\x1D53E',  0         },
+            {  "GreaterEqual;",                    U'\x2265',   0         },
+            {  "GreaterEqualLess;",                U'\x22DB',   0         },
+            {  "GreaterFullEqual;",                U'\x2267',   0         },
+            {  "GreaterGreater;",                  U'\x2AA2',   0         },
+            {  "GreaterLess;",                     U'\x2277',   0         },
+            {  "GreaterSlantEqual;",               U'\x2A7E',   0         },
+            {  "GreaterTilde;",                    U'\x2273',   0         },
+            {  "Gscr;",                            U'\x1D4A2',  0         },
+            {  "Gt;",                              U'\x226B',   0         },
+            {  "HARDcy;",                          U'\x42A',    0         },
+            {  "Hacek;",                           U'\x2C7',    0         },
+            {  "Hat;",                             U'\x5E',     0         },
+            {  "Hcirc;",                           U'\x124',    0         },
+            {  "Hfr;",                             U'\x210C',   0         },
+            {  "HilbertSpace;",                    U'\x210B',   0         },
+            {  "Hopf;",                            U'\x210D',   0         },
+            {  "HorizontalLine;",                  U'\x2500',   0         },
+            {  "Hscr;",                            U'\x210B',   0         },
+            {  "Hstrok;",                          U'\x126',    0         },
+            {  "HumpDownHump;",                    U'\x224E',   0         },
+            {  "HumpEqual;",                       U'\x224F',   0         },
+            {  "IEcy;",                            U'\x415',    0         },
+            {  "IJlig;",                           U'\x132',    0         },
+            {  "IOcy;",                            U'\x401',    0         },
+            {  "Iacute",                           U'\xCD',     0         },
+            {  "Iacute;",                          U'\xCD',     0         },
+            {  "Icirc",                            U'\xCE',     0         },
+            {  "Icirc;",                           U'\xCE',     0         },
+            {  "Icy;",                             U'\x418',    0         },
+            {  "Idot;",                            U'\x130',    0         },
+            {  "Ifr;",                             U'\x2111',   0         },
+            {  "Igrave",                           U'\xCC',     0         },
+            {  "Igrave;",                          U'\xCC',     0         },
+            {  "Im;",                              U'\x2111',   0         },
+            {  "Imacr;",                           U'\x12A',    0         },
+            {  "ImaginaryI;",                      U'\x2148',   0         },
+            {  "Implies;",                         U'\x21D2',   0         },
+            {  "Int;",                             U'\x222C',   0         },
+            {  "Integral;",                        U'\x222B',   0         },
+            {  "Intersection;",                    U'\x22C2',   0         },
+            {  "InvisibleComma;",                  U'\x2063',   0         },
+            {  "InvisibleTimes;",                  U'\x2062',   0         },
+            {  "Iogon;",                           U'\x12E',    0         },
+            {  "Iopf;",                            U'\x1D540',  0         },
+            {  "Iota;",                            U'\x399',    0         },
+            {  "Iscr;",                            U'\x2110',   0         },
+            {  "Itilde;",                          U'\x128',    0         },
+            {  "Iukcy;",                           U'\x406',    0         },
+            {  "Iuml",                             U'\xCF',     0         },
+            {  "Iuml;",                            U'\xCF',     0         },
+            {  "Jcirc;",                           U'\x134',    0         },
+            {  "Jcy;",                             U'\x419',    0         },
+            {  "Jfr;",                             U'\x1D50D',  0         },
+            {  "Jopf;",                            U'\x1D541',  0         },
+            {  "Jscr;",                            U'\x1D4A5',  0         },
+            {  "Jsercy;",                          U'\x408',    0         },
+            {  "Jukcy;",                           U'\x404',    0         },
+            {  "KHcy;",                            U'\x425',    0         },
+            {  "KJcy;",                            U'\x40C',    0         },
+            {  "Kappa;",                           U'\x39A',    0         },
+            {  "Kcedil;",                          U'\x136',    0         },
+            {  "Kcy;",                             U'\x41A',    0         },
+            {  "Kfr;",                             U'\x1D50E',  0         },
+            {  "Kopf;",                            U'\x1D542',  0         },
+            {  "Kscr;",                            U'\x1D4A6',  0         },
+            {  "LJcy;",                            U'\x409',    0         },
+            {  "LT",                               U'\x3C',     0         },
+            {  "LT;",                              U'\x3C',     0         },
+            {  "Lacute;",                          U'\x139',    0         },
+            {  "Lambda;",                          U'\x39B',    0         },
+            {  "Lang;",                            U'\x27EA',   0         },
+            {  "Laplacetrf;",                      U'\x2112',   0         },
+            {  "Larr;",                            U'\x219E',   0         },
+            {  "Lcaron;",                          U'\x13D',    0         },
+            {  "Lcedil;",                          U'\x13B',    0         },
+            {  "Lcy;",                             U'\x41B',    0         },
+            {  "LeftAngleBracket;",                U'\x27E8',   0         },
+            {  "LeftArrow;",                       U'\x2190',   0         },
+            {  "LeftArrowBar;",                    U'\x21E4',   0         },
+            {  "LeftArrowRightArrow;",             U'\x21C6',   0         },
+            {  "LeftCeiling;",                     U'\x2308',   0         },
+            {  "LeftDoubleBracket;",               U'\x27E6',   0         },
+            {  "LeftDownTeeVector;",               U'\x2961',   0         },
+            {  "LeftDownVector;",                  U'\x21C3',   0         },
+            {  "LeftDownVectorBar;",               U'\x2959',   0         },
+            {  "LeftFloor;",                       U'\x230A',   0         },
+            {  "LeftRightArrow;",                  U'\x2194',   0         },
+            {  "LeftRightVector;",                 U'\x294E',   0         },
+            {  "LeftTee;",                         U'\x22A3',   0         },
+            {  "LeftTeeArrow;",                    U'\x21A4',   0         },
+            {  "LeftTeeVector;",                   U'\x295A',   0         },
+            {  "LeftTriangle;",                    U'\x22B2',   0         },
+            {  "LeftTriangleBar;",                 U'\x29CF',   0         },
+            {  "LeftTriangleEqual;",               U'\x22B4',   0         },
+            {  "LeftUpDownVector;",                U'\x2951',   0         },
+            {  "LeftUpTeeVector;",                 U'\x2960',   0         },
+            {  "LeftUpVector;",                    U'\x21BF',   0         },
+            {  "LeftUpVectorBar;",                 U'\x2958',   0         },
+            {  "LeftVector;",                      U'\x21BC',   0         },
+            {  "LeftVectorBar;",                   U'\x2952',   0         },
+            {  "Leftarrow;",                       U'\x21D0',   0         },
+            {  "Leftrightarrow;",                  U'\x21D4',   0         },
+            {  "LessEqualGreater;",                U'\x22DA',   0         },
+            {  "LessFullEqual;",                   U'\x2266',   0         },
+            {  "LessGreater;",                     U'\x2276',   0         },
+            {  "LessLess;",                        U'\x2AA1',   0         },
+            {  "LessSlantEqual;",                  U'\x2A7D',   0         },
+            {  "LessTilde;",                       U'\x2272',   0         },
+            {  "Lfr;",                             U'\x1D50F',  0         },
+            {  "Ll;",                              U'\x22D8',   0         },
+            {  "Lleftarrow;",                      U'\x21DA',   0         },
+            {  "Lmidot;",                          U'\x13F',    0         },
+            {  "LongLeftArrow;",                   U'\x27F5',   0         },
+            {  "LongLeftRightArrow;",              U'\x27F7',   0         },
+            {  "LongRightArrow;",                  U'\x27F6',   0         },
+            {  "Longleftarrow;",                   U'\x27F8',   0         },
+            {  "Longleftrightarrow;",              U'\x27FA',   0         },
+            {  "Longrightarrow;",                  U'\x27F9',   0         },
+            {  "Lopf;",                            U'\x1D543',  0         },
+            {  "LowerLeftArrow;",                  U'\x2199',   0         },
+            {  "LowerRightArrow;",                 U'\x2198',   0         },
+            {  "Lscr;",                            U'\x2112',   0         },
+            {  "Lsh;",                             U'\x21B0',   0         },
+            {  "Lstrok;",                          U'\x141',    0         },
+            {  "Lt;",                              U'\x226A',   0         },
+            {  "Map;",                             U'\x2905',   0         },
+            {  "Mcy;",                             U'\x41C',    0         },
+            {  "MediumSpace;",                     U'\x205F',   0         },
+            {  "Mellintrf;",                       U'\x2133',   0         },
+            {  "Mfr;",                             U'\x1D510',  0         },
+            {  "MinusPlus;",                       U'\x2213',   0         },
+            {  "Mopf;",                            U'\x1D544',  0         },
+            {  "Mscr;",                            U'\x2133',   0         },
+            {  "Mu;",                              U'\x39C',    0         },
+            {  "NJcy;",                            U'\x40A',    0         },
+            {  "Nacute;",                          U'\x143',    0         },
+            {  "Ncaron;",                          U'\x147',    0         },
+            {  "Ncedil;",                          U'\x145',    0         },
+            {  "Ncy;",                             U'\x41D',    0         },
+            {  "NegativeMediumSpace;",             U'\x200B',   0         },
+            {  "NegativeThickSpace;",              U'\x200B',   0         },
+            {  "NegativeThinSpace;",               U'\x200B',   0         },
+            {  "NegativeVeryThinSpace;",           U'\x200B',   0         },
+            {  "NestedGreaterGreater;",            U'\x226B',   0         },
+            {  "NestedLessLess;",                  U'\x226A',   0         },
+            {  "NewLine;",                         U'\xA',      0         },
+            {  "Nfr;",                             U'\x1D511',  0         },
+            {  "NoBreak;",                         U'\x2060',   0         },
+            {  "NonBreakingSpace;",                U'\xA0',     0         },
+            {  "Nopf;",                            U'\x2115',   0         },
+            {  "Not;",                             U'\x2AEC',   0         },
+            {  "NotCongruent;",                    U'\x2262',   0         },
+            {  "NotCupCap;",                       U'\x226D',   0         },
+            {  "NotDoubleVerticalBar;",            U'\x2226',   0         },
+            {  "NotElement;",                      U'\x2209',   0         },
+            {  "NotEqual;",                        U'\x2260',   0         },
+            {  "NotEqualTilde;",                   U'\x2242',   U'\x338'  },
+            {  "NotExists;",                       U'\x2204',   0         },
+            {  "NotGreater;",                      U'\x226F',   0         },
+            {  "NotGreaterEqual;",                 U'\x2271',   0         },
+            {  "NotGreaterFullEqual;",             U'\x2267',   U'\x338'  },
+            {  "NotGreaterGreater;",               U'\x226B',   U'\x338'  },
+            {  "NotGreaterLess;",                  U'\x2279',   0         },
+            {  "NotGreaterSlantEqual;",            U'\x2A7E',   U'\x338'  },
+            {  "NotGreaterTilde;",                 U'\x2275',   0         },
+            {  "NotHumpDownHump;",                 U'\x224E',   U'\x338'  },
+            {  "NotHumpEqual;",                    U'\x224F',   U'\x338'  },
+            {  "NotLeftTriangle;",                 U'\x22EA',   0         },
+            {  "NotLeftTriangleBar;",              U'\x29CF',   U'\x338'  },
+            {  "NotLeftTriangleEqual;",            U'\x22EC',   0         },
+            {  "NotLess;",                         U'\x226E',   0         },
+            {  "NotLessEqual;",                    U'\x2270',   0         },
+            {  "NotLessGreater;",                  U'\x2278',   0         },
+            {  "NotLessLess;",                     U'\x226A',   U'\x338'  },
+            {  "NotLessSlantEqual;",               U'\x2A7D',   U'\x338'  },
+            {  "NotLessTilde;",                    U'\x2274',   0         },
+            {  "NotNestedGreaterGreater;",         U'\x2AA2',   U'\x338'  },
+            {  "NotNestedLessLess;",               U'\x2AA1',   U'\x338'  },
+            {  "NotPrecedes;",                     U'\x2280',   0         },
+            {  "NotPrecedesEqual;",                U'\x2AAF',   U'\x338'  },
+            {  "NotPrecedesSlantEqual;",           U'\x22E0',   0         },
+            {  "NotReverseElement;",               U'\x220C',   0         },
+            {  "NotRightTriangle;",                U'\x22EB',   0         },
+            {  "NotRightTriangleBar;",             U'\x29D0',   U'\x338'  },
+            {  "NotRightTriangleEqual;",           U'\x22ED',   0         },
+            {  "NotSquareSubset;",                 U'\x228F',   U'\x338'  },
+            {  "NotSquareSubsetEqual;",            U'\x22E2',   0         },
+            {  "NotSquareSuperset;",               U'\x2290',   U'\x338'  },
+            {  "NotSquareSupersetEqual;",          U'\x22E3',   0         },
+            {  "NotSubset;",                       U'\x2282',   U'\x20D2' },
+            {  "NotSubsetEqual;",                  U'\x2288',   0         },
+            {  "NotSucceeds;",                     U'\x2281',   0         },
+            {  "NotSucceedsEqual;",                U'\x2AB0',   U'\x338'  },
+            {  "NotSucceedsSlantEqual;",           U'\x22E1',   0         },
+            {  "NotSucceedsTilde;",                U'\x227F',   U'\x338'  },
+            {  "NotSuperset;",                     U'\x2283',   U'\x20D2' },
+            {  "NotSupersetEqual;",                U'\x2289',   0         },
+            {  "NotTilde;",                        U'\x2241',   0         },
+            {  "NotTildeEqual;",                   U'\x2244',   0         },
+            {  "NotTildeFullEqual;",               U'\x2247',   0         },
+            {  "NotTildeTilde;",                   U'\x2249',   0         },
+            {  "NotVerticalBar;",                  U'\x2224',   0         },
+            {  "Nscr;",                            U'\x1D4A9',  0         },
+            {  "Ntilde",                           U'\xD1',     0         },
+            {  "Ntilde;",                          U'\xD1',     0         },
+            {  "Nu;",                              U'\x39D',    0         },
+            {  "OElig;",                           U'\x152',    0         },
+            {  "Oacute",                           U'\xD3',     0         },
+            {  "Oacute;",                          U'\xD3',     0         },
+            {  "Ocirc",                            U'\xD4',     0         },
+            {  "Ocirc;",                           U'\xD4',     0         },
+            {  "Ocy;",                             U'\x41E',    0         },
+            {  "Odblac;",                          U'\x150',    0         },
+            {  "Ofr;",                             U'\x1D512',  0         },
+            {  "Ograve",                           U'\xD2',     0         },
+            {  "Ograve;",                          U'\xD2',     0         },
+            {  "Omacr;",                           U'\x14C',    0         },
+            {  "Omega;",                           U'\x3A9',    0         },
+            {  "Omicron;",                         U'\x39F',    0         },
+            {  "Oopf;",                            U'\x1D546',  0         },
+            {  "OpenCurlyDoubleQuote;",            U'\x201C',   0         },
+            {  "OpenCurlyQuote;",                  U'\x2018',   0         },
+            {  "Or;",                              U'\x2A54',   0         },
+            {  "Oscr;",                            U'\x1D4AA',  0         },
+            {  "Oslash",                           U'\xD8',     0         },
+            {  "Oslash;",                          U'\xD8',     0         },
+            {  "Otilde",                           U'\xD5',     0         },
+            {  "Otilde;",                          U'\xD5',     0         },
+            {  "Otimes;",                          U'\x2A37',   0         },
+            {  "Ouml",                             U'\xD6',     0         },
+            {  "Ouml;",                            U'\xD6',     0         },
+            {  "OverBar;",                         U'\x203E',   0         },
+            {  "OverBrace;",                       U'\x23DE',   0         },
+            {  "OverBracket;",                     U'\x23B4',   0         },
+            {  "OverParenthesis;",                 U'\x23DC',   0         },
+            {  "PartialD;",                        U'\x2202',   0         },
+            {  "Pcy;",                             U'\x41F',    0         },
+            {  "Pfr;",                             U'\x1D513',  0         },
+            {  "Phi;",                             U'\x3A6',    0         },
+            {  "Pi;",                              U'\x3A0',    0         },
+            {  "PlusMinus;",                       U'\xB1',     0         },
+            {  "Poincareplane;",                   U'\x210C',   0         },
+            {  "Popf;",                            U'\x2119',   0         },
+            {  "Pr;",                              U'\x2ABB',   0         },
+            {  "Precedes;",                        U'\x227A',   0         },
+            {  "PrecedesEqual;",                   U'\x2AAF',   0         },
+            {  "PrecedesSlantEqual;",              U'\x227C',   0         },
+            {  "PrecedesTilde;",                   U'\x227E',   0         },
+            {  "Prime;",                           U'\x2033',   0         },
+            {  "Product;",                         U'\x220F',   0         },
+            {  "Proportion;",                      U'\x2237',   0         },
+            {  "Proportional;",                    U'\x221D',   0         },
+            {  "Pscr;",                            U'\x1D4AB',  0         },
+            {  "Psi;",                             U'\x3A8',    0         },
+            {  "QUOT",                             U'\x22',     0         },
+            {  "QUOT;",                            U'\x22',     0         },
+            {  "Qfr;",                             U'\x1D514',  0         },
+            {  "Qopf;",                            U'\x211A',   0         },
+            {  "Qscr;",                            U'\x1D4AC',  0         },
+            {  "RBarr;",                           U'\x2910',   0         },
+            {  "REG",                              U'\xAE',     0         },
+            {  "REG;",                             U'\xAE',     0         },
+            {  "Racute;",                          U'\x154',    0         },
+            {  "Rang;",                            U'\x27EB',   0         },
+            {  "Rarr;",                            U'\x21A0',   0         },
+            {  "Rarrtl;",                          U'\x2916',   0         },
+            {  "Rcaron;",                          U'\x158',    0         },
+            {  "Rcedil;",                          U'\x156',    0         },
+            {  "Rcy;",                             U'\x420',    0         },
+            {  "Re;",                              U'\x211C',   0         },
+            {  "ReverseElement;",                  U'\x220B',   0         },
+            {  "ReverseEquilibrium;",              U'\x21CB',   0         },
+            {  "ReverseUpEquilibrium;",            U'\x296F',   0         },
+            {  "Rfr;",                             U'\x211C',   0         },
+            {  "Rho;",                             U'\x3A1',    0         },
+            {  "RightAngleBracket;",               U'\x27E9',   0         },
+            {  "RightArrow;",                      U'\x2192',   0         },
+            {  "RightArrowBar;",                   U'\x21E5',   0         },
+            {  "RightArrowLeftArrow;",             U'\x21C4',   0         },
+            {  "RightCeiling;",                    U'\x2309',   0         },
+            {  "RightDoubleBracket;",              U'\x27E7',   0         },
+            {  "RightDownTeeVector;",              U'\x295D',   0         },
+            {  "RightDownVector;",                 U'\x21C2',   0         },
+            {  "RightDownVectorBar;",              U'\x2955',   0         },
+            {  "RightFloor;",                      U'\x230B',   0         },
+            {  "RightTee;",                        U'\x22A2',   0         },
+            {  "RightTeeArrow;",                   U'\x21A6',   0         },
+            {  "RightTeeVector;",                  U'\x295B',   0         },
+            {  "RightTriangle;",                   U'\x22B3',   0         },
+            {  "RightTriangleBar;",                U'\x29D0',   0         },
+            {  "RightTriangleEqual;",              U'\x22B5',   0         },
+            {  "RightUpDownVector;",               U'\x294F',   0         },
+            {  "RightUpTeeVector;",                U'\x295C',   0         },
+            {  "RightUpVector;",                   U'\x21BE',   0         },
+            {  "RightUpVectorBar;",                U'\x2954',   0         },
+            {  "RightVector;",                     U'\x21C0',   0         },
+            {  "RightVectorBar;",                  U'\x2953',   0         },
+            {  "Rightarrow;",                      U'\x21D2',   0         },
+            {  "Ropf;",                            U'\x211D',   0         },
+            {  "RoundImplies;",                    U'\x2970',   0         },
+            {  "Rrightarrow;",                     U'\x21DB',   0         },
+            {  "Rscr;",                            U'\x211B',   0         },
+            {  "Rsh;",                             U'\x21B1',   0         },
+            {  "RuleDelayed;",                     U'\x29F4',   0         },
+            {  "SHCHcy;",                          U'\x429',    0         },
+            {  "SHcy;",                            U'\x428',    0         },
+            {  "SOFTcy;",                          U'\x42C',    0         },
+            {  "Sacute;",                          U'\x15A',    0         },
+            {  "Sc;",                              U'\x2ABC',   0         },
+            {  "Scaron;",                          U'\x160',    0         },
+            {  "Scedil;",                          U'\x15E',    0         },
+            {  "Scirc;",                           U'\x15C',    0         },
+            {  "Scy;",                             U'\x421',    0         },
+            {  "Sfr;",                             U'\x1D516',  0         },
+            {  "ShortDownArrow;",                  U'\x2193',   0         },
+            {  "ShortLeftArrow;",                  U'\x2190',   0         },
+            {  "ShortRightArrow;",                 U'\x2192',   0         },
+            {  "ShortUpArrow;",                    U'\x2191',   0         },
+            {  "Sigma;",                           U'\x3A3',    0         },
+            {  "SmallCircle;",                     U'\x2218',   0         },
+            {  "Sopf;",                            U'\x1D54A',  0         },
+            {  "Sqrt;",                            U'\x221A',   0         },
+            {  "Square;",                          U'\x25A1',   0         },
+            {  "SquareIntersection;",              U'\x2293',   0         },
+            {  "SquareSubset;",                    U'\x228F',   0         },
+            {  "SquareSubsetEqual;",               U'\x2291',   0         },
+            {  "SquareSuperset;",                  U'\x2290',   0         },
+            {  "SquareSupersetEqual;",             U'\x2292',   0         },
+            {  "SquareUnion;",                     U'\x2294',   0         },
+            {  "Sscr;",                            U'\x1D4AE',  0         },
+            {  "Star;",                            U'\x22C6',   0         },
+            {  "Sub;",                             U'\x22D0',   0         },
+            {  "Subset;",                          U'\x22D0',   0         },
+            {  "SubsetEqual;",                     U'\x2286',   0         },
+            {  "Succeeds;",                        U'\x227B',   0         },
+            {  "SucceedsEqual;",                   U'\x2AB0',   0         },
+            {  "SucceedsSlantEqual;",              U'\x227D',   0         },
+            {  "SucceedsTilde;",                   U'\x227F',   0         },
+            {  "SuchThat;",                        U'\x220B',   0         },
+            {  "Sum;",                             U'\x2211',   0         },
+            {  "Sup;",                             U'\x22D1',   0         },
+            {  "Superset;",                        U'\x2283',   0         },
+            {  "SupersetEqual;",                   U'\x2287',   0         },
+            {  "Supset;",                          U'\x22D1',   0         },
+            {  "THORN",                            U'\xDE',     0         },
+            {  "THORN;",                           U'\xDE',     0         },
+            {  "TRADE;",                           U'\x2122',   0         },
+            {  "TSHcy;",                           U'\x40B',    0         },
+            {  "TScy;",                            U'\x426',    0         },
+            {  "Tab;",                             U'\x9',      0         },
+            {  "Tau;",                             U'\x3A4',    0         },
+            {  "Tcaron;",                          U'\x164',    0         },
+            {  "Tcedil;",                          U'\x162',    0         },
+            {  "Tcy;",                             U'\x422',    0         },
+            {  "Tfr;",                             U'\x1D517',  0         },
+            {  "Therefore;",                       U'\x2234',   0         },
+            {  "Theta;",                           U'\x398',    0         },
+            {  "ThickSpace;",                      U'\x205F',   U'\x200A' },
+            {  "ThinSpace;",                       U'\x2009',   0         },
+            {  "Tilde;",                           U'\x223C',   0         },
+            {  "TildeEqual;",                      U'\x2243',   0         },
+            {  "TildeFullEqual;",                  U'\x2245',   0         },
+            {  "TildeTilde;",                      U'\x2248',   0         },
+            {  "Topf;",                            U'\x1D54B',  0         },
+            {  "TripleDot;",                       U'\x20DB',   0         },
+            {  "Tscr;",                            U'\x1D4AF',  0         },
+            {  "Tstrok;",                          U'\x166',    0         },
+            {  "Uacute",                           U'\xDA',     0         },
+            {  "Uacute;",                          U'\xDA',     0         },
+            {  "Uarr;",                            U'\x219F',   0         },
+            {  "Uarrocir;",                        U'\x2949',   0         },
+            {  "Ubrcy;",                           U'\x40E',    0         },
+            {  "Ubreve;",                          U'\x16C',    0         },
+            {  "Ucirc",                            U'\xDB',     0         },
+            {  "Ucirc;",                           U'\xDB',     0         },
+            {  "Ucy;",                             U'\x423',    0         },
+            {  "Udblac;",                          U'\x170',    0         },
+            {  "Ufr;",                             U'\x1D518',  0         },
+            {  "Ugrave",                           U'\xD9',     0         },
+            {  "Ugrave;",                          U'\xD9',     0         },
+            {  "Umacr;",                           U'\x16A',    0         },
+            {  "UnderBar;",                        U'\x5F',     0         },
+            {  "UnderBrace;",                      U'\x23DF',   0         },
+            {  "UnderBracket;",                    U'\x23B5',   0         },
+            {  "UnderParenthesis;",                U'\x23DD',   0         },
+            {  "Union;",                           U'\x22C3',   0         },
+            {  "UnionPlus;",                       U'\x228E',   0         },
+            {  "Uogon;",                           U'\x172',    0         },
+            {  "Uopf;",                            U'\x1D54C',  0         },
+            {  "UpArrow;",                         U'\x2191',   0         },
+            {  "UpArrowBar;",                      U'\x2912',   0         },
+            {  "UpArrowDownArrow;",                U'\x21C5',   0         },
+            {  "UpDownArrow;",                     U'\x2195',   0         },
+            {  "UpEquilibrium;",                   U'\x296E',   0         },
+            {  "UpTee;",                           U'\x22A5',   0         },
+            {  "UpTeeArrow;",                      U'\x21A5',   0         },
+            {  "Uparrow;",                         U'\x21D1',   0         },
+            {  "Updownarrow;",                     U'\x21D5',   0         },
+            {  "UpperLeftArrow;",                  U'\x2196',   0         },
+            {  "UpperRightArrow;",                 U'\x2197',   0         },
+            {  "Upsi;",                            U'\x3D2',    0         },
+            {  "Upsilon;",                         U'\x3A5',    0         },
+            {  "Uring;",                           U'\x16E',    0         },
+            {  "Uscr;",                            U'\x1D4B0',  0         },
+            {  "Utilde;",                          U'\x168',    0         },
+            {  "Uuml",                             U'\xDC',     0         },
+            {  "Uuml;",                            U'\xDC',     0         },
+            {  "VDash;",                           U'\x22AB',   0         },
+            {  "Vbar;",                            U'\x2AEB',   0         },
+            {  "Vcy;",                             U'\x412',    0         },
+            {  "Vdash;",                           U'\x22A9',   0         },
+            {  "Vdashl;",                          U'\x2AE6',   0         },
+            {  "Vee;",                             U'\x22C1',   0         },
+            {  "Verbar;",                          U'\x2016',   0         },
+            {  "Vert;",                            U'\x2016',   0         },
+            {  "VerticalBar;",                     U'\x2223',   0         },
+            {  "VerticalLine;",                    U'\x7C',     0         },
+            {  "VerticalSeparator;",               U'\x2758',   0         },
+            {  "VerticalTilde;",                   U'\x2240',   0         },
+            {  "VeryThinSpace;",                   U'\x200A',   0         },
+            {  "Vfr;",                             U'\x1D519',  0         },
+            {  "Vopf;",                            U'\x1D54D',  0         },
+            {  "Vscr;",                            U'\x1D4B1',  0         },
+            {  "Vvdash;",                          U'\x22AA',   0         },
+            {  "Wcirc;",                           U'\x174',    0         },
+            {  "Wedge;",                           U'\x22C0',   0         },
+            {  "Wfr;",                             U'\x1D51A',  0         },
+            {  "Wopf;",                            U'\x1D54E',  0         },
+            {  "Wscr;",                            U'\x1D4B2',  0         },
+            {  "Xfr;",                             U'\x1D51B',  0         },
+            {  "Xi;",                              U'\x39E',    0         },
+            {  "Xopf;",                            U'\x1D54F',  0         },
+            {  "Xscr;",                            U'\x1D4B3',  0         },
+            {  "YAcy;",                            U'\x42F',    0         },
+            {  "YIcy;",                            U'\x407',    0         },
+            {  "YUcy;",                            U'\x42E',    0         },
+            {  "Yacute",                           U'\xDD',     0         },
+            {  "Yacute;",                          U'\xDD',     0         },
+            {  "Ycirc;",                           U'\x176',    0         },
+            {  "Ycy;",                             U'\x42B',    0         },
+            {  "Yfr;",                             U'\x1D51C',  0         },
+            {  "Yopf;",                            U'\x1D550',  0         },
+            {  "Yscr;",                            U'\x1D4B4',  0         },
+            {  "Yuml;",                            U'\x178',    0         },
+            {  "ZHcy;",                            U'\x416',    0         },
+            {  "Zacute;",                          U'\x179',    0         },
+            {  "Zcaron;",                          U'\x17D',    0         },
+            {  "Zcy;",                             U'\x417',    0         },
+            {  "Zdot;",                            U'\x17B',    0         },
+            {  "ZeroWidthSpace;",                  U'\x200B',   0         },
+            {  "Zeta;",                            U'\x396',    0         },
+            {  "Zfr;",                             U'\x2128',   0         },
+            {  "Zopf;",                            U'\x2124',   0         },
+            {  "Zscr;",                            U'\x1D4B5',  0         },
+            {  "aacute",                           U'\xE1',     0         },
+            {  "aacute;",                          U'\xE1',     0         },
+            {  "abreve;",                          U'\x103',    0         },
+            {  "ac;",                              U'\x223E',   0         },
+            {  "acE;",                             U'\x223E',   U'\x333'  },
+            {  "acd;",                             U'\x223F',   0         },
+            {  "acirc",                            U'\xE2',     0         },
+            {  "acirc;",                           U'\xE2',     0         },
+            {  "acute",                            U'\xB4',     0         },
+            {  "acute;",                           U'\xB4',     0         },
+            {  "acy;",                             U'\x430',    0         },
+            {  "aelig",                            U'\xE6',     0         },
+            {  "aelig;",                           U'\xE6',     0         },
+            {  "af;",                              U'\x2061',   0         },
+            {  "afr;",                             U'\x1D51E',  0         },
+            {  "agrave",                           U'\xE0',     0         },
+            {  "agrave;",                          U'\xE0',     0         },
+            {  "alefsym;",                         U'\x2135',   0         },
+            {  "aleph;",                           U'\x2135',   0         },
+            {  "alpha;",                           U'\x3B1',    0         },
+            {  "amacr;",                           U'\x101',    0         },
+            {  "amalg;",                           U'\x2A3F',   0         },
+            {  "amp",                              U'\x26',     0         },
+            {  "amp;",                             U'\x26',     0         },
+            {  "and;",                             U'\x2227',   0         },
+            {  "andand;",                          U'\x2A55',   0         },
+            {  "andd;",                            U'\x2A5C',   0         },
+            {  "andslope;",                        U'\x2A58',   0         },
+            {  "andv;",                            U'\x2A5A',   0         },
+            {  "ang;",                             U'\x2220',   0         },
+            {  "ange;",                            U'\x29A4',   0         },
+            {  "angle;",                           U'\x2220',   0         },
+            {  "angmsd;",                          U'\x2221',   0         },
+            {  "angmsdaa;",                        U'\x29A8',   0         },
+            {  "angmsdab;",                        U'\x29A9',   0         },
+            {  "angmsdac;",                        U'\x29AA',   0         },
+            {  "angmsdad;",                        U'\x29AB',   0         },
+            {  "angmsdae;",                        U'\x29AC',   0         },
+            {  "angmsdaf;",                        U'\x29AD',   0         },
+            {  "angmsdag;",                        U'\x29AE',   0         },
+            {  "angmsdah;",                        U'\x29AF',   0         },
+            {  "angrt;",                           U'\x221F',   0         },
+            {  "angrtvb;",                         U'\x22BE',   0         },
+            {  "angrtvbd;",                        U'\x299D',   0         },
+            {  "angsph;",                          U'\x2222',   0         },
+            {  "angst;",                           U'\xC5',     0         },
+            {  "angzarr;",                         U'\x237C',   0         },
+            {  "aogon;",                           U'\x105',    0         },
+            {  "aopf;",                            U'\x1D552',  0         },
+            {  "ap;",                              U'\x2248',   0         },
+            {  "apE;",                             U'\x2A70',   0         },
+            {  "apacir;",                          U'\x2A6F',   0         },
+            {  "ape;",                             U'\x224A',   0         },
+            {  "apid;",                            U'\x224B',   0         },
+            {  "apos;",                            U'\x27',     0         },
+            {  "approx;",                          U'\x2248',   0         },
+            {  "approxeq;",                        U'\x224A',   0         },
+            {  "aring",                            U'\xE5',     0         },
+            {  "aring;",                           U'\xE5',     0         },
+            {  "ascr;",                            U'\x1D4B6',  0         },
+            {  "ast;",                             U'\x2A',     0         },
+            {  "asymp;",                           U'\x2248',   0         },
+            {  "asympeq;",                         U'\x224D',   0         },
+            {  "atilde",                           U'\xE3',     0         },
+            {  "atilde;",                          U'\xE3',     0         },
+            {  "auml",                             U'\xE4',     0         },
+            {  "auml;",                            U'\xE4',     0         },
+            {  "awconint;",                        U'\x2233',   0         },
+            {  "awint;",                           U'\x2A11',   0         },
+            {  "bNot;",                            U'\x2AED',   0         },
+            {  "backcong;",                        U'\x224C',   0         },
+            {  "backepsilon;",                     U'\x3F6',    0         },
+            {  "backprime;",                       U'\x2035',   0         },
+            {  "backsim;",                         U'\x223D',   0         },
+            {  "backsimeq;",                       U'\x22CD',   0         },
+            {  "barvee;",                          U'\x22BD',   0         },
+            {  "barwed;",                          U'\x2305',   0         },
+            {  "barwedge;",                        U'\x2305',   0         },
+            {  "bbrk;",                            U'\x23B5',   0         },
+            {  "bbrktbrk;",                        U'\x23B6',   0         },
+            {  "bcong;",                           U'\x224C',   0         },
+            {  "bcy;",                             U'\x431',    0         },
+            {  "bdquo;",                           U'\x201E',   0         },
+            {  "becaus;",                          U'\x2235',   0         },
+            {  "because;",                         U'\x2235',   0         },
+            {  "bemptyv;",                         U'\x29B0',   0         },
+            {  "bepsi;",                           U'\x3F6',    0         },
+            {  "bernou;",                          U'\x212C',   0         },
+            {  "beta;",                            U'\x3B2',    0         },
+            {  "beth;",                            U'\x2136',   0         },
+            {  "between;",                         U'\x226C',   0         },
+            {  "bfr;",                             U'\x1D51F',  0         },
+            {  "bigcap;",                          U'\x22C2',   0         },
+            {  "bigcirc;",                         U'\x25EF',   0         },
+            {  "bigcup;",                          U'\x22C3',   0         },
+            {  "bigodot;",                         U'\x2A00',   0         },
+            {  "bigoplus;",                        U'\x2A01',   0         },
+            {  "bigotimes;",                       U'\x2A02',   0         },
+            {  "bigsqcup;",                        U'\x2A06',   0         },
+            {  "bigstar;",                         U'\x2605',   0         },
+            {  "bigtriangledown;",                 U'\x25BD',   0         },
+            {  "bigtriangleup;",                   U'\x25B3',   0         },
+            {  "biguplus;",                        U'\x2A04',   0         },
+            {  "bigvee;",                          U'\x22C1',   0         },
+            {  "bigwedge;",                        U'\x22C0',   0         },
+            {  "bkarow;",                          U'\x290D',   0         },
+            {  "blacklozenge;",                    U'\x29EB',   0         },
+            {  "blacksquare;",                     U'\x25AA',   0         },
+            {  "blacktriangle;",                   U'\x25B4',   0         },
+            {  "blacktriangledown;",               U'\x25BE',   0         },
+            {  "blacktriangleleft;",               U'\x25C2',   0         },
+            {  "blacktriangleright;",              U'\x25B8',   0         },
+            {  "blank;",                           U'\x2423',   0         },
+            {  "blk12;",                           U'\x2592',   0         },
+            {  "blk14;",                           U'\x2591',   0         },
+            {  "blk34;",                           U'\x2593',   0         },
+            {  "block;",                           U'\x2588',   0         },
+            {  "bne;",                             U'\x3D',     U'\x20E5' },
+            {  "bnequiv;",                         U'\x2261',   U'\x20E5' },
+            {  "bnot;",                            U'\x2310',   0         },
+            {  "bopf;",                            U'\x1D553',  0         },
+            {  "bot;",                             U'\x22A5',   0         },
+            {  "bottom;",                          U'\x22A5',   0         },
+            {  "bowtie;",                          U'\x22C8',   0         },
+            {  "boxDL;",                           U'\x2557',   0         },
+            {  "boxDR;",                           U'\x2554',   0         },
+            {  "boxDl;",                           U'\x2556',   0         },
+            {  "boxDr;",                           U'\x2553',   0         },
+            {  "boxH;",                            U'\x2550',   0         },
+            {  "boxHD;",                           U'\x2566',   0         },
+            {  "boxHU;",                           U'\x2569',   0         },
+            {  "boxHd;",                           U'\x2564',   0         },
+            {  "boxHu;",                           U'\x2567',   0         },
+            {  "boxUL;",                           U'\x255D',   0         },
+            {  "boxUR;",                           U'\x255A',   0         },
+            {  "boxUl;",                           U'\x255C',   0         },
+            {  "boxUr;",                           U'\x2559',   0         },
+            {  "boxV;",                            U'\x2551',   0         },
+            {  "boxVH;",                           U'\x256C',   0         },
+            {  "boxVL;",                           U'\x2563',   0         },
+            {  "boxVR;",                           U'\x2560',   0         },
+            {  "boxVh;",                           U'\x256B',   0         },
+            {  "boxVl;",                           U'\x2562',   0         },
+            {  "boxVr;",                           U'\x255F',   0         },
+            {  "boxbox;",                          U'\x29C9',   0         },
+            {  "boxdL;",                           U'\x2555',   0         },
+            {  "boxdR;",                           U'\x2552',   0         },
+            {  "boxdl;",                           U'\x2510',   0         },
+            {  "boxdr;",                           U'\x250C',   0         },
+            {  "boxh;",                            U'\x2500',   0         },
+            {  "boxhD;",                           U'\x2565',   0         },
+            {  "boxhU;",                           U'\x2568',   0         },
+            {  "boxhd;",                           U'\x252C',   0         },
+            {  "boxhu;",                           U'\x2534',   0         },
+            {  "boxminus;",                        U'\x229F',   0         },
+            {  "boxplus;",                         U'\x229E',   0         },
+            {  "boxtimes;",                        U'\x22A0',   0         },
+            {  "boxuL;",                           U'\x255B',   0         },
+            {  "boxuR;",                           U'\x2558',   0         },
+            {  "boxul;",                           U'\x2518',   0         },
+            {  "boxur;",                           U'\x2514',   0         },
+            {  "boxv;",                            U'\x2502',   0         },
+            {  "boxvH;",                           U'\x256A',   0         },
+            {  "boxvL;",                           U'\x2561',   0         },
+            {  "boxvR;",                           U'\x255E',   0         },
+            {  "boxvh;",                           U'\x253C',   0         },
+            {  "boxvl;",                           U'\x2524',   0         },
+            {  "boxvr;",                           U'\x251C',   0         },
+            {  "bprime;",                          U'\x2035',   0         },
+            {  "breve;",                           U'\x2D8',    0         },
+            {  "brvbar",                           U'\xA6',     0         },
+            {  "brvbar;",                          U'\xA6',     0         },
+            {  "bscr;",                            U'\x1D4B7',  0         },
+            {  "bsemi;",                           U'\x204F',   0         },
+            {  "bsim;",                            U'\x223D',   0         },
+            {  "bsime;",                           U'\x22CD',   0         },
+            {  "bsol;",                            U'\x5C',     0         },
+            {  "bsolb;",                           U'\x29C5',   0         },
+            {  "bsolhsub;",                        U'\x27C8',   0         },
+            {  "bull;",                            U'\x2022',   0         },
+            {  "bullet;",                          U'\x2022',   0         },
+            {  "bump;",                            U'\x224E',   0         },
+            {  "bumpE;",                           U'\x2AAE',   0         },
+            {  "bumpe;",                           U'\x224F',   0         },
+            {  "bumpeq;",                          U'\x224F',   0         },
+            {  "cacute;",                          U'\x107',    0         },
+            {  "cap;",                             U'\x2229',   0         },
+            {  "capand;",                          U'\x2A44',   0         },
+            {  "capbrcup;",                        U'\x2A49',   0         },
+            {  "capcap;",                          U'\x2A4B',   0         },
+            {  "capcup;",                          U'\x2A47',   0         },
+            {  "capdot;",                          U'\x2A40',   0         },
+            {  "caps;",                            U'\x2229',   U'\xFE00' },
+            {  "caret;",                           U'\x2041',   0         },
+            {  "caron;",                           U'\x2C7',    0         },
+            {  "ccaps;",                           U'\x2A4D',   0         },
+            {  "ccaron;",                          U'\x10D',    0         },
+            {  "ccedil",                           U'\xE7',     0         },
+            {  "ccedil;",                          U'\xE7',     0         },
+            {  "ccirc;",                           U'\x109',    0         },
+            {  "ccups;",                           U'\x2A4C',   0         },
+            {  "ccupssm;",                         U'\x2A50',   0         },
+            {  "cdot;",                            U'\x10B',    0         },
+            {  "cedil",                            U'\xB8',     0         },
+            {  "cedil;",                           U'\xB8',     0         },
+            {  "cemptyv;",                         U'\x29B2',   0         },
+            {  "cent",                             U'\xA2',     0         },
+            {  "cent;",                            U'\xA2',     0         },
+            {  "centerdot;",                       U'\xB7',     0         },
+            {  "cfr;",                             U'\x1D520',  0         },
+            {  "chcy;",                            U'\x447',    0         },
+            {  "check;",                           U'\x2713',   0         },
+            {  "checkmark;",                       U'\x2713',   0         },
+            {  "chi;",                             U'\x3C7',    0         },
+            {  "cir;",                             U'\x25CB',   0         },
+            {  "cirE;",                            U'\x29C3',   0         },
+            {  "circ;",                            U'\x2C6',    0         },
+            {  "circeq;",                          U'\x2257',   0         },
+            {  "circlearrowleft;",                 U'\x21BA',   0         },
+            {  "circlearrowright;",                U'\x21BB',   0         },
+            {  "circledR;",                        U'\xAE',     0         },
+            {  "circledS;",                        U'\x24C8',   0         },
+            {  "circledast;",                      U'\x229B',   0         },
+            {  "circledcirc;",                     U'\x229A',   0         },
+            {  "circleddash;",                     U'\x229D',   0         },
+            {  "cire;",                            U'\x2257',   0         },
+            {  "cirfnint;",                        U'\x2A10',   0         },
+            {  "cirmid;",                          U'\x2AEF',   0         },
+            {  "cirscir;",                         U'\x29C2',   0         },
+            {  "clubs;",                           U'\x2663',   0         },
+            {  "clubsuit;",                        U'\x2663',   0         },
+            {  "colon;",                           U'\x3A',     0         },
+            {  "colone;",                          U'\x2254',   0         },
+            {  "coloneq;",                         U'\x2254',   0         },
+            {  "comma;",                           U'\x2C',     0         },
+            {  "commat;",                          U'\x40',     0         },
+            {  "comp;",                            U'\x2201',   0         },
+            {  "compfn;",                          U'\x2218',   0         },
+            {  "complement;",                      U'\x2201',   0         },
+            {  "complexes;",                       U'\x2102',   0         },
+            {  "cong;",                            U'\x2245',   0         },
+            {  "congdot;",                         U'\x2A6D',   0         },
+            {  "conint;",                          U'\x222E',   0         },
+            {  "copf;",                            U'\x1D554',  0         },
+            {  "coprod;",                          U'\x2210',   0         },
+            {  "copy",                             U'\xA9',     0         },
+            {  "copy;",                            U'\xA9',     0         },
+            {  "copysr;",                          U'\x2117',   0         },
+            {  "crarr;",                           U'\x21B5',   0         },
+            {  "cross;",                           U'\x2717',   0         },
+            {  "cscr;",                            U'\x1D4B8',  0         },
+            {  "csub;",                            U'\x2ACF',   0         },
+            {  "csube;",                           U'\x2AD1',   0         },
+            {  "csup;",                            U'\x2AD0',   0         },
+            {  "csupe;",                           U'\x2AD2',   0         },
+            {  "ctdot;",                           U'\x22EF',   0         },
+            {  "cudarrl;",                         U'\x2938',   0         },
+            {  "cudarrr;",                         U'\x2935',   0         },
+            {  "cuepr;",                           U'\x22DE',   0         },
+            {  "cuesc;",                           U'\x22DF',   0         },
+            {  "cularr;",                          U'\x21B6',   0         },
+            {  "cularrp;",                         U'\x293D',   0         },
+            {  "cup;",                             U'\x222A',   0         },
+            {  "cupbrcap;",                        U'\x2A48',   0         },
+            {  "cupcap;",                          U'\x2A46',   0         },
+            {  "cupcup;",                          U'\x2A4A',   0         },
+            {  "cupdot;",                          U'\x228D',   0         },
+            {  "cupor;",                           U'\x2A45',   0         },
+            {  "cups;",                            U'\x222A',   U'\xFE00' },
+            {  "curarr;",                          U'\x21B7',   0         },
+            {  "curarrm;",                         U'\x293C',   0         },
+            {  "curlyeqprec;",                     U'\x22DE',   0         },
+            {  "curlyeqsucc;",                     U'\x22DF',   0         },
+            {  "curlyvee;",                        U'\x22CE',   0         },
+            {  "curlywedge;",                      U'\x22CF',   0         },
+            {  "curren",                           U'\xA4',     0         },
+            {  "curren;",                          U'\xA4',     0         },
+            {  "curvearrowleft;",                  U'\x21B6',   0         },
+            {  "curvearrowright;",                 U'\x21B7',   0         },
+            {  "cuvee;",                           U'\x22CE',   0         },
+            {  "cuwed;",                           U'\x22CF',   0         },
+            {  "cwconint;",                        U'\x2232',   0         },
+            {  "cwint;",                           U'\x2231',   0         },
+            {  "cylcty;",                          U'\x232D',   0         },
+            {  "dArr;",                            U'\x21D3',   0         },
+            {  "dHar;",                            U'\x2965',   0         },
+            {  "dagger;",                          U'\x2020',   0         },
+            {  "daleth;",                          U'\x2138',   0         },
+            {  "darr;",                            U'\x2193',   0         },
+            {  "dash;",                            U'\x2010',   0         },
+            {  "dashv;",                           U'\x22A3',   0         },
+            {  "dbkarow;",                         U'\x290F',   0         },
+            {  "dblac;",                           U'\x2DD',    0         },
+            {  "dcaron;",                          U'\x10F',    0         },
+            {  "dcy;",                             U'\x434',    0         },
+            {  "dd;",                              U'\x2146',   0         },
+            {  "ddagger;",                         U'\x2021',   0         },
+            {  "ddarr;",                           U'\x21CA',   0         },
+            {  "ddotseq;",                         U'\x2A77',   0         },
+            {  "deg",                              U'\xB0',     0         },
+            {  "deg;",                             U'\xB0',     0         },
+            {  "delta;",                           U'\x3B4',    0         },
+            {  "demptyv;",                         U'\x29B1',   0         },
+            {  "dfisht;",                          U'\x297F',   0         },
+            {  "dfr;",                             U'\x1D521',  0         },
+            {  "dharl;",                           U'\x21C3',   0         },
+            {  "dharr;",                           U'\x21C2',   0         },
+            {  "diam;",                            U'\x22C4',   0         },
+            {  "diamond;",                         U'\x22C4',   0         },
+            {  "diamondsuit;",                     U'\x2666',   0         },
+            {  "diams;",                           U'\x2666',   0         },
+            {  "die;",                             U'\xA8',     0         },
+            {  "digamma;",                         U'\x3DD',    0         },
+            {  "disin;",                           U'\x22F2',   0         },
+            {  "div;",                             U'\xF7',     0         },
+            {  "divide",                           U'\xF7',     0         },
+            {  "divide;",                          U'\xF7',     0         },
+            {  "divideontimes;",                   U'\x22C7',   0         },
+            {  "divonx;",                          U'\x22C7',   0         },
+            {  "djcy;",                            U'\x452',    0         },
+            {  "dlcorn;",                          U'\x231E',   0         },
+            {  "dlcrop;",                          U'\x230D',   0         },
+            {  "dollar;",                          U'\x24',     0         },
+            {  "dopf;",                            U'\x1D555',  0         },
+            {  "dot;",                             U'\x2D9',    0         },
+            {  "doteq;",                           U'\x2250',   0         },
+            {  "doteqdot;",                        U'\x2251',   0         },
+            {  "dotminus;",                        U'\x2238',   0         },
+            {  "dotplus;",                         U'\x2214',   0         },
+            {  "dotsquare;",                       U'\x22A1',   0         },
+            {  "doublebarwedge;",                  U'\x2306',   0         },
+            {  "downarrow;",                       U'\x2193',   0         },
+            {  "downdownarrows;",                  U'\x21CA',   0         },
+            {  "downharpoonleft;",                 U'\x21C3',   0         },
+            {  "downharpoonright;",                U'\x21C2',   0         },
+            {  "drbkarow;",                        U'\x2910',   0         },
+            {  "drcorn;",                          U'\x231F',   0         },
+            {  "drcrop;",                          U'\x230C',   0         },
+            {  "dscr;",                            U'\x1D4B9',  0         },
+            {  "dscy;",                            U'\x455',    0         },
+            {  "dsol;",                            U'\x29F6',   0         },
+            {  "dstrok;",                          U'\x111',    0         },
+            {  "dtdot;",                           U'\x22F1',   0         },
+            {  "dtri;",                            U'\x25BF',   0         },
+            {  "dtrif;",                           U'\x25BE',   0         },
+            {  "duarr;",                           U'\x21F5',   0         },
+            {  "duhar;",                           U'\x296F',   0         },
+            {  "dwangle;",                         U'\x29A6',   0         },
+            {  "dzcy;",                            U'\x45F',    0         },
+            {  "dzigrarr;",                        U'\x27FF',   0         },
+            {  "eDDot;",                           U'\x2A77',   0         },
+            {  "eDot;",                            U'\x2251',   0         },
+            {  "eacute",                           U'\xE9',     0         },
+            {  "eacute;",                          U'\xE9',     0         },
+            {  "easter;",                          U'\x2A6E',   0         },
+            {  "ecaron;",                          U'\x11B',    0         },
+            {  "ecir;",                            U'\x2256',   0         },
+            {  "ecirc",                            U'\xEA',     0         },
+            {  "ecirc;",                           U'\xEA',     0         },
+            {  "ecolon;",                          U'\x2255',   0         },
+            {  "ecy;",                             U'\x44D',    0         },
+            {  "edot;",                            U'\x117',    0         },
+            {  "ee;",                              U'\x2147',   0         },
+            {  "efDot;",                           U'\x2252',   0         },
+            {  "efr;",                             U'\x1D522',  0         },
+            {  "eg;",                              U'\x2A9A',   0         },
+            {  "egrave",                           U'\xE8',     0         },
+            {  "egrave;",                          U'\xE8',     0         },
+            {  "egs;",                             U'\x2A96',   0         },
+            {  "egsdot;",                          U'\x2A98',   0         },
+            {  "el;",                              U'\x2A99',   0         },
+            {  "elinters;",                        U'\x23E7',   0         },
+            {  "ell;",                             U'\x2113',   0         },
+            {  "els;",                             U'\x2A95',   0         },
+            {  "elsdot;",                          U'\x2A97',   0         },
+            {  "emacr;",                           U'\x113',    0         },
+            {  "empty;",                           U'\x2205',   0         },
+            {  "emptyset;",                        U'\x2205',   0         },
+            {  "emptyv;",                          U'\x2205',   0         },
+            {  "emsp13;",                          U'\x2004',   0         },
+            {  "emsp14;",                          U'\x2005',   0         },
+            {  "emsp;",                            U'\x2003',   0         },
+            {  "eng;",                             U'\x14B',    0         },
+            {  "ensp;",                            U'\x2002',   0         },
+            {  "eogon;",                           U'\x119',    0         },
+            {  "eopf;",                            U'\x1D556',  0         },
+            {  "epar;",                            U'\x22D5',   0         },
+            {  "eparsl;",                          U'\x29E3',   0         },
+            {  "eplus;",                           U'\x2A71',   0         },
+            {  "epsi;",                            U'\x3B5',    0         },
+            {  "epsilon;",                         U'\x3B5',    0         },
+            {  "epsiv;",                           U'\x3F5',    0         },
+            {  "eqcirc;",                          U'\x2256',   0         },
+            {  "eqcolon;",                         U'\x2255',   0         },
+            {  "eqsim;",                           U'\x2242',   0         },
+            {  "eqslantgtr;",                      U'\x2A96',   0         },
+            {  "eqslantless;",                     U'\x2A95',   0         },
+            {  "equals;",                          U'\x3D',     0         },
+            {  "equest;",                          U'\x225F',   0         },
+            {  "equiv;",                           U'\x2261',   0         },
+            {  "equivDD;",                         U'\x2A78',   0         },
+            {  "eqvparsl;",                        U'\x29E5',   0         },
+            {  "erDot;",                           U'\x2253',   0         },
+            {  "erarr;",                           U'\x2971',   0         },
+            {  "escr;",                            U'\x212F',   0         },
+            {  "esdot;",                           U'\x2250',   0         },
+            {  "esim;",                            U'\x2242',   0         },
+            {  "eta;",                             U'\x3B7',    0         },
+            {  "eth",                              U'\xF0',     0         },
+            {  "eth;",                             U'\xF0',     0         },
+            {  "euml",                             U'\xEB',     0         },
+            {  "euml;",                            U'\xEB',     0         },
+            {  "euro;",                            U'\x20AC',   0         },
+            {  "excl;",                            U'\x21',     0         },
+            {  "exist;",                           U'\x2203',   0         },
+            {  "expectation;",                     U'\x2130',   0         },
+            {  "exponentiale;",                    U'\x2147',   0         },
+            {  "fallingdotseq;",                   U'\x2252',   0         },
+            {  "fcy;",                             U'\x444',    0         },
+            {  "female;",                          U'\x2640',   0         },
+            {  "ffilig;",                          U'\xFB03',   0         },
+            {  "fflig;",                           U'\xFB00',   0         },
+            {  "ffllig;",                          U'\xFB04',   0         },
+            {  "ffr;",                             U'\x1D523',  0         },
+            {  "filig;",                           U'\xFB01',   0         },
+            {  "fjlig;",                           U'\x66',     U'\x6A'   },
+            {  "flat;",                            U'\x266D',   0         },
+            {  "fllig;",                           U'\xFB02',   0         },
+            {  "fltns;",                           U'\x25B1',   0         },
+            {  "fnof;",                            U'\x192',    0         },
+            {  "fopf;",                            U'\x1D557',  0         },
+            {  "forall;",                          U'\x2200',   0         },
+            {  "fork;",                            U'\x22D4',   0         },
+            {  "forkv;",                           U'\x2AD9',   0         },
+            {  "fpartint;",                        U'\x2A0D',   0         },
+            {  "frac12",                           U'\xBD',     0         },
+            {  "frac12;",                          U'\xBD',     0         },
+            {  "frac13;",                          U'\x2153',   0         },
+            {  "frac14",                           U'\xBC',     0         },
+            {  "frac14;",                          U'\xBC',     0         },
+            {  "frac15;",                          U'\x2155',   0         },
+            {  "frac16;",                          U'\x2159',   0         },
+            {  "frac18;",                          U'\x215B',   0         },
+            {  "frac23;",                          U'\x2154',   0         },
+            {  "frac25;",                          U'\x2156',   0         },
+            {  "frac34",                           U'\xBE',     0         },
+            {  "frac34;",                          U'\xBE',     0         },
+            {  "frac35;",                          U'\x2157',   0         },
+            {  "frac38;",                          U'\x215C',   0         },
+            {  "frac45;",                          U'\x2158',   0         },
+            {  "frac56;",                          U'\x215A',   0         },
+            {  "frac58;",                          U'\x215D',   0         },
+            {  "frac78;",                          U'\x215E',   0         },
+            {  "frasl;",                           U'\x2044',   0         },
+            {  "frown;",                           U'\x2322',   0         },
+            {  "fscr;",                            U'\x1D4BB',  0         },
+            {  "gE;",                              U'\x2267',   0         },
+            {  "gEl;",                             U'\x2A8C',   0         },
+            {  "gacute;",                          U'\x1F5',    0         },
+            {  "gamma;",                           U'\x3B3',    0         },
+            {  "gammad;",                          U'\x3DD',    0         },
+            {  "gap;",                             U'\x2A86',   0         },
+            {  "gbreve;",                          U'\x11F',    0         },
+            {  "gcirc;",                           U'\x11D',    0         },
+            {  "gcy;",                             U'\x433',    0         },
+            {  "gdot;",                            U'\x121',    0         },
+            {  "ge;",                              U'\x2265',   0         },
+            {  "gel;",                             U'\x22DB',   0         },
+            {  "geq;",                             U'\x2265',   0         },
+            {  "geqq;",                            U'\x2267',   0         },
+            {  "geqslant;",                        U'\x2A7E',   0         },
+            {  "ges;",                             U'\x2A7E',   0         },
+            {  "gescc;",                           U'\x2AA9',   0         },
+            {  "gesdot;",                          U'\x2A80',   0         },
+            {  "gesdoto;",                         U'\x2A82',   0         },
+            {  "gesdotol;",                        U'\x2A84',   0         },
+            {  "gesl;",                            U'\x22DB',   U'\xFE00' },
+            {  "gesles;",                          U'\x2A94',   0         },
+            {  "gfr;",                             U'\x1D524',  0         },
+            {  "gg;",                              U'\x226B',   0         },
+            {  "ggg;",                             U'\x22D9',   0         },
+            {  "gimel;",                           U'\x2137',   0         },
+            {  "gjcy;",                            U'\x453',    0         },
+            {  "gl;",                              U'\x2277',   0         },
+            {  "glE;",                             U'\x2A92',   0         },
+            {  "gla;",                             U'\x2AA5',   0         },
+            {  "glj;",                             U'\x2AA4',   0         },
+            {  "gnE;",                             U'\x2269',   0         },
+            {  "gnap;",                            U'\x2A8A',   0         },
+            {  "gnapprox;",                        U'\x2A8A',   0         },
+            {  "gne;",                             U'\x2A88',   0         },
+            {  "gneq;",                            U'\x2A88',   0         },
+            {  "gneqq;",                           U'\x2269',   0         },
+            {  "gnsim;",                           U'\x22E7',   0         },
+            {  "gopf;",                            U'\x1D558',  0         },
+            {  "grave;",                           U'\x60',     0         },
+            {  "gscr;",                            U'\x210A',   0         },
+            {  "gsim;",                            U'\x2273',   0         },
+            {  "gsime;",                           U'\x2A8E',   0         },
+            {  "gsiml;",                           U'\x2A90',   0         },
+            {  "gt",                               U'\x3E',     0         },
+            {  "gt;",                              U'\x3E',     0         },
+            {  "gtcc;",                            U'\x2AA7',   0         },
+            {  "gtcir;",                           U'\x2A7A',   0         },
+            {  "gtdot;",                           U'\x22D7',   0         },
+            {  "gtlPar;",                          U'\x2995',   0         },
+            {  "gtquest;",                         U'\x2A7C',   0         },
+            {  "gtrapprox;",                       U'\x2A86',   0         },
+            {  "gtrarr;",                          U'\x2978',   0         },
+            {  "gtrdot;",                          U'\x22D7',   0         },
+            {  "gtreqless;",                       U'\x22DB',   0         },
+            {  "gtreqqless;",                      U'\x2A8C',   0         },
+            {  "gtrless;",                         U'\x2277',   0         },
+            {  "gtrsim;",                          U'\x2273',   0         },
+            {  "gvertneqq;",                       U'\x2269',   U'\xFE00' },
+            {  "gvnE;",                            U'\x2269',   U'\xFE00' },
+            {  "hArr;",                            U'\x21D4',   0         },
+            {  "hairsp;",                          U'\x200A',   0         },
+            {  "half;",                            U'\xBD',     0         },
+            {  "hamilt;",                          U'\x210B',   0         },
+            {  "hardcy;",                          U'\x44A',    0         },
+            {  "harr;",                            U'\x2194',   0         },
+            {  "harrcir;",                         U'\x2948',   0         },
+            {  "harrw;",                           U'\x21AD',   0         },
+            {  "hbar;",                            U'\x210F',   0         },
+            {  "hcirc;",                           U'\x125',    0         },
+            {  "hearts;",                          U'\x2665',   0         },
+            {  "heartsuit;",                       U'\x2665',   0         },
+            {  "hellip;",                          U'\x2026',   0         },
+            {  "hercon;",                          U'\x22B9',   0         },
+            {  "hfr;",                             U'\x1D525',  0         },
+            {  "hksearow;",                        U'\x2925',   0         },
+            {  "hkswarow;",                        U'\x2926',   0         },
+            {  "hoarr;",                           U'\x21FF',   0         },
+            {  "homtht;",                          U'\x223B',   0         },
+            {  "hookleftarrow;",                   U'\x21A9',   0         },
+            {  "hookrightarrow;",                  U'\x21AA',   0         },
+            {  "hopf;",                            U'\x1D559',  0         },
+            {  "horbar;",                          U'\x2015',   0         },
+            {  "hscr;",                            U'\x1D4BD',  0         },
+            {  "hslash;",                          U'\x210F',   0         },
+            {  "hstrok;",                          U'\x127',    0         },
+            {  "hybull;",                          U'\x2043',   0         },
+            {  "hyphen;",                          U'\x2010',   0         },
+            {  "iacute",                           U'\xED',     0         },
+            {  "iacute;",                          U'\xED',     0         },
+            {  "ic;",                              U'\x2063',   0         },
+            {  "icirc",                            U'\xEE',     0         },
+            {  "icirc;",                           U'\xEE',     0         },
+            {  "icy;",                             U'\x438',    0         },
+            {  "iecy;",                            U'\x435',    0         },
+            {  "iexcl",                            U'\xA1',     0         },
+            {  "iexcl;",                           U'\xA1',     0         },
+            {  "iff;",                             U'\x21D4',   0         },
+            {  "ifr;",                             U'\x1D526',  0         },
+            {  "igrave",                           U'\xEC',     0         },
+            {  "igrave;",                          U'\xEC',     0         },
+            {  "ii;",                              U'\x2148',   0         },
+            {  "iiiint;",                          U'\x2A0C',   0         },
+            {  "iiint;",                           U'\x222D',   0         },
+            {  "iinfin;",                          U'\x29DC',   0         },
+            {  "iiota;",                           U'\x2129',   0         },
+            {  "ijlig;",                           U'\x133',    0         },
+            {  "imacr;",                           U'\x12B',    0         },
+            {  "image;",                           U'\x2111',   0         },
+            {  "imagline;",                        U'\x2110',   0         },
+            {  "imagpart;",                        U'\x2111',   0         },
+            {  "imath;",                           U'\x131',    0         },
+            {  "imof;",                            U'\x22B7',   0         },
+            {  "imped;",                           U'\x1B5',    0         },
+            {  "in;",                              U'\x2208',   0         },
+            {  "incare;",                          U'\x2105',   0         },
+            {  "infin;",                           U'\x221E',   0         },
+            {  "infintie;",                        U'\x29DD',   0         },
+            {  "inodot;",                          U'\x131',    0         },
+            {  "int;",                             U'\x222B',   0         },
+            {  "intcal;",                          U'\x22BA',   0         },
+            {  "integers;",                        U'\x2124',   0         },
+            {  "intercal;",                        U'\x22BA',   0         },
+            {  "intlarhk;",                        U'\x2A17',   0         },
+            {  "intprod;",                         U'\x2A3C',   0         },
+            {  "iocy;",                            U'\x451',    0         },
+            {  "iogon;",                           U'\x12F',    0         },
+            {  "iopf;",                            U'\x1D55A',  0         },
+            {  "iota;",                            U'\x3B9',    0         },
+            {  "iprod;",                           U'\x2A3C',   0         },
+            {  "iquest",                           U'\xBF',     0         },
+            {  "iquest;",                          U'\xBF',     0         },
+            {  "iscr;",                            U'\x1D4BE',  0         },
+            {  "isin;",                            U'\x2208',   0         },
+            {  "isinE;",                           U'\x22F9',   0         },
+            {  "isindot;",                         U'\x22F5',   0         },
+            {  "isins;",                           U'\x22F4',   0         },
+            {  "isinsv;",                          U'\x22F3',   0         },
+            {  "isinv;",                           U'\x2208',   0         },
+            {  "it;",                              U'\x2062',   0         },
+            {  "itilde;",                          U'\x129',    0         },
+            {  "iukcy;",                           U'\x456',    0         },
+            {  "iuml",                             U'\xEF',     0         },
+            {  "iuml;",                            U'\xEF',     0         },
+            {  "jcirc;",                           U'\x135',    0         },
+            {  "jcy;",                             U'\x439',    0         },
+            {  "jfr;",                             U'\x1D527',  0         },
+            {  "jmath;",                           U'\x237',    0         },
+            {  "jopf;",                            U'\x1D55B',  0         },
+            {  "jscr;",                            U'\x1D4BF',  0         },
+            {  "jsercy;",                          U'\x458',    0         },
+            {  "jukcy;",                           U'\x454',    0         },
+            {  "kappa;",                           U'\x3BA',    0         },
+            {  "kappav;",                          U'\x3F0',    0         },
+            {  "kcedil;",                          U'\x137',    0         },
+            {  "kcy;",                             U'\x43A',    0         },
+            {  "kfr;",                             U'\x1D528',  0         },
+            {  "kgreen;",                          U'\x138',    0         },
+            {  "khcy;",                            U'\x445',    0         },
+            {  "kjcy;",                            U'\x45C',    0         },
+            {  "kopf;",                            U'\x1D55C',  0         },
+            {  "kscr;",                            U'\x1D4C0',  0         },
+            {  "lAarr;",                           U'\x21DA',   0         },
+            {  "lArr;",                            U'\x21D0',   0         },
+            {  "lAtail;",                          U'\x291B',   0         },
+            {  "lBarr;",                           U'\x290E',   0         },
+            {  "lE;",                              U'\x2266',   0         },
+            {  "lEg;",                             U'\x2A8B',   0         },
+            {  "lHar;",                            U'\x2962',   0         },
+            {  "lacute;",                          U'\x13A',    0         },
+            {  "laemptyv;",                        U'\x29B4',   0         },
+            {  "lagran;",                          U'\x2112',   0         },
+            {  "lambda;",                          U'\x3BB',    0         },
+            {  "lang;",                            U'\x27E8',   0         },
+            {  "langd;",                           U'\x2991',   0         },
+            {  "langle;",                          U'\x27E8',   0         },
+            {  "lap;",                             U'\x2A85',   0         },
+            {  "laquo",                            U'\xAB',     0         },
+            {  "laquo;",                           U'\xAB',     0         },
+            {  "larr;",                            U'\x2190',   0         },
+            {  "larrb;",                           U'\x21E4',   0         },
+            {  "larrbfs;",                         U'\x291F',   0         },
+            {  "larrfs;",                          U'\x291D',   0         },
+            {  "larrhk;",                          U'\x21A9',   0         },
+            {  "larrlp;",                          U'\x21AB',   0         },
+            {  "larrpl;",                          U'\x2939',   0         },
+            {  "larrsim;",                         U'\x2973',   0         },
+            {  "larrtl;",                          U'\x21A2',   0         },
+            {  "lat;",                             U'\x2AAB',   0         },
+            {  "latail;",                          U'\x2919',   0         },
+            {  "late;",                            U'\x2AAD',   0         },
+            {  "lates;",                           U'\x2AAD',   U'\xFE00' },
+            {  "lbarr;",                           U'\x290C',   0         },
+            {  "lbbrk;",                           U'\x2772',   0         },
+            {  "lbrace;",                          U'\x7B',     0         },
+            {  "lbrack;",                          U'\x5B',     0         },
+            {  "lbrke;",                           U'\x298B',   0         },
+            {  "lbrksld;",                         U'\x298F',   0         },
+            {  "lbrkslu;",                         U'\x298D',   0         },
+            {  "lcaron;",                          U'\x13E',    0         },
+            {  "lcedil;",                          U'\x13C',    0         },
+            {  "lceil;",                           U'\x2308',   0         },
+            {  "lcub;",                            U'\x7B',     0         },
+            {  "lcy;",                             U'\x43B',    0         },
+            {  "ldca;",                            U'\x2936',   0         },
+            {  "ldquo;",                           U'\x201C',   0         },
+            {  "ldquor;",                          U'\x201E',   0         },
+            {  "ldrdhar;",                         U'\x2967',   0         },
+            {  "ldrushar;",                        U'\x294B',   0         },
+            {  "ldsh;",                            U'\x21B2',   0         },
+            {  "le;",                              U'\x2264',   0         },
+            {  "leftarrow;",                       U'\x2190',   0         },
+            {  "leftarrowtail;",                   U'\x21A2',   0         },
+            {  "leftharpoondown;",                 U'\x21BD',   0         },
+            {  "leftharpoonup;",                   U'\x21BC',   0         },
+            {  "leftleftarrows;",                  U'\x21C7',   0         },
+            {  "leftrightarrow;",                  U'\x2194',   0         },
+            {  "leftrightarrows;",                 U'\x21C6',   0         },
+            {  "leftrightharpoons;",               U'\x21CB',   0         },
+            {  "leftrightsquigarrow;",             U'\x21AD',   0         },
+            {  "leftthreetimes;",                  U'\x22CB',   0         },
+            {  "leg;",                             U'\x22DA',   0         },
+            {  "leq;",                             U'\x2264',   0         },
+            {  "leqq;",                            U'\x2266',   0         },
+            {  "leqslant;",                        U'\x2A7D',   0         },
+            {  "les;",                             U'\x2A7D',   0         },
+            {  "lescc;",                           U'\x2AA8',   0         },
+            {  "lesdot;",                          U'\x2A7F',   0         },
+            {  "lesdoto;",                         U'\x2A81',   0         },
+            {  "lesdotor;",                        U'\x2A83',   0         },
+            {  "lesg;",                            U'\x22DA',   U'\xFE00' },
+            {  "lesges;",                          U'\x2A93',   0         },
+            {  "lessapprox;",                      U'\x2A85',   0         },
+            {  "lessdot;",                         U'\x22D6',   0         },
+            {  "lesseqgtr;",                       U'\x22DA',   0         },
+            {  "lesseqqgtr;",                      U'\x2A8B',   0         },
+            {  "lessgtr;",                         U'\x2276',   0         },
+            {  "lesssim;",                         U'\x2272',   0         },
+            {  "lfisht;",                          U'\x297C',   0         },
+            {  "lfloor;",                          U'\x230A',   0         },
+            {  "lfr;",                             U'\x1D529',  0         },
+            {  "lg;",                              U'\x2276',   0         },
+            {  "lgE;",                             U'\x2A91',   0         },
+            {  "lhard;",                           U'\x21BD',   0         },
+            {  "lharu;",                           U'\x21BC',   0         },
+            {  "lharul;",                          U'\x296A',   0         },
+            {  "lhblk;",                           U'\x2584',   0         },
+            {  "ljcy;",                            U'\x459',    0         },
+            {  "ll;",                              U'\x226A',   0         },
+            {  "llarr;",                           U'\x21C7',   0         },
+            {  "llcorner;",                        U'\x231E',   0         },
+            {  "llhard;",                          U'\x296B',   0         },
+            {  "lltri;",                           U'\x25FA',   0         },
+            {  "lmidot;",                          U'\x140',    0         },
+            {  "lmoust;",                          U'\x23B0',   0         },
+            {  "lmoustache;",                      U'\x23B0',   0         },
+            {  "lnE;",                             U'\x2268',   0         },
+            {  "lnap;",                            U'\x2A89',   0         },
+            {  "lnapprox;",                        U'\x2A89',   0         },
+            {  "lne;",                             U'\x2A87',   0         },
+            {  "lneq;",                            U'\x2A87',   0         },
+            {  "lneqq;",                           U'\x2268',   0         },
+            {  "lnsim;",                           U'\x22E6',   0         },
+            {  "loang;",                           U'\x27EC',   0         },
+            {  "loarr;",                           U'\x21FD',   0         },
+            {  "lobrk;",                           U'\x27E6',   0         },
+            {  "longleftarrow;",                   U'\x27F5',   0         },
+            {  "longleftrightarrow;",              U'\x27F7',   0         },
+            {  "longmapsto;",                      U'\x27FC',   0         },
+            {  "longrightarrow;",                  U'\x27F6',   0         },
+            {  "looparrowleft;",                   U'\x21AB',   0         },
+            {  "looparrowright;",                  U'\x21AC',   0         },
+            {  "lopar;",                           U'\x2985',   0         },
+            {  "lopf;",                            U'\x1D55D',  0         },
+            {  "loplus;",                          U'\x2A2D',   0         },
+            {  "lotimes;",                         U'\x2A34',   0         },
+            {  "lowast;",                          U'\x2217',   0         },
+            {  "lowbar;",                          U'\x5F',     0         },
+            {  "loz;",                             U'\x25CA',   0         },
+            {  "lozenge;",                         U'\x25CA',   0         },
+            {  "lozf;",                            U'\x29EB',   0         },
+            {  "lpar;",                            U'\x28',     0         },
+            {  "lparlt;",                          U'\x2993',   0         },
+            {  "lrarr;",                           U'\x21C6',   0         },
+            {  "lrcorner;",                        U'\x231F',   0         },
+            {  "lrhar;",                           U'\x21CB',   0         },
+            {  "lrhard;",                          U'\x296D',   0         },
+            {  "lrm;",                             U'\x200E',   0         },
+            {  "lrtri;",                           U'\x22BF',   0         },
+            {  "lsaquo;",                          U'\x2039',   0         },
+            {  "lscr;",                            U'\x1D4C1',  0         },
+            {  "lsh;",                             U'\x21B0',   0         },
+            {  "lsim;",                            U'\x2272',   0         },
+            {  "lsime;",                           U'\x2A8D',   0         },
+            {  "lsimg;",                           U'\x2A8F',   0         },
+            {  "lsqb;",                            U'\x5B',     0         },
+            {  "lsquo;",                           U'\x2018',   0         },
+            {  "lsquor;",                          U'\x201A',   0         },
+            {  "lstrok;",                          U'\x142',    0         },
+            {  "lt",                               U'\x3C',     0         },
+            {  "lt;",                              U'\x3C',     0         },
+            {  "ltcc;",                            U'\x2AA6',   0         },
+            {  "ltcir;",                           U'\x2A79',   0         },
+            {  "ltdot;",                           U'\x22D6',   0         },
+            {  "lthree;",                          U'\x22CB',   0         },
+            {  "ltimes;",                          U'\x22C9',   0         },
+            {  "ltlarr;",                          U'\x2976',   0         },
+            {  "ltquest;",                         U'\x2A7B',   0         },
+            {  "ltrPar;",                          U'\x2996',   0         },
+            {  "ltri;",                            U'\x25C3',   0         },
+            {  "ltrie;",                           U'\x22B4',   0         },
+            {  "ltrif;",                           U'\x25C2',   0         },
+            {  "lurdshar;",                        U'\x294A',   0         },
+            {  "luruhar;",                         U'\x2966',   0         },
+            {  "lvertneqq;",                       U'\x2268',   U'\xFE00' },
+            {  "lvnE;",                            U'\x2268',   U'\xFE00' },
+            {  "mDDot;",                           U'\x223A',   0         },
+            {  "macr",                             U'\xAF',     0         },
+            {  "macr;",                            U'\xAF',     0         },
+            {  "male;",                            U'\x2642',   0         },
+            {  "malt;",                            U'\x2720',   0         },
+            {  "maltese;",                         U'\x2720',   0         },
+            {  "map;",                             U'\x21A6',   0         },
+            {  "mapsto;",                          U'\x21A6',   0         },
+            {  "mapstodown;",                      U'\x21A7',   0         },
+            {  "mapstoleft;",                      U'\x21A4',   0         },
+            {  "mapstoup;",                        U'\x21A5',   0         },
+            {  "marker;",                          U'\x25AE',   0         },
+            {  "mcomma;",                          U'\x2A29',   0         },
+            {  "mcy;",                             U'\x43C',    0         },
+            {  "mdash;",                           U'\x2014',   0         },
+            {  "measuredangle;",                   U'\x2221',   0         },
+            {  "mfr;",                             U'\x1D52A',  0         },
+            {  "mho;",                             U'\x2127',   0         },
+            {  "micro",                            U'\xB5',     0         },
+            {  "micro;",                           U'\xB5',     0         },
+            {  "mid;",                             U'\x2223',   0         },
+            {  "midast;",                          U'\x2A',     0         },
+            {  "midcir;",                          U'\x2AF0',   0         },
+            {  "middot",                           U'\xB7',     0         },
+            {  "middot;",                          U'\xB7',     0         },
+            {  "minus;",                           U'\x2212',   0         },
+            {  "minusb;",                          U'\x229F',   0         },
+            {  "minusd;",                          U'\x2238',   0         },
+            {  "minusdu;",                         U'\x2A2A',   0         },
+            {  "mlcp;",                            U'\x2ADB',   0         },
+            {  "mldr;",                            U'\x2026',   0         },
+            {  "mnplus;",                          U'\x2213',   0         },
+            {  "models;",                          U'\x22A7',   0         },
+            {  "mopf;",                            U'\x1D55E',  0         },
+            {  "mp;",                              U'\x2213',   0         },
+            {  "mscr;",                            U'\x1D4C2',  0         },
+            {  "mstpos;",                          U'\x223E',   0         },
+            {  "mu;",                              U'\x3BC',    0         },
+            {  "multimap;",                        U'\x22B8',   0         },
+            {  "mumap;",                           U'\x22B8',   0         },
+            {  "nGg;",                             U'\x22D9',   U'\x338'  },
+            {  "nGt;",                             U'\x226B',   U'\x20D2' },
+            {  "nGtv;",                            U'\x226B',   U'\x338'  },
+            {  "nLeftarrow;",                      U'\x21CD',   0         },
+            {  "nLeftrightarrow;",                 U'\x21CE',   0         },
+            {  "nLl;",                             U'\x22D8',   U'\x338'  },
+            {  "nLt;",                             U'\x226A',   U'\x20D2' },
+            {  "nLtv;",                            U'\x226A',   U'\x338'  },
+            {  "nRightarrow;",                     U'\x21CF',   0         },
+            {  "nVDash;",                          U'\x22AF',   0         },
+            {  "nVdash;",                          U'\x22AE',   0         },
+            {  "nabla;",                           U'\x2207',   0         },
+            {  "nacute;",                          U'\x144',    0         },
+            {  "nang;",                            U'\x2220',   U'\x20D2' },
+            {  "nap;",                             U'\x2249',   0         },
+            {  "napE;",                            U'\x2A70',   U'\x338'  },
+            {  "napid;",                           U'\x224B',   U'\x338'  },
+            {  "napos;",                           U'\x149',    0         },
+            {  "napprox;",                         U'\x2249',   0         },
+            {  "natur;",                           U'\x266E',   0         },
+            {  "natural;",                         U'\x266E',   0         },
+            {  "naturals;",                        U'\x2115',   0         },
+            {  "nbsp",                             U'\xA0',     0         },
+            {  "nbsp;",                            U'\xA0',     0         },
+            {  "nbump;",                           U'\x224E',   U'\x338'  },
+            {  "nbumpe;",                          U'\x224F',   U'\x338'  },
+            {  "ncap;",                            U'\x2A43',   0         },
+            {  "ncaron;",                          U'\x148',    0         },
+            {  "ncedil;",                          U'\x146',    0         },
+            {  "ncong;",                           U'\x2247',   0         },
+            {  "ncongdot;",                        U'\x2A6D',   U'\x338'  },
+            {  "ncup;",                            U'\x2A42',   0         },
+            {  "ncy;",                             U'\x43D',    0         },
+            {  "ndash;",                           U'\x2013',   0         },
+            {  "ne;",                              U'\x2260',   0         },
+            {  "neArr;",                           U'\x21D7',   0         },
+            {  "nearhk;",                          U'\x2924',   0         },
+            {  "nearr;",                           U'\x2197',   0         },
+            {  "nearrow;",                         U'\x2197',   0         },
+            {  "nedot;",                           U'\x2250',   U'\x338'  },
+            {  "nequiv;",                          U'\x2262',   0         },
+            {  "nesear;",                          U'\x2928',   0         },
+            {  "nesim;",                           U'\x2242',   U'\x338'  },
+            {  "nexist;",                          U'\x2204',   0         },
+            {  "nexists;",                         U'\x2204',   0         },
+            {  "nfr;",                             U'\x1D52B',  0         },
+            {  "ngE;",                             U'\x2267',   U'\x338'  },
+            {  "nge;",                             U'\x2271',   0         },
+            {  "ngeq;",                            U'\x2271',   0         },
+            {  "ngeqq;",                           U'\x2267',   U'\x338'  },
+            {  "ngeqslant;",                       U'\x2A7E',   U'\x338'  },
+            {  "nges;",                            U'\x2A7E',   U'\x338'  },
+            {  "ngsim;",                           U'\x2275',   0         },
+            {  "ngt;",                             U'\x226F',   0         },
+            {  "ngtr;",                            U'\x226F',   0         },
+            {  "nhArr;",                           U'\x21CE',   0         },
+            {  "nharr;",                           U'\x21AE',   0         },
+            {  "nhpar;",                           U'\x2AF2',   0         },
+            {  "ni;",                              U'\x220B',   0         },
+            {  "nis;",                             U'\x22FC',   0         },
+            {  "nisd;",                            U'\x22FA',   0         },
+            {  "niv;",                             U'\x220B',   0         },
+            {  "njcy;",                            U'\x45A',    0         },
+            {  "nlArr;",                           U'\x21CD',   0         },
+            {  "nlE;",                             U'\x2266',   U'\x338'  },
+            {  "nlarr;",                           U'\x219A',   0         },
+            {  "nldr;",                            U'\x2025',   0         },
+            {  "nle;",                             U'\x2270',   0         },
+            {  "nleftarrow;",                      U'\x219A',   0         },
+            {  "nleftrightarrow;",                 U'\x21AE',   0         },
+            {  "nleq;",                            U'\x2270',   0         },
+            {  "nleqq;",                           U'\x2266',   U'\x338'  },
+            {  "nleqslant;",                       U'\x2A7D',   U'\x338'  },
+            {  "nles;",                            U'\x2A7D',   U'\x338'  },
+            {  "nless;",                           U'\x226E',   0         },
+            {  "nlsim;",                           U'\x2274',   0         },
+            {  "nlt;",                             U'\x226E',   0         },
+            {  "nltri;",                           U'\x22EA',   0         },
+            {  "nltrie;",                          U'\x22EC',   0         },
+            {  "nmid;",                            U'\x2224',   0         },
+            {  "nopf;",                            U'\x1D55F',  0         },
+            {  "not",                              U'\xAC',     0         },
+            {  "not;",                             U'\xAC',     0         },
+            {  "notin;",                           U'\x2209',   0         },
+            {  "notinE;",                          U'\x22F9',   U'\x338'  },
+            {  "notindot;",                        U'\x22F5',   U'\x338'  },
+            {  "notinva;",                         U'\x2209',   0         },
+            {  "notinvb;",                         U'\x22F7',   0         },
+            {  "notinvc;",                         U'\x22F6',   0         },
+            {  "notni;",                           U'\x220C',   0         },
+            {  "notniva;",                         U'\x220C',   0         },
+            {  "notnivb;",                         U'\x22FE',   0         },
+            {  "notnivc;",                         U'\x22FD',   0         },
+            {  "npar;",                            U'\x2226',   0         },
+            {  "nparallel;",                       U'\x2226',   0         },
+            {  "nparsl;",                          U'\x2AFD',   U'\x20E5' },
+            {  "npart;",                           U'\x2202',   U'\x338'  },
+            {  "npolint;",                         U'\x2A14',   0         },
+            {  "npr;",                             U'\x2280',   0         },
+            {  "nprcue;",                          U'\x22E0',   0         },
+            {  "npre;",                            U'\x2AAF',   U'\x338'  },
+            {  "nprec;",                           U'\x2280',   0         },
+            {  "npreceq;",                         U'\x2AAF',   U'\x338'  },
+            {  "nrArr;",                           U'\x21CF',   0         },
+            {  "nrarr;",                           U'\x219B',   0         },
+            {  "nrarrc;",                          U'\x2933',   U'\x338'  },
+            {  "nrarrw;",                          U'\x219D',   U'\x338'  },
+            {  "nrightarrow;",                     U'\x219B',   0         },
+            {  "nrtri;",                           U'\x22EB',   0         },
+            {  "nrtrie;",                          U'\x22ED',   0         },
+            {  "nsc;",                             U'\x2281',   0         },
+            {  "nsccue;",                          U'\x22E1',   0         },
+            {  "nsce;",                            U'\x2AB0',   U'\x338'  },
+            {  "nscr;",                            U'\x1D4C3',  0         },
+            {  "nshortmid;",                       U'\x2224',   0         },
+            {  "nshortparallel;",                  U'\x2226',   0         },
+            {  "nsim;",                            U'\x2241',   0         },
+            {  "nsime;",                           U'\x2244',   0         },
+            {  "nsimeq;",                          U'\x2244',   0         },
+            {  "nsmid;",                           U'\x2224',   0         },
+            {  "nspar;",                           U'\x2226',   0         },
+            {  "nsqsube;",                         U'\x22E2',   0         },
+            {  "nsqsupe;",                         U'\x22E3',   0         },
+            {  "nsub;",                            U'\x2284',   0         },
+            {  "nsubE;",                           U'\x2AC5',   U'\x338'  },
+            {  "nsube;",                           U'\x2288',   0         },
+            {  "nsubset;",                         U'\x2282',   U'\x20D2' },
+            {  "nsubseteq;",                       U'\x2288',   0         },
+            {  "nsubseteqq;",                      U'\x2AC5',   U'\x338'  },
+            {  "nsucc;",                           U'\x2281',   0         },
+            {  "nsucceq;",                         U'\x2AB0',   U'\x338'  },
+            {  "nsup;",                            U'\x2285',   0         },
+            {  "nsupE;",                           U'\x2AC6',   U'\x338'  },
+            {  "nsupe;",                           U'\x2289',   0         },
+            {  "nsupset;",                         U'\x2283',   U'\x20D2' },
+            {  "nsupseteq;",                       U'\x2289',   0         },
+            {  "nsupseteqq;",                      U'\x2AC6',   U'\x338'  },
+            {  "ntgl;",                            U'\x2279',   0         },
+            {  "ntilde",                           U'\xF1',     0         },
+            {  "ntilde;",                          U'\xF1',     0         },
+            {  "ntlg;",                            U'\x2278',   0         },
+            {  "ntriangleleft;",                   U'\x22EA',   0         },
+            {  "ntrianglelefteq;",                 U'\x22EC',   0         },
+            {  "ntriangleright;",                  U'\x22EB',   0         },
+            {  "ntrianglerighteq;",                U'\x22ED',   0         },
+            {  "nu;",                              U'\x3BD',    0         },
+            {  "num;",                             U'\x23',     0         },
+            {  "numero;",                          U'\x2116',   0         },
+            {  "numsp;",                           U'\x2007',   0         },
+            {  "nvDash;",                          U'\x22AD',   0         },
+            {  "nvHarr;",                          U'\x2904',   0         },
+            {  "nvap;",                            U'\x224D',   U'\x20D2' },
+            {  "nvdash;",                          U'\x22AC',   0         },
+            {  "nvge;",                            U'\x2265',   U'\x20D2' },
+            {  "nvgt;",                            U'\x3E',     U'\x20D2' },
+            {  "nvinfin;",                         U'\x29DE',   0         },
+            {  "nvlArr;",                          U'\x2902',   0         },
+            {  "nvle;",                            U'\x2264',   U'\x20D2' },
+            {  "nvlt;",                            U'\x3C',     U'\x20D2' },
+            {  "nvltrie;",                         U'\x22B4',   U'\x20D2' },
+            {  "nvrArr;",                          U'\x2903',   0         },
+            {  "nvrtrie;",                         U'\x22B5',   U'\x20D2' },
+            {  "nvsim;",                           U'\x223C',   U'\x20D2' },
+            {  "nwArr;",                           U'\x21D6',   0         },
+            {  "nwarhk;",                          U'\x2923',   0         },
+            {  "nwarr;",                           U'\x2196',   0         },
+            {  "nwarrow;",                         U'\x2196',   0         },
+            {  "nwnear;",                          U'\x2927',   0         },
+            {  "oS;",                              U'\x24C8',   0         },
+            {  "oacute",                           U'\xF3',     0         },
+            {  "oacute;",                          U'\xF3',     0         },
+            {  "oast;",                            U'\x229B',   0         },
+            {  "ocir;",                            U'\x229A',   0         },
+            {  "ocirc",                            U'\xF4',     0         },
+            {  "ocirc;",                           U'\xF4',     0         },
+            {  "ocy;",                             U'\x43E',    0         },
+            {  "odash;",                           U'\x229D',   0         },
+            {  "odblac;",                          U'\x151',    0         },
+            {  "odiv;",                            U'\x2A38',   0         },
+            {  "odot;",                            U'\x2299',   0         },
+            {  "odsold;",                          U'\x29BC',   0         },
+            {  "oelig;",                           U'\x153',    0         },
+            {  "ofcir;",                           U'\x29BF',   0         },
+            {  "ofr;",                             U'\x1D52C',  0         },
+            {  "ogon;",                            U'\x2DB',    0         },
+            {  "ograve",                           U'\xF2',     0         },
+            {  "ograve;",                          U'\xF2',     0         },
+            {  "ogt;",                             U'\x29C1',   0         },
+            {  "ohbar;",                           U'\x29B5',   0         },
+            {  "ohm;",                             U'\x3A9',    0         },
+            {  "oint;",                            U'\x222E',   0         },
+            {  "olarr;",                           U'\x21BA',   0         },
+            {  "olcir;",                           U'\x29BE',   0         },
+            {  "olcross;",                         U'\x29BB',   0         },
+            {  "oline;",                           U'\x203E',   0         },
+            {  "olt;",                             U'\x29C0',   0         },
+            {  "omacr;",                           U'\x14D',    0         },
+            {  "omega;",                           U'\x3C9',    0         },
+            {  "omicron;",                         U'\x3BF',    0         },
+            {  "omid;",                            U'\x29B6',   0         },
+            {  "ominus;",                          U'\x2296',   0         },
+            {  "oopf;",                            U'\x1D560',  0         },
+            {  "opar;",                            U'\x29B7',   0         },
+            {  "operp;",                           U'\x29B9',   0         },
+            {  "oplus;",                           U'\x2295',   0         },
+            {  "or;",                              U'\x2228',   0         },
+            {  "orarr;",                           U'\x21BB',   0         },
+            {  "ord;",                             U'\x2A5D',   0         },
+            {  "order;",                           U'\x2134',   0         },
+            {  "orderof;",                         U'\x2134',   0         },
+            {  "ordf",                             U'\xAA',     0         },
+            {  "ordf;",                            U'\xAA',     0         },
+            {  "ordm",                             U'\xBA',     0         },
+            {  "ordm;",                            U'\xBA',     0         },
+            {  "origof;",                          U'\x22B6',   0         },
+            {  "oror;",                            U'\x2A56',   0         },
+            {  "orslope;",                         U'\x2A57',   0         },
+            {  "orv;",                             U'\x2A5B',   0         },
+            {  "oscr;",                            U'\x2134',   0         },
+            {  "oslash",                           U'\xF8',     0         },
+            {  "oslash;",                          U'\xF8',     0         },
+            {  "osol;",                            U'\x2298',   0         },
+            {  "otilde",                           U'\xF5',     0         },
+            {  "otilde;",                          U'\xF5',     0         },
+            {  "otimes;",                          U'\x2297',   0         },
+            {  "otimesas;",                        U'\x2A36',   0         },
+            {  "ouml",                             U'\xF6',     0         },
+            {  "ouml;",                            U'\xF6',     0         },
+            {  "ovbar;",                           U'\x233D',   0         },
+            {  "par;",                             U'\x2225',   0         },
+            {  "para",                             U'\xB6',     0         },
+            {  "para;",                            U'\xB6',     0         },
+            {  "parallel;",                        U'\x2225',   0         },
+            {  "parsim;",                          U'\x2AF3',   0         },
+            {  "parsl;",                           U'\x2AFD',   0         },
+            {  "part;",                            U'\x2202',   0         },
+            {  "pcy;",                             U'\x43F',    0         },
+            {  "percnt;",                          U'\x25',     0         },
+            {  "period;",                          U'\x2E',     0         },
+            {  "permil;",                          U'\x2030',   0         },
+            {  "perp;",                            U'\x22A5',   0         },
+            {  "pertenk;",                         U'\x2031',   0         },
+            {  "pfr;",                             U'\x1D52D',  0         },
+            {  "phi;",                             U'\x3C6',    0         },
+            {  "phiv;",                            U'\x3D5',    0         },
+            {  "phmmat;",                          U'\x2133',   0         },
+            {  "phone;",                           U'\x260E',   0         },
+            {  "pi;",                              U'\x3C0',    0         },
+            {  "pitchfork;",                       U'\x22D4',   0         },
+            {  "piv;",                             U'\x3D6',    0         },
+            {  "planck;",                          U'\x210F',   0         },
+            {  "planckh;",                         U'\x210E',   0         },
+            {  "plankv;",                          U'\x210F',   0         },
+            {  "plus;",                            U'\x2B',     0         },
+            {  "plusacir;",                        U'\x2A23',   0         },
+            {  "plusb;",                           U'\x229E',   0         },
+            {  "pluscir;",                         U'\x2A22',   0         },
+            {  "plusdo;",                          U'\x2214',   0         },
+            {  "plusdu;",                          U'\x2A25',   0         },
+            {  "pluse;",                           U'\x2A72',   0         },
+            {  "plusmn",                           U'\xB1',     0         },
+            {  "plusmn;",                          U'\xB1',     0         },
+            {  "plussim;",                         U'\x2A26',   0         },
+            {  "plustwo;",                         U'\x2A27',   0         },
+            {  "pm;",                              U'\xB1',     0         },
+            {  "pointint;",                        U'\x2A15',   0         },
+            {  "popf;",                            U'\x1D561',  0         },
+            {  "pound",                            U'\xA3',     0         },
+            {  "pound;",                           U'\xA3',     0         },
+            {  "pr;",                              U'\x227A',   0         },
+            {  "prE;",                             U'\x2AB3',   0         },
+            {  "prap;",                            U'\x2AB7',   0         },
+            {  "prcue;",                           U'\x227C',   0         },
+            {  "pre;",                             U'\x2AAF',   0         },
+            {  "prec;",                            U'\x227A',   0         },
+            {  "precapprox;",                      U'\x2AB7',   0         },
+            {  "preccurlyeq;",                     U'\x227C',   0         },
+            {  "preceq;",                          U'\x2AAF',   0         },
+            {  "precnapprox;",                     U'\x2AB9',   0         },
+            {  "precneqq;",                        U'\x2AB5',   0         },
+            {  "precnsim;",                        U'\x22E8',   0         },
+            {  "precsim;",                         U'\x227E',   0         },
+            {  "prime;",                           U'\x2032',   0         },
+            {  "primes;",                          U'\x2119',   0         },
+            {  "prnE;",                            U'\x2AB5',   0         },
+            {  "prnap;",                           U'\x2AB9',   0         },
+            {  "prnsim;",                          U'\x22E8',   0         },
+            {  "prod;",                            U'\x220F',   0         },
+            {  "profalar;",                        U'\x232E',   0         },
+            {  "profline;",                        U'\x2312',   0         },
+            {  "profsurf;",                        U'\x2313',   0         },
+            {  "prop;",                            U'\x221D',   0         },
+            {  "propto;",                          U'\x221D',   0         },
+            {  "prsim;",                           U'\x227E',   0         },
+            {  "prurel;",                          U'\x22B0',   0         },
+            {  "pscr;",                            U'\x1D4C5',  0         },
+            {  "psi;",                             U'\x3C8',    0         },
+            {  "puncsp;",                          U'\x2008',   0         },
+            {  "qfr;",                             U'\x1D52E',  0         },
+            {  "qint;",                            U'\x2A0C',   0         },
+            {  "qopf;",                            U'\x1D562',  0         },
+            {  "qprime;",                          U'\x2057',   0         },
+            {  "qscr;",                            U'\x1D4C6',  0         },
+            {  "quaternions;",                     U'\x210D',   0         },
+            {  "quatint;",                         U'\x2A16',   0         },
+            {  "quest;",                           U'\x3F',     0         },
+            {  "questeq;",                         U'\x225F',   0         },
+            {  "quot",                             U'\x22',     0         },
+            {  "quot;",                            U'\x22',     0         },
+            {  "rAarr;",                           U'\x21DB',   0         },
+            {  "rArr;",                            U'\x21D2',   0         },
+            {  "rAtail;",                          U'\x291C',   0         },
+            {  "rBarr;",                           U'\x290F',   0         },
+            {  "rHar;",                            U'\x2964',   0         },
+            {  "race;",                            U'\x223D',   U'\x331'  },
+            {  "racute;",                          U'\x155',    0         },
+            {  "radic;",                           U'\x221A',   0         },
+            {  "raemptyv;",                        U'\x29B3',   0         },
+            {  "rang;",                            U'\x27E9',   0         },
+            {  "rangd;",                           U'\x2992',   0         },
+            {  "range;",                           U'\x29A5',   0         },
+            {  "rangle;",                          U'\x27E9',   0         },
+            {  "raquo",                            U'\xBB',     0         },
+            {  "raquo;",                           U'\xBB',     0         },
+            {  "rarr;",                            U'\x2192',   0         },
+            {  "rarrap;",                          U'\x2975',   0         },
+            {  "rarrb;",                           U'\x21E5',   0         },
+            {  "rarrbfs;",                         U'\x2920',   0         },
+            {  "rarrc;",                           U'\x2933',   0         },
+            {  "rarrfs;",                          U'\x291E',   0         },
+            {  "rarrhk;",                          U'\x21AA',   0         },
+            {  "rarrlp;",                          U'\x21AC',   0         },
+            {  "rarrpl;",                          U'\x2945',   0         },
+            {  "rarrsim;",                         U'\x2974',   0         },
+            {  "rarrtl;",                          U'\x21A3',   0         },
+            {  "rarrw;",                           U'\x219D',   0         },
+            {  "ratail;",                          U'\x291A',   0         },
+            {  "ratio;",                           U'\x2236',   0         },
+            {  "rationals;",                       U'\x211A',   0         },
+            {  "rbarr;",                           U'\x290D',   0         },
+            {  "rbbrk;",                           U'\x2773',   0         },
+            {  "rbrace;",                          U'\x7D',     0         },
+            {  "rbrack;",                          U'\x5D',     0         },
+            {  "rbrke;",                           U'\x298C',   0         },
+            {  "rbrksld;",                         U'\x298E',   0         },
+            {  "rbrkslu;",                         U'\x2990',   0         },
+            {  "rcaron;",                          U'\x159',    0         },
+            {  "rcedil;",                          U'\x157',    0         },
+            {  "rceil;",                           U'\x2309',   0         },
+            {  "rcub;",                            U'\x7D',     0         },
+            {  "rcy;",                             U'\x440',    0         },
+            {  "rdca;",                            U'\x2937',   0         },
+            {  "rdldhar;",                         U'\x2969',   0         },
+            {  "rdquo;",                           U'\x201D',   0         },
+            {  "rdquor;",                          U'\x201D',   0         },
+            {  "rdsh;",                            U'\x21B3',   0         },
+            {  "real;",                            U'\x211C',   0         },
+            {  "realine;",                         U'\x211B',   0         },
+            {  "realpart;",                        U'\x211C',   0         },
+            {  "reals;",                           U'\x211D',   0         },
+            {  "rect;",                            U'\x25AD',   0         },
+            {  "reg",                              U'\xAE',     0         },
+            {  "reg;",                             U'\xAE',     0         },
+            {  "rfisht;",                          U'\x297D',   0         },
+            {  "rfloor;",                          U'\x230B',   0         },
+            {  "rfr;",                             U'\x1D52F',  0         },
+            {  "rhard;",                           U'\x21C1',   0         },
+            {  "rharu;",                           U'\x21C0',   0         },
+            {  "rharul;",                          U'\x296C',   0         },
+            {  "rho;",                             U'\x3C1',    0         },
+            {  "rhov;",                            U'\x3F1',    0         },
+            {  "rightarrow;",                      U'\x2192',   0         },
+            {  "rightarrowtail;",                  U'\x21A3',   0         },
+            {  "rightharpoondown;",                U'\x21C1',   0         },
+            {  "rightharpoonup;",                  U'\x21C0',   0         },
+            {  "rightleftarrows;",                 U'\x21C4',   0         },
+            {  "rightleftharpoons;",               U'\x21CC',   0         },
+            {  "rightrightarrows;",                U'\x21C9',   0         },
+            {  "rightsquigarrow;",                 U'\x219D',   0         },
+            {  "rightthreetimes;",                 U'\x22CC',   0         },
+            {  "ring;",                            U'\x2DA',    0         },
+            {  "risingdotseq;",                    U'\x2253',   0         },
+            {  "rlarr;",                           U'\x21C4',   0         },
+            {  "rlhar;",                           U'\x21CC',   0         },
+            {  "rlm;",                             U'\x200F',   0         },
+            {  "rmoust;",                          U'\x23B1',   0         },
+            {  "rmoustache;",                      U'\x23B1',   0         },
+            {  "rnmid;",                           U'\x2AEE',   0         },
+            {  "roang;",                           U'\x27ED',   0         },
+            {  "roarr;",                           U'\x21FE',   0         },
+            {  "robrk;",                           U'\x27E7',   0         },
+            {  "ropar;",                           U'\x2986',   0         },
+            {  "ropf;",                            U'\x1D563',  0         },
+            {  "roplus;",                          U'\x2A2E',   0         },
+            {  "rotimes;",                         U'\x2A35',   0         },
+            {  "rpar;",                            U'\x29',     0         },
+            {  "rpargt;",                          U'\x2994',   0         },
+            {  "rppolint;",                        U'\x2A12',   0         },
+            {  "rrarr;",                           U'\x21C9',   0         },
+            {  "rsaquo;",                          U'\x203A',   0         },
+            {  "rscr;",                            U'\x1D4C7',  0         },
+            {  "rsh;",                             U'\x21B1',   0         },
+            {  "rsqb;",                            U'\x5D',     0         },
+            {  "rsquo;",                           U'\x2019',   0         },
+            {  "rsquor;",                          U'\x2019',   0         },
+            {  "rthree;",                          U'\x22CC',   0         },
+            {  "rtimes;",                          U'\x22CA',   0         },
+            {  "rtri;",                            U'\x25B9',   0         },
+            {  "rtrie;",                           U'\x22B5',   0         },
+            {  "rtrif;",                           U'\x25B8',   0         },
+            {  "rtriltri;",                        U'\x29CE',   0         },
+            {  "ruluhar;",                         U'\x2968',   0         },
+            {  "rx;",                              U'\x211E',   0         },
+            {  "sacute;",                          U'\x15B',    0         },
+            {  "sbquo;",                           U'\x201A',   0         },
+            {  "sc;",                              U'\x227B',   0         },
+            {  "scE;",                             U'\x2AB4',   0         },
+            {  "scap;",                            U'\x2AB8',   0         },
+            {  "scaron;",                          U'\x161',    0         },
+            {  "sccue;",                           U'\x227D',   0         },
+            {  "sce;",                             U'\x2AB0',   0         },
+            {  "scedil;",                          U'\x15F',    0         },
+            {  "scirc;",                           U'\x15D',    0         },
+            {  "scnE;",                            U'\x2AB6',   0         },
+            {  "scnap;",                           U'\x2ABA',   0         },
+            {  "scnsim;",                          U'\x22E9',   0         },
+            {  "scpolint;",                        U'\x2A13',   0         },
+            {  "scsim;",                           U'\x227F',   0         },
+            {  "scy;",                             U'\x441',    0         },
+            {  "sdot;",                            U'\x22C5',   0         },
+            {  "sdotb;",                           U'\x22A1',   0         },
+            {  "sdote;",                           U'\x2A66',   0         },
+            {  "seArr;",                           U'\x21D8',   0         },
+            {  "searhk;",                          U'\x2925',   0         },
+            {  "searr;",                           U'\x2198',   0         },
+            {  "searrow;",                         U'\x2198',   0         },
+            {  "sect",                             U'\xA7',     0         },
+            {  "sect;",                            U'\xA7',     0         },
+            {  "semi;",                            U'\x3B',     0         },
+            {  "seswar;",                          U'\x2929',   0         },
+            {  "setminus;",                        U'\x2216',   0         },
+            {  "setmn;",                           U'\x2216',   0         },
+            {  "sext;",                            U'\x2736',   0         },
+            {  "sfr;",                             U'\x1D530',  0         },
+            {  "sfrown;",                          U'\x2322',   0         },
+            {  "sharp;",                           U'\x266F',   0         },
+            {  "shchcy;",                          U'\x449',    0         },
+            {  "shcy;",                            U'\x448',    0         },
+            {  "shortmid;",                        U'\x2223',   0         },
+            {  "shortparallel;",                   U'\x2225',   0         },
+            {  "shy",                              U'\xAD',     0         },
+            {  "shy;",                             U'\xAD',     0         },
+            {  "sigma;",                           U'\x3C3',    0         },
+            {  "sigmaf;",                          U'\x3C2',    0         },
+            {  "sigmav;",                          U'\x3C2',    0         },
+            {  "sim;",                             U'\x223C',   0         },
+            {  "simdot;",                          U'\x2A6A',   0         },
+            {  "sime;",                            U'\x2243',   0         },
+            {  "simeq;",                           U'\x2243',   0         },
+            {  "simg;",                            U'\x2A9E',   0         },
+            {  "simgE;",                           U'\x2AA0',   0         },
+            {  "siml;",                            U'\x2A9D',   0         },
+            {  "simlE;",                           U'\x2A9F',   0         },
+            {  "simne;",                           U'\x2246',   0         },
+            {  "simplus;",                         U'\x2A24',   0         },
+            {  "simrarr;",                         U'\x2972',   0         },
+            {  "slarr;",                           U'\x2190',   0         },
+            {  "smallsetminus;",                   U'\x2216',   0         },
+            {  "smashp;",                          U'\x2A33',   0         },
+            {  "smeparsl;",                        U'\x29E4',   0         },
+            {  "smid;",                            U'\x2223',   0         },
+            {  "smile;",                           U'\x2323',   0         },
+            {  "smt;",                             U'\x2AAA',   0         },
+            {  "smte;",                            U'\x2AAC',   0         },
+            {  "smtes;",                           U'\x2AAC',   U'\xFE00' },
+            {  "softcy;",                          U'\x44C',    0         },
+            {  "sol;",                             U'\x2F',     0         },
+            {  "solb;",                            U'\x29C4',   0         },
+            {  "solbar;",                          U'\x233F',   0         },
+            {  "sopf;",                            U'\x1D564',  0         },
+            {  "spades;",                          U'\x2660',   0         },
+            {  "spadesuit;",                       U'\x2660',   0         },
+            {  "spar;",                            U'\x2225',   0         },
+            {  "sqcap;",                           U'\x2293',   0         },
+            {  "sqcaps;",                          U'\x2293',   U'\xFE00' },
+            {  "sqcup;",                           U'\x2294',   0         },
+            {  "sqcups;",                          U'\x2294',   U'\xFE00' },
+            {  "sqsub;",                           U'\x228F',   0         },
+            {  "sqsube;",                          U'\x2291',   0         },
+            {  "sqsubset;",                        U'\x228F',   0         },
+            {  "sqsubseteq;",                      U'\x2291',   0         },
+            {  "sqsup;",                           U'\x2290',   0         },
+            {  "sqsupe;",                          U'\x2292',   0         },
+            {  "sqsupset;",                        U'\x2290',   0         },
+            {  "sqsupseteq;",                      U'\x2292',   0         },
+            {  "squ;",                             U'\x25A1',   0         },
+            {  "square;",                          U'\x25A1',   0         },
+            {  "squarf;",                          U'\x25AA',   0         },
+            {  "squf;",                            U'\x25AA',   0         },
+            {  "srarr;",                           U'\x2192',   0         },
+            {  "sscr;",                            U'\x1D4C8',  0         },
+            {  "ssetmn;",                          U'\x2216',   0         },
+            {  "ssmile;",                          U'\x2323',   0         },
+            {  "sstarf;",                          U'\x22C6',   0         },
+            {  "star;",                            U'\x2606',   0         },
+            {  "starf;",                           U'\x2605',   0         },
+            {  "straightepsilon;",                 U'\x3F5',    0         },
+            {  "straightphi;",                     U'\x3D5',    0         },
+            {  "strns;",                           U'\xAF',     0         },
+            {  "sub;",                             U'\x2282',   0         },
+            {  "subE;",                            U'\x2AC5',   0         },
+            {  "subdot;",                          U'\x2ABD',   0         },
+            {  "sube;",                            U'\x2286',   0         },
+            {  "subedot;",                         U'\x2AC3',   0         },
+            {  "submult;",                         U'\x2AC1',   0         },
+            {  "subnE;",                           U'\x2ACB',   0         },
+            {  "subne;",                           U'\x228A',   0         },
+            {  "subplus;",                         U'\x2ABF',   0         },
+            {  "subrarr;",                         U'\x2979',   0         },
+            {  "subset;",                          U'\x2282',   0         },
+            {  "subseteq;",                        U'\x2286',   0         },
+            {  "subseteqq;",                       U'\x2AC5',   0         },
+            {  "subsetneq;",                       U'\x228A',   0         },
+            {  "subsetneqq;",                      U'\x2ACB',   0         },
+            {  "subsim;",                          U'\x2AC7',   0         },
+            {  "subsub;",                          U'\x2AD5',   0         },
+            {  "subsup;",                          U'\x2AD3',   0         },
+            {  "succ;",                            U'\x227B',   0         },
+            {  "succapprox;",                      U'\x2AB8',   0         },
+            {  "succcurlyeq;",                     U'\x227D',   0         },
+            {  "succeq;",                          U'\x2AB0',   0         },
+            {  "succnapprox;",                     U'\x2ABA',   0         },
+            {  "succneqq;",                        U'\x2AB6',   0         },
+            {  "succnsim;",                        U'\x22E9',   0         },
+            {  "succsim;",                         U'\x227F',   0         },
+            {  "sum;",                             U'\x2211',   0         },
+            {  "sung;",                            U'\x266A',   0         },
+            {  "sup1",                             U'\xB9',     0         },
+            {  "sup1;",                            U'\xB9',     0         },
+            {  "sup2",                             U'\xB2',     0         },
+            {  "sup2;",                            U'\xB2',     0         },
+            {  "sup3",                             U'\xB3',     0         },
+            {  "sup3;",                            U'\xB3',     0         },
+            {  "sup;",                             U'\x2283',   0         },
+            {  "supE;",                            U'\x2AC6',   0         },
+            {  "supdot;",                          U'\x2ABE',   0         },
+            {  "supdsub;",                         U'\x2AD8',   0         },
+            {  "supe;",                            U'\x2287',   0         },
+            {  "supedot;",                         U'\x2AC4',   0         },
+            {  "suphsol;",                         U'\x27C9',   0         },
+            {  "suphsub;",                         U'\x2AD7',   0         },
+            {  "suplarr;",                         U'\x297B',   0         },
+            {  "supmult;",                         U'\x2AC2',   0         },
+            {  "supnE;",                           U'\x2ACC',   0         },
+            {  "supne;",                           U'\x228B',   0         },
+            {  "supplus;",                         U'\x2AC0',   0         },
+            {  "supset;",                          U'\x2283',   0         },
+            {  "supseteq;",                        U'\x2287',   0         },
+            {  "supseteqq;",                       U'\x2AC6',   0         },
+            {  "supsetneq;",                       U'\x228B',   0         },
+            {  "supsetneqq;",                      U'\x2ACC',   0         },
+            {  "supsim;",                          U'\x2AC8',   0         },
+            {  "supsub;",                          U'\x2AD4',   0         },
+            {  "supsup;",                          U'\x2AD6',   0         },
+            {  "swArr;",                           U'\x21D9',   0         },
+            {  "swarhk;",                          U'\x2926',   0         },
+            {  "swarr;",                           U'\x2199',   0         },
+            {  "swarrow;",                         U'\x2199',   0         },
+            {  "swnwar;",                          U'\x292A',   0         },
+            {  "szlig",                            U'\xDF',     0         },
+            {  "szlig;",                           U'\xDF',     0         },
+            {  "target;",                          U'\x2316',   0         },
+            {  "tau;",                             U'\x3C4',    0         },
+            {  "tbrk;",                            U'\x23B4',   0         },
+            {  "tcaron;",                          U'\x165',    0         },
+            {  "tcedil;",                          U'\x163',    0         },
+            {  "tcy;",                             U'\x442',    0         },
+            {  "tdot;",                            U'\x20DB',   0         },
+            {  "telrec;",                          U'\x2315',   0         },
+            {  "tfr;",                             U'\x1D531',  0         },
+            {  "there4;",                          U'\x2234',   0         },
+            {  "therefore;",                       U'\x2234',   0         },
+            {  "theta;",                           U'\x3B8',    0         },
+            {  "thetasym;",                        U'\x3D1',    0         },
+            {  "thetav;",                          U'\x3D1',    0         },
+            {  "thickapprox;",                     U'\x2248',   0         },
+            {  "thicksim;",                        U'\x223C',   0         },
+            {  "thinsp;",                          U'\x2009',   0         },
+            {  "thkap;",                           U'\x2248',   0         },
+            {  "thksim;",                          U'\x223C',   0         },
+            {  "thorn",                            U'\xFE',     0         },
+            {  "thorn;",                           U'\xFE',     0         },
+            {  "tilde;",                           U'\x2DC',    0         },
+            {  "times",                            U'\xD7',     0         },
+            {  "times;",                           U'\xD7',     0         },
+            {  "timesb;",                          U'\x22A0',   0         },
+            {  "timesbar;",                        U'\x2A31',   0         },
+            {  "timesd;",                          U'\x2A30',   0         },
+            {  "tint;",                            U'\x222D',   0         },
+            {  "toea;",                            U'\x2928',   0         },
+            {  "top;",                             U'\x22A4',   0         },
+            {  "topbot;",                          U'\x2336',   0         },
+            {  "topcir;",                          U'\x2AF1',   0         },
+            {  "topf;",                            U'\x1D565',  0         },
+            {  "topfork;",                         U'\x2ADA',   0         },
+            {  "tosa;",                            U'\x2929',   0         },
+            {  "tprime;",                          U'\x2034',   0         },
+            {  "trade;",                           U'\x2122',   0         },
+            {  "triangle;",                        U'\x25B5',   0         },
+            {  "triangledown;",                    U'\x25BF',   0         },
+            {  "triangleleft;",                    U'\x25C3',   0         },
+            {  "trianglelefteq;",                  U'\x22B4',   0         },
+            {  "triangleq;",                       U'\x225C',   0         },
+            {  "triangleright;",                   U'\x25B9',   0         },
+            {  "trianglerighteq;",                 U'\x22B5',   0         },
+            {  "tridot;",                          U'\x25EC',   0         },
+            {  "trie;",                            U'\x225C',   0         },
+            {  "triminus;",                        U'\x2A3A',   0         },
+            {  "triplus;",                         U'\x2A39',   0         },
+            {  "trisb;",                           U'\x29CD',   0         },
+            {  "tritime;",                         U'\x2A3B',   0         },
+            {  "trpezium;",                        U'\x23E2',   0         },
+            {  "tscr;",                            U'\x1D4C9',  0         },
+            {  "tscy;",                            U'\x446',    0         },
+            {  "tshcy;",                           U'\x45B',    0         },
+            {  "tstrok;",                          U'\x167',    0         },
+            {  "twixt;",                           U'\x226C',   0         },
+            {  "twoheadleftarrow;",                U'\x219E',   0         },
+            {  "twoheadrightarrow;",               U'\x21A0',   0         },
+            {  "uArr;",                            U'\x21D1',   0         },
+            {  "uHar;",                            U'\x2963',   0         },
+            {  "uacute",                           U'\xFA',     0         },
+            {  "uacute;",                          U'\xFA',     0         },
+            {  "uarr;",                            U'\x2191',   0         },
+            {  "ubrcy;",                           U'\x45E',    0         },
+            {  "ubreve;",                          U'\x16D',    0         },
+            {  "ucirc",                            U'\xFB',     0         },
+            {  "ucirc;",                           U'\xFB',     0         },
+            {  "ucy;",                             U'\x443',    0         },
+            {  "udarr;",                           U'\x21C5',   0         },
+            {  "udblac;",                          U'\x171',    0         },
+            {  "udhar;",                           U'\x296E',   0         },
+            {  "ufisht;",                          U'\x297E',   0         },
+            {  "ufr;",                             U'\x1D532',  0         },
+            {  "ugrave",                           U'\xF9',     0         },
+            {  "ugrave;",                          U'\xF9',     0         },
+            {  "uharl;",                           U'\x21BF',   0         },
+            {  "uharr;",                           U'\x21BE',   0         },
+            {  "uhblk;",                           U'\x2580',   0         },
+            {  "ulcorn;",                          U'\x231C',   0         },
+            {  "ulcorner;",                        U'\x231C',   0         },
+            {  "ulcrop;",                          U'\x230F',   0         },
+            {  "ultri;",                           U'\x25F8',   0         },
+            {  "umacr;",                           U'\x16B',    0         },
+            {  "uml",                              U'\xA8',     0         },
+            {  "uml;",                             U'\xA8',     0         },
+            {  "uogon;",                           U'\x173',    0         },
+            {  "uopf;",                            U'\x1D566',  0         },
+            {  "uparrow;",                         U'\x2191',   0         },
+            {  "updownarrow;",                     U'\x2195',   0         },
+            {  "upharpoonleft;",                   U'\x21BF',   0         },
+            {  "upharpoonright;",                  U'\x21BE',   0         },
+            {  "uplus;",                           U'\x228E',   0         },
+            {  "upsi;",                            U'\x3C5',    0         },
+            {  "upsih;",                           U'\x3D2',    0         },
+            {  "upsilon;",                         U'\x3C5',    0         },
+            {  "upuparrows;",                      U'\x21C8',   0         },
+            {  "urcorn;",                          U'\x231D',   0         },
+            {  "urcorner;",                        U'\x231D',   0         },
+            {  "urcrop;",                          U'\x230E',   0         },
+            {  "uring;",                           U'\x16F',    0         },
+            {  "urtri;",                           U'\x25F9',   0         },
+            {  "uscr;",                            U'\x1D4CA',  0         },
+            {  "utdot;",                           U'\x22F0',   0         },
+            {  "utilde;",                          U'\x169',    0         },
+            {  "utri;",                            U'\x25B5',   0         },
+            {  "utrif;",                           U'\x25B4',   0         },
+            {  "uuarr;",                           U'\x21C8',   0         },
+            {  "uuml",                             U'\xFC',     0         },
+            {  "uuml;",                            U'\xFC',     0         },
+            {  "uwangle;",                         U'\x29A7',   0         },
+            {  "vArr;",                            U'\x21D5',   0         },
+            {  "vBar;",                            U'\x2AE8',   0         },
+            {  "vBarv;",                           U'\x2AE9',   0         },
+            {  "vDash;",                           U'\x22A8',   0         },
+            {  "vangrt;",                          U'\x299C',   0         },
+            {  "varepsilon;",                      U'\x3F5',    0         },
+            {  "varkappa;",                        U'\x3F0',    0         },
+            {  "varnothing;",                      U'\x2205',   0         },
+            {  "varphi;",                          U'\x3D5',    0         },
+            {  "varpi;",                           U'\x3D6',    0         },
+            {  "varpropto;",                       U'\x221D',   0         },
+            {  "varr;",                            U'\x2195',   0         },
+            {  "varrho;",                          U'\x3F1',    0         },
+            {  "varsigma;",                        U'\x3C2',    0         },
+            {  "varsubsetneq;",                    U'\x228A',   U'\xFE00' },
+            {  "varsubsetneqq;",                   U'\x2ACB',   U'\xFE00' },
+            {  "varsupsetneq;",                    U'\x228B',   U'\xFE00' },
+            {  "varsupsetneqq;",                   U'\x2ACC',   U'\xFE00' },
+            {  "vartheta;",                        U'\x3D1',    0         },
+            {  "vartriangleleft;",                 U'\x22B2',   0         },
+            {  "vartriangleright;",                U'\x22B3',   0         },
+            {  "vcy;",                             U'\x432',    0         },
+            {  "vdash;",                           U'\x22A2',   0         },
+            {  "vee;",                             U'\x2228',   0         },
+            {  "veebar;",                          U'\x22BB',   0         },
+            {  "veeeq;",                           U'\x225A',   0         },
+            {  "vellip;",                          U'\x22EE',   0         },
+            {  "verbar;",                          U'\x7C',     0         },
+            {  "vert;",                            U'\x7C',     0         },
+            {  "vfr;",                             U'\x1D533',  0         },
+            {  "vltri;",                           U'\x22B2',   0         },
+            {  "vnsub;",                           U'\x2282',   U'\x20D2' },
+            {  "vnsup;",                           U'\x2283',   U'\x20D2' },
+            {  "vopf;",                            U'\x1D567',  0         },
+            {  "vprop;",                           U'\x221D',   0         },
+            {  "vrtri;",                           U'\x22B3',   0         },
+            {  "vscr;",                            U'\x1D4CB',  0         },
+            {  "vsubnE;",                          U'\x2ACB',   U'\xFE00' },
+            {  "vsubne;",                          U'\x228A',   U'\xFE00' },
+            {  "vsupnE;",                          U'\x2ACC',   U'\xFE00' },
+            {  "vsupne;",                          U'\x228B',   U'\xFE00' },
+            {  "vzigzag;",                         U'\x299A',   0         },
+            {  "wcirc;",                           U'\x175',    0         },
+            {  "wedbar;",                          U'\x2A5F',   0         },
+            {  "wedge;",                           U'\x2227',   0         },
+            {  "wedgeq;",                          U'\x2259',   0         },
+            {  "weierp;",                          U'\x2118',   0         },
+            {  "wfr;",                             U'\x1D534',  0         },
+            {  "wopf;",                            U'\x1D568',  0         },
+            {  "wp;",                              U'\x2118',   0         },
+            {  "wr;",                              U'\x2240',   0         },
+            {  "wreath;",                          U'\x2240',   0         },
+            {  "wscr;",                            U'\x1D4CC',  0         },
+            {  "xcap;",                            U'\x22C2',   0         },
+            {  "xcirc;",                           U'\x25EF',   0         },
+            {  "xcup;",                            U'\x22C3',   0         },
+            {  "xdtri;",                           U'\x25BD',   0         },
+            {  "xfr;",                             U'\x1D535',  0         },
+            {  "xhArr;",                           U'\x27FA',   0         },
+            {  "xharr;",                           U'\x27F7',   0         },
+            {  "xi;",                              U'\x3BE',    0         },
+            {  "xlArr;",                           U'\x27F8',   0         },
+            {  "xlarr;",                           U'\x27F5',   0         },
+            {  "xmap;",                            U'\x27FC',   0         },
+            {  "xnis;",                            U'\x22FB',   0         },
+            {  "xodot;",                           U'\x2A00',   0         },
+            {  "xopf;",                            U'\x1D569',  0         },
+            {  "xoplus;",                          U'\x2A01',   0         },
+            {  "xotime;",                          U'\x2A02',   0         },
+            {  "xrArr;",                           U'\x27F9',   0         },
+            {  "xrarr;",                           U'\x27F6',   0         },
+            {  "xscr;",                            U'\x1D4CD',  0         },
+            {  "xsqcup;",                          U'\x2A06',   0         },
+            {  "xuplus;",                          U'\x2A04',   0         },
+            {  "xutri;",                           U'\x25B3',   0         },
+            {  "xvee;",                            U'\x22C1',   0         },
+            {  "xwedge;",                          U'\x22C0',   0         },
+            {  "yacute",                           U'\xFD',     0         },
+            {  "yacute;",                          U'\xFD',     0         },
+            {  "yacy;",                            U'\x44F',    0         },
+            {  "ycirc;",                           U'\x177',    0         },
+            {  "ycy;",                             U'\x44B',    0         },
+            {  "yen",                              U'\xA5',     0         },
+            {  "yen;",                             U'\xA5',     0         },
+            {  "yfr;",                             U'\x1D536',  0         },
+            {  "yicy;",                            U'\x457',    0         },
+            {  "yopf;",                            U'\x1D56A',  0         },
+            {  "yscr;",                            U'\x1D4CE',  0         },
+            {  "yucy;",                            U'\x44E',    0         },
+            {  "yuml",                             U'\xFF',     0         },
+            {  "yuml;",                            U'\xFF',     0         },
+            {  "zacute;",                          U'\x17A',    0         },
+            {  "zcaron;",                          U'\x17E',    0         },
+            {  "zcy;",                             U'\x437',    0         },
+            {  "zdot;",                            U'\x17C',    0         },
+            {  "zeetrf;",                          U'\x2128',   0         },
+            {  "zeta;",                            U'\x3B6',    0         },
+            {  "zfr;",                             U'\x1D537',  0         },
+            {  "zhcy;",                            U'\x436',    0         },
+            {  "zigrarr;",                         U'\x21DD',   0         },
+            {  "zopf;",                            U'\x1D56B',  0         },
+            {  "zscr;",                            U'\x1D4CF',  0         },
+            {  "zwj;",                             U'\x200D',   0         },
+            {  "zwnj;",                            U'\x200C',   0         }
+        };
 
-        const char32_t* begin = encode;
-        unsigned int    length = 0;
-        while (encode[length] != U';' && length < 10)
-            length++;
-        if (length >= 10)
-            return 0; // throw "XhtmlEntityResolver::resolveEntity() -> Buffer overrun on search for end marker!"
+        constexpr size_t NamedEntityCount = sizeof(NamedEntities) / sizeof(NamedEntities[0]);
 
-        // entity references always end with a semi-colon ';'
-        if (length == 0)
-            return 0; // throw "XhtmlEntityResolver::resolveEntity() -> No end marker found!"
-
-        // skip leading white-space characters
-        while (tgui::isWhitespace(*begin) && length > 0)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Checks whether the named entities are sorted by name and fit into the maximum entity length
+        ///
+        /// The check of all 2231 names takes up to 1M constant evaluation operations (GCC counts), above the MSVC default
+        /// budget - TGUI-XHTML.vcxproj raises it with /constexpr:steps (the GCC default suffices).
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        constexpr bool areNamedEntitiesValid()
         {
-            begin++; length--;
-        }
+            for (size_t index = 0; index < NamedEntityCount; index++)
+            {
+                size_t length = 0;
+                while (NamedEntities[index].Name[length] != '\0')
+                    length++;
+                if (length == 0 || length + 1 > XhtmlEntityResolver::MaxEntityLength)
+                    return false;
 
-        // remaining string (including semi-colon)
-        // must be at least 4 characters in length
-        if (length < 3)
-            return 0; // throw "XhtmlEntityResolver::resolveEntity() -> Buffer underrun on search for end marker!"
+                if (index == 0)
+                    continue;
 
-        // entity references always begin with an ampersand '&' symbol
-        if (*begin != U'&')
-            return 0; // throw "XhtmlEntityResolver::resolveEntity() -> No begin marker!"
+                const char* previous = NamedEntities[index - 1].Name;
+                const char* current  = NamedEntities[index].Name;
+                while (*previous != '\0' && *previous == *current)
+                {
+                    previous++; current++;
+                }
+                if (static_cast<unsigned char>(*previous) >= static_cast<unsigned char>(*current))
+                    return false;
+            }
+            return true;
+        }
 
-        begin++;
+        static_assert(areNamedEntitiesValid(), "The named entities must be unique, sorted and not exceed the maximum entity length!");
 
-        // numeric (decimal or hexadecimal) entity reference?
-        if (*begin == U'#')
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief The characters of the numeric references 0x80 ... 0x9F, that are interpreted as windows-1252 (like browsers do)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        constexpr char32_t Windows1252Characters[32] =
         {
-            begin++;
-            char32_t  chTemp = *begin;
-            const int radix = (std::isdigit(chTemp) ? 10 :
-                (chTemp == U'x' || chTemp == U'X' ? 16 : 0));
-            if (radix != 0)
-            {
-                if (radix == 16)
-                    begin++;
+            U'\x20AC', U'\x0081', U'\x201A', U'\x0192', U'\x201E', U'\x2026', U'\x2020', U'\x2021',
+            U'\x02C6', U'\x2030', U'\x0160', U'\x2039', U'\x0152', U'\x008D', U'\x017D', U'\x008F',
+            U'\x0090', U'\x2018', U'\x2019', U'\x201C', U'\x201D', U'\x2022', U'\x2013', U'\x2014',
+            U'\x02DC', U'\x2122', U'\x0161', U'\x203A', U'\x0153', U'\x009D', U'\x017E', U'\x0178'
+        };
 
-                unsigned long ulNum = toULong(begin, radix);
-                substitute = static_cast<char32_t>(ulNum);
-                length++;
-                return length;
-            }
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Converts a character of the buffer to UTF-32 (bytes are interpreted as unsigned)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        inline char32_t toCharacter(char character)
+        {   return static_cast<char32_t>(static_cast<unsigned char>(character));   }
+
+        inline char32_t toCharacter(char32_t character)
+        {   return character;   }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Determines the value of a (decimal or hexadecimal) digit
+        ///
+        /// @return The value of the digit, or 16 if the character is no digit
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        inline unsigned int toDigitValue(char32_t character)
+        {
+            if (character >= U'0' && character <= U'9')
+                return static_cast<unsigned int>(character - U'0');
+            if (character >= U'a' && character <= U'f')
+                return static_cast<unsigned int>(character - U'a' + 10);
+            if (character >= U'A' && character <= U'F')
+                return static_cast<unsigned int>(character - U'A' + 10);
+            return 16;
         }
 
-        // character entity reference
-        else
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Narrows a trie node (a range of NamedEntities) to the child node for the indicated character
+        ///
+        /// @param first      [IN/OUT] The first index of the range
+        /// @param last       [IN/OUT] The index behind the last index of the range
+        /// @param depth      The depth of the node (the length of the prefix, that is common to all names of the range)
+        /// @param character  The next character
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        inline void narrowNode(size_t& first, size_t& last, size_t depth, unsigned char character)
         {
-            tgui::String	strKey(begin, length - 1);
+            size_t lower = first;
+            size_t upper = last;
+            while (lower < upper)
+            {
+                const size_t middle = lower + (upper - lower) / 2;
+                if (static_cast<unsigned char>(NamedEntities[middle].Name[depth]) < character)
+                    lower = middle + 1;
+                else
+                    upper = middle;
+            }
+            first = lower;
 
-            // because some character entity references are
-            // case-sensitive, we must fix them manually
-            if (strKey.equalIgnoreCase(U"eth") ||
-                strKey.equalIgnoreCase(U"thorn"))
+            upper = last;
+            while (lower < upper)
             {
-                if (strKey[0] == U'E' || strKey[0] == U'T')
-                    std::transform(strKey.begin(), strKey.end(), strKey.begin(), ::toupper);
+                const size_t middle = lower + (upper - lower) / 2;
+                if (static_cast<unsigned char>(NamedEntities[middle].Name[depth]) <= character)
+                    lower = middle + 1;
                 else
-                    std::transform(strKey.begin(), strKey.end(), strKey.begin(), ::tolower);
+                    upper = middle;
             }
-            else if (strKey.equalIgnoreCase(U"Oslash"))
+            last = lower;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Resolves a numeric character reference ("&#" followed by decimal digits or "&#x" followed by hex digits)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <typename CharT>
+        unsigned int resolveNumericEntity(const CharT* encode, size_t length, bool isClipped, char32_t& substitute)
+        {
+            size_t       position = 2;
+            unsigned int radix = 10;
+            if (position < length && (toCharacter(encode[position]) == U'x' || toCharacter(encode[position]) == U'X'))
             {
-                std::transform(strKey.begin(), strKey.end(), strKey.begin(), ::tolower);
-                strKey[0] = U'O';
+                radix = 16;
+                position++;
             }
-            else if (strKey.equalIgnoreCase(U"AElig"))
+
+            const size_t  firstDigitPosition = position;
+            std::uint32_t value = 0;
+            for (; position < length; position++)
             {
-                std::transform(strKey.begin(), strKey.end(), strKey.begin(), ::tolower);
-                strKey[0] = U'A';
-                strKey[1] = U'E';
+                const unsigned int digitValue = toDigitValue(toCharacter(encode[position]));
+                if (digitValue >= radix)
+                    break;
+                // saturate, any value beyond the UNICODE range is invalid anyway
+                if (value <= 0x10FFFF)
+                    value = value * radix + digitValue;
             }
+
+            if (position == firstDigitPosition)
+                return 0;
+            if (position < length && toCharacter(encode[position]) == U';')
+                position++;
+            else if (position == length && isClipped)
+                return 0; // the digits exceed the look-ahead
+
+            if (value == 0 || value > 0x10FFFF || (value >= 0xD800 && value <= 0xDFFF))
+                substitute = U'\xFFFD';
+            else if (value >= 0x80 && value <= 0x9F)
+                substitute = Windows1252Characters[value - 0x80];
             else
+                substitute = static_cast<char32_t>(value);
+            return static_cast<unsigned int>(position);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Resolves the longest named character reference
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <typename CharT>
+        unsigned int resolveNamedEntity(const CharT* encode, size_t length, bool isAttribute, char32_t& substitute, char32_t& secondSubstitute)
+        {
+            size_t first = 0;
+            size_t last = NamedEntityCount;
+            size_t matchIndex = NamedEntityCount;
+            size_t matchLength = 0;
+            for (size_t depth = 0; depth + 1 < length; depth++)
             {
-                char32_t     chrHead = strKey[0];
-                tgui::String strTail = strKey.substr(1);
-                std::transform(strKey.begin(), strKey.end(), strKey.begin(), ::tolower);
-                if (strTail.equalIgnoreCase(U"grave") ||
-                    strTail.equalIgnoreCase(U"acute") ||
-                    strTail.equalIgnoreCase(U"circ")  ||
-                    strTail.equalIgnoreCase(U"uml")   ||
-                    strTail.equalIgnoreCase(U"tilde") ||
-                    strTail.equalIgnoreCase(U"cedil") ||
-                    strTail.equalIgnoreCase(U"ring")     )
+                // no name contains '\0', and narrowing to the names that end at this depth would index behind them
+                const char32_t character = toCharacter(encode[depth + 1]);
+                if (character == 0 || character > 0x7F)
+                    break;
+
+                narrowNode(first, last, depth, static_cast<unsigned char>(character));
+                if (first == last)
+                    break;
+
+                // the names are sorted, so a name that ends at this depth is the first one of the range
+                if (NamedEntities[first].Name[depth + 1] == '\0')
                 {
-                    strKey[0] = chrHead; // strTail[0];
+                    matchIndex = first;
+                    matchLength = depth + 1;
                 }
+                if (character == U';')
+                    break;
             }
 
-            // is this a known entity reference?
-            auto iterator = m_charEntityRefs.find(strKey);
-            if (iterator != m_charEntityRefs.end())
+            if (matchIndex == NamedEntityCount)
+                return 0;
+
+            // within attribute values, a legacy reference without terminating semicolon must not be the prefix of an (unknown)
+            // alphanumeric word - e.g. a query string like "?a=1&copy=2" (text content resolves "&copy2023" like browsers do)
+            if (isAttribute && NamedEntities[matchIndex].Name[matchLength - 1] != ';' && matchLength + 1 < length)
+            {
+                const char32_t next = toCharacter(encode[matchLength + 1]);
+                if ((next >= U'0' && next <= U'9') || (next >= U'a' && next <= U'z') || (next >= U'A' && next <= U'Z') || next == U'=')
+                    return 0;
+            }
+
+            substitute = NamedEntities[matchIndex].Character;
+            secondSubstitute = NamedEntities[matchIndex].SecondCharacter;
+            return static_cast<unsigned int>(matchLength + 1);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Resolves the named or numeric character reference at the beginning of the indicated characters
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <typename CharT>
+        unsigned int resolveEntityReference(XhtmlDiagnostics& diagnostics, const CharT* encode,
+                                            size_t length, bool isAttribute, char32_t& substitute, char32_t& secondSubstitute)
+        {
+            if (encode == nullptr)
             {
-                substitute = iterator->second;
-                length++;
-                return length;
+                diagnostics.report(XhtmlDiagnosticCode::EntityInvalid);
+                return 0;
             }
+
+            secondSubstitute = 0;
+
+            // the shortest entity references are the legacy ones like "&lt" and numeric ones like "&#9"
+            if (length < 3 || toCharacter(encode[0]) != U'&')
+                return 0;
+
+            const bool isClipped = (length > XhtmlEntityResolver::MaxEntityLength);
+            if (isClipped)
+                length = XhtmlEntityResolver::MaxEntityLength;
+
+            if (toCharacter(encode[1]) == U'#')
+                return resolveNumericEntity(encode, length, isClipped, substitute);
+            return resolveNamedEntity(encode, length, isAttribute, substitute, secondSubstitute);
         }
+    }
 
-        return 0;
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int XhtmlEntityResolver::resolveEntity(XhtmlDiagnostics& diagnostics, const char32_t* encode,
+                                                    size_t length, char32_t& substitute, char32_t& secondSubstitute, bool isAttribute)
+    {
+        return resolveEntityReference(diagnostics, encode, length, isAttribute, substitute, secondSubstitute);
     }
 
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    unsigned long XhtmlEntityResolver::toULong(const char32_t* value, int radix)
+    unsigned int XhtmlEntityResolver::resolveEntity(XhtmlDiagnostics& diagnostics, const char* encode,
+                                                    size_t length, char32_t& substitute, char32_t& secondSubstitute, bool isAttribute)
     {
-        std::string buffer;
-        while (*value == U'-' || (*value > U'0' && *value < U'9'))
-        {
-            buffer.push_back(static_cast<char>(*value));
-            value++;
-        }
-        return std::stoul(buffer, nullptr, radix);
+        return resolveEntityReference(diagnostics, encode, length, isAttribute, substitute, secondSubstitute);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,47 @@
+#include <memory>
+#include <memory_resource>
+
+#include <TGUI/Config.hpp>
+#include <TGUI/TGUI.hpp>
+
+// MSC needs a clear distiction between "__declspec(dllimport)" (above) and "__declspec(dllexport)" (below) this comment.
+// So in the case of direct source file integration (in contrast to library creation and linking), the API must be 'dllexport'.
+#ifndef TGUI_STATIC
+#ifdef TGUI_SYSTEM_WINDOWS
+#undef TGUI_API
+#define TGUI_API __declspec(dllexport)
+#endif
+#endif
+
+#include "TGUI/Xhtml/Dom/XhtmlMemoryResource.hpp"
+
+namespace tgui  { namespace xhtml
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    XhtmlMemoryResource::Ptr XhtmlMemoryResource::createArena(size_t initialSize)
+    {
+        // the arena itself is allocated from the heap, only its blocks are requested from the upstream (default) resource
+        return std::make_shared<std::pmr::monotonic_buffer_resource>(initialSize);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    XhtmlMemoryResource::Ptr XhtmlMemoryResource::wrap(std::pmr::memory_resource* resource)
+    {
+        if (resource == nullptr)
+            return nullptr;
+        return XhtmlMemoryResource::Ptr(resource, [](std::pmr::memory_resource*) { /* owned by the caller */ });
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    XhtmlMemoryResource::Ptr& XhtmlMemoryResource::current()
+    {
+        static thread_local XhtmlMemoryResource::Ptr currentResource;
+        return currentResource;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+} }
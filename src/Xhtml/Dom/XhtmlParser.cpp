@@ -1,10 +1,24 @@
 ﻿#include <iostream>
 #include <memory>
 #include <cstdint>
+#include <cstring>
 
 #include <TGUI/Config.hpp>
 #include <TGUI/TGUI.hpp>
 
+// The delimiter scanner uses SSE2/AVX2, if the compiler targets these instruction sets (x86-64 always provides SSE2).
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define TGUI_XHTML_PARSER_AVX2
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#include <emmintrin.h>
+#define TGUI_XHTML_PARSER_SSE2
+#endif
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
 // MSC needs a clear distiction between "__declspec(dllimport)" (above) and "__declspec(dllexport)" (below) this comment.
 // So in the case of direct source file integration (in contrast to library creation and linking), the API must be 'dllexport'.
 #ifndef TGUI_STATIC
@@ -15,6 +29,7 @@
 #endif
 
 #include "TGUI/Xhtml/StringHelper.hpp"
+#include "TGUI/Xhtml/UtfHelper.hpp"
 #include "TGUI/Xhtml/Dom/XhtmlParser.hpp"
 
 namespace tgui  { namespace xhtml
@@ -23,46 +38,40 @@ namespace tgui  { namespace xhtml
 
     bool XhtmlParser::parseComment(tgui::String& comment)
     {
-        const tgui::String commentEnd(U"--");
-        if (m_bufferPos + 4 > m_buffer.size())
+        const size_t bufferSize = getBufferSize();
+        if (m_bufferPos + 4 > bufferSize)
             return false;
 
-        if (m_buffer[m_bufferPos] != '<' || m_buffer[m_bufferPos + 1] != '!' || m_buffer[m_bufferPos + 2] != '-' || m_buffer[m_bufferPos + 3] != '-')
+        if (peekChar(m_bufferPos) != '<' || peekChar(m_bufferPos + 1) != '!' || peekChar(m_bufferPos + 2) != '-' || peekChar(m_bufferPos + 3) != '-')
             return false;
 
         size_t startPosition = m_bufferPos + 4;
-        size_t workPosition = m_buffer.find(commentEnd, startPosition);
+        size_t workPosition = findInBuffer("--", startPosition);
         if (workPosition == tgui::String::npos)
         {
-            tgui::String message(U"XhtmlParser::parseComment() -> Probably not closed comment tag, starting at position: ");
-            message.append(tgui::String::fromNumber(m_bufferPos));
-            m_messages.push_back(std::make_tuple(MessageType::ERROR, message));
+            m_diagnostics.report(XhtmlDiagnosticCode::CommentNotClosed);
 
-            comment = m_buffer.substr(startPosition);
-            m_bufferPos += 4 + comment.size();
+            appendBufferRange(comment, startPosition, bufferSize - startPosition);
+            m_bufferPos = bufferSize;
             return true;
         }
 
-        comment = m_buffer.substr(startPosition, workPosition - startPosition);
+        appendBufferRange(comment, startPosition, workPosition - startPosition);
 
         workPosition += 2;
-        if (workPosition >= m_buffer.size())
+        if (workPosition >= bufferSize)
         {
-            tgui::String message(U"XhtmlParser::parseComment() -> Probably incomplete character stream at the end of comment tag, starting at position: ");
-            message.append(tgui::String::fromNumber(m_bufferPos));
-            m_messages.push_back(std::make_tuple(MessageType::ERROR, message));
+            m_diagnostics.report(XhtmlDiagnosticCode::CommentIncomplete);
 
             return false;
         }
 
-        while (tgui::isWhitespace(m_buffer[workPosition]))
+        while (tgui::isWhitespace(peekChar(workPosition)))
             workPosition++;
 
-        if(m_buffer[workPosition] != '>')
+        if(peekChar(workPosition) != '>')
         {
-            tgui::String message(U"XhtmlParser::parseComment() -> Probably not accurate closed comment tag, starting at position: ");
-            message.append(tgui::String::fromNumber(m_bufferPos));
-            m_messages.push_back(std::make_tuple(MessageType::ERROR, message));
+            m_diagnostics.report(XhtmlDiagnosticCode::CommentNotAccuratelyClosed);
 
             m_bufferPos = workPosition;
             return false;
@@ -76,28 +85,198 @@ namespace tgui  { namespace xhtml
 
     size_t XhtmlParser::parseDocument(bool resolveEntities, bool traceResult)
     {
-        if (m_buffer.empty())
+        if (getBufferSize() == 0)
+            return false;
+
+        XhtmlMemoryScope memoryScope(m_memoryResource);
+        parseDocument_resetState();
+        parseDocument_parseBuffer(resolveEntities, true);
+        return parseDocument_finish(traceResult);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    size_t XhtmlParser::feed(tgui::CharStringView chunk, bool resolveEntities)
+    {
+        if (!m_isIncremental)
+        {
+            m_diagnostics.report(XhtmlDiagnosticCode::FeedNotIncremental);
+            return 0;
+        }
+        if (m_isFinished)
+        {
+            m_diagnostics.report(XhtmlDiagnosticCode::FeedAfterFinish);
+            return 0;
+        }
+
+        // discard the bytes, that have been completely processed (the pending inner text starts at the work start position)
+        const size_t processedBytes = std::min(m_workStartPosition, m_bufferPos);
+        if (processedBytes > 0)
+        {
+            // count the line breaks of the discarded bytes, they are not available for the diagnostics location afterwards
+            locateDiagnostics(processedBytes);
+            m_feedBuffer.erase(0, processedBytes);
+            m_feedOffset        += processedBytes;
+            m_bufferPos         -= processedBytes;
+            m_workStartPosition -= processedBytes;
+
+            // the search for the end of the pending markup continues behind the already searched bytes
+            if (m_markupScan.Start != tgui::String::npos && m_markupScan.Start >= processedBytes)
+            {
+                m_markupScan.Start    -= processedBytes;
+                m_markupScan.Position -= processedBytes;
+                if (m_markupScan.End != tgui::String::npos)
+                    m_markupScan.End  -= processedBytes;
+            }
+            else
+                m_markupScan = MarkupScan();
+        }
+
+        m_feedBuffer.append(chunk.data(), chunk.size());
+        m_utf8Buffer = tgui::CharStringView(m_feedBuffer);
+
+        XhtmlMemoryScope memoryScope(m_memoryResource);
+        parseDocument_parseBuffer(resolveEntities, false);
+        return m_feedOffset + m_bufferPos;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    size_t XhtmlParser::finish(bool resolveEntities, bool traceResult)
+    {
+        if (!m_isIncremental || m_isFinished)
+            return m_feedOffset + m_bufferPos;
+
+        m_isFinished = true;
+        XhtmlMemoryScope memoryScope(m_memoryResource);
+        parseDocument_parseBuffer(resolveEntities, true);
+        return parseDocument_finish(traceResult);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void XhtmlParser::parseDocument_resetState()
+    {
+        m_isDocumentStarted = false;
+        m_markupScan        = MarkupScan();
+        m_workStartPosition = 0;
+        m_workDataLen       = 0;
+        m_characters.clear();
+        m_isInsideScript    = false;
+        m_preformattedDepth = 0;
+        m_parentElements.clear();
+        m_lineNumber        = 1;
+        m_lineStartOffset   = 0;
+        m_lineScanOffset    = 0;
+
+        // set a defined element tree root to prevent problems with m_parentElements.back()
+        m_parentElements.push_back(nullptr);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool XhtmlParser::parseDocument_skipDocumentStart(bool isFinal)
+    {
+        if (m_isDocumentStarted)
+            return true;
+
+        // the byte order mark can not be recognized before the first 3 bytes are available
+        if (!isFinal && getBufferSize() < 3)
+            return false;
+
+        // skip the UTF-8 byte order mark (in UTF-32 mode it is a ZERO WIDTH NO-BREAK SPACE and part of the content)
+        if (m_isUtf8Buffer && m_bufferPos == 0 && getBufferSize() >= 3 &&
+            peekChar(0) == 0xEF && peekChar(1) == 0xBB && peekChar(2) == 0xBF)
+            m_bufferPos = 3;
+
+        while (tgui::isWhitespace(peekChar(m_bufferPos)))
+            m_bufferPos++;
+        if (!isFinal && m_bufferPos >= getBufferSize())
+            return false;
+
+        m_workStartPosition = m_bufferPos;
+        m_isDocumentStarted = true;
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool XhtmlParser::parseDocument_isMarkupComplete(size_t position)
+    {
+        const size_t bufferSize = getBufferSize();
+
+        // parseElement() doesn't accept tags too close to the end of the buffer
+        if (position + 4 >= bufferSize)
+            return false;
+
+        if (peekChar(position + 1) == '!' && peekChar(position + 2) == '-' && peekChar(position + 3) == '-')
+        {
+            // continue the search of the previous call, if the comment is still pending
+            if (m_markupScan.Start != position)
+            {
+                m_markupScan          = MarkupScan();
+                m_markupScan.Start    = position;
+                m_markupScan.Position = position + 4;
+            }
+
+            // a comment is complete, if the '--' is followed by anything but whitespaces (parseComment() decides about '>')
+            if (!m_markupScan.AfterCommentEnd)
+            {
+                const size_t workPosition = findInBuffer("--", m_markupScan.Position);
+                if (workPosition == tgui::String::npos)
+                {
+                    // the last byte might be the first '-' of a '--', that is split across chunks
+                    m_markupScan.Position = std::max(m_markupScan.Position, bufferSize - 1);
+                    return false;
+                }
+                m_markupScan.AfterCommentEnd = true;
+                m_markupScan.Position        = workPosition + 2;
+            }
+            while (m_markupScan.Position < bufferSize && tgui::isWhitespace(peekChar(m_markupScan.Position)))
+                m_markupScan.Position++;
+            return m_markupScan.Position < bufferSize;
+        }
+
+        // a tag, that isn't delimited within MaxTagLength bytes, needs no further bytes (parseElement() rejects it)
+        return (findTagEnd(position) != tgui::String::npos || m_markupScan.IsTooLong);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool XhtmlParser::parseDocument_isScriptMarkup(size_t position) const
+    {
+        if (peekChar(position + 1) == '!')
+            return (peekChar(position + 2) == '-' && peekChar(position + 3) == '-');
+
+        if (peekChar(position + 1) != '/')
             return false;
 
-        char32_t                       workCharacter = acquireChar(); //!< Current character to evaluate
-        size_t	                       workStartPosition = 0;         //!< Start position of character data
-        size_t                         workDataLen = 0;               //!< Length of character data
-        tgui::String                   characters;                    //!< Last collection of unassociated characters
-        tgui::String                   comment;                       //!< Last comment text buffer
-        bool                           isOpeningTag = false;          //!< Determine whether current character position is inside opening tag
-        bool                           isClosingTag = false;          //!< Determine whether current character position is inside closing tag
-        bool                           isInsideScript = false;        //!< Determine whether current character position is between '<script ...>' and '</script>' tags
-        int                            preformattedDepth = 0;         //!< Count the currently open '<pre ...>' tags
-        std::vector<XhtmlElement::Ptr> parentElements;
+        const char* scriptTypeName = "script";
+        for (size_t index = 0; index < 6; index++)
+        {
+            char32_t c = peekChar(position + 2 + index);
+            if (c >= 'A' && c <= 'Z')
+                c += 'a' - 'A';
+            if (c != static_cast<char32_t>(scriptTypeName[index]))
+                return false;
+        }
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        // set a defined element tree root to prevent problems with parentElements.back()
-        parentElements.push_back(nullptr);
+    void XhtmlParser::parseDocument_parseBuffer(bool resolveEntities, bool isFinal)
+    {
+        if (!parseDocument_skipDocumentStart(isFinal))
+            return;
 
-        while (tgui::isWhitespace(workCharacter))
-            workCharacter = acquireChar();
-        rejectChar();
+        char32_t     workCharacter = 0; //!< Current character to evaluate
+        tgui::String comment;           //!< Last comment text buffer
+        bool         isOpeningTag;      //!< Determine whether current character position is inside opening tag
+        bool         isClosingTag;      //!< Determine whether current character position is inside closing tag
+        bool         isSuspended = false;
 
-        while ((workCharacter = acquireChar()) != 0)
+        while (!isSuspended && (workCharacter = acquireChar()) != 0)
         {
             switch(workCharacter)
             {
@@ -110,6 +289,50 @@ namespace tgui  { namespace xhtml
                     XhtmlElement::Ptr newElement = nullptr;
                     rejectChar();
 
+                    // inside a script only comments and the '</script' end tag are markup - any other '<' (e.g. a compare
+                    // operator or a tag within the code) is script content and can be skipped without parsing attempt
+                    if (m_isInsideScript)
+                    {
+                        if (!isFinal && m_bufferPos + 9 > getBufferSize())
+                        {
+                            isSuspended = true;
+                            break;
+                        }
+                        if (!parseDocument_isScriptMarkup(m_bufferPos))
+                        {
+                            m_workDataLen++;
+                            acquireChar();
+                            break;
+                        }
+                    }
+
+                    // a '<', that is not followed by a type name, '/' or '!', is plain text (e.g. a compare operator) - it
+                    // starts no markup, so the parsing doesn't have to wait for a '>', that might never come
+                    if (!isFinal && m_bufferPos + 1 >= getBufferSize())
+                    {
+                        isSuspended = true;
+                        break;
+                    }
+                    const char32_t markupCharacter = peekChar(m_bufferPos + 1);
+                    if (!tgui::isAlpha(markupCharacter) && markupCharacter != '/' && markupCharacter != '!')
+                    {
+                        locateDiagnostics(m_bufferPos);
+                        m_diagnostics.report(XhtmlDiagnosticCode::TagTypeNameStartInvalid);
+                        m_workDataLen++;
+                        acquireChar();
+                        break;
+                    }
+
+                    // wait for the remaining markup, if the tag is split across chunks (incremental mode)
+                    if (!isFinal && !parseDocument_isMarkupComplete(m_bufferPos))
+                    {
+                        isSuspended = true;
+                        break;
+                    }
+
+                    // all diagnostics of the tag (and of the preceding inner text) refer to the tag start
+                    locateDiagnostics(m_bufferPos);
+
                     // try to recognize a comment tag prior an element tag, because comment tags can not be nested and are easier
                     comment.clear();
                     if (!parseComment(comment))
@@ -118,7 +341,7 @@ namespace tgui  { namespace xhtml
                         isClosingTag        = false;
 
                         // try to recognize element tag, if recognition of a comment tag failed
-                        if ((newElement = parseElement(nullptr, isOpeningTag, isClosingTag, isInsideScript)) != nullptr)
+                        if ((newElement = parseElement(nullptr, isOpeningTag, isClosingTag, m_isInsideScript)) != nullptr)
                         {
                             // [1 - see below] postpone the registation of the 'newElement' to the parent/root element collection here
                             // (there might be remaining 'characters' that must be processed first)
@@ -129,73 +352,66 @@ namespace tgui  { namespace xhtml
                                 isClosingTag = true;
                             }
                             // special script mode handling
-                            if (isOpeningTag && !isInsideScript)
+                            if (isOpeningTag && !m_isInsideScript)
                             {
                                 if (tgui::viewEqualIgnoreCase(newElement->getTypeName(), "script"))
                                     if (!newElement->getParsedAsAutoClosed())
-                                        isInsideScript = true;
+                                        m_isInsideScript = true;
                             }
-                            if (isClosingTag && isInsideScript)
+                            if (isClosingTag && m_isInsideScript)
                             {
                                 if (tgui::viewEqualIgnoreCase(newElement->getTypeName(), "script"))
-                                    isInsideScript = false;
+                                    m_isInsideScript = false;
                             }
                         }
                         // neither comment nor element tag recognized, handle the current character like tag content
                         else
                         {
-                            workDataLen++;
+                            m_workDataLen++;
                             acquireChar();
                             break;
                         }
                     }
 
                     // prepare current character(s) for tag content, if any
-                    if (workDataLen)
-                        characters.append(m_buffer.substr(workStartPosition, workDataLen));
-                    if (characters.size())
-                    {
-                        if (preformattedDepth == 0)
-                            parseDocument_cleanBreaksAndSpaces(parentElements.back(), characters);
-                        else
-                            characters.replace(U"\r\n", U"\n");
-                    }
+                    if (m_workDataLen)
+                        appendBufferRange(m_characters, m_workStartPosition, m_workDataLen);
+                    if (m_characters.size())
+                        parseDocument_cleanBreaksAndSpaces(m_parentElements.back(), m_characters, m_preformattedDepth);
 
                     // register current character(s) for tag content, if any
-                    if (characters.size())
+                    if (m_characters.size())
                     {
-                        auto parentElement  = parentElements.back();
+                        auto parentElement  = m_parentElements.back();
                         if (parentElement != nullptr)
                         {
                             auto parentStyle = std::dynamic_pointer_cast<XhtmlStyle>(parentElement);
                             auto parentContainer = std::dynamic_pointer_cast<XhtmlContainerElement>(parentElement);
                             if (parentStyle != nullptr)
                             {
-                                parentStyle->createEntriesFromParseData(m_messages, characters);
+                                parentStyle->createEntriesFromParseData(m_diagnostics, m_characters);
                             }
                             else if (parentContainer != nullptr)
                             {
-                                parseDocument_createInnerText(parentElement, characters, preformattedDepth);
+                                parseDocument_createInnerText(parentElement, m_characters);
                             }
                             else
                             {
-                                tgui::String message(U"XhtmlParser::parseDocument() -> An inner text '");
-                                message.append(characters).append(U"' should have a parent style element or parent container element, but parent element is of type '");
-                                message.append(parentElement->getTypeNameU32()).append(U"'!");
-                                m_messages.push_back(std::make_tuple(MessageType::ERROR, message));
+                                if (m_diagnostics.isCollecting())
+                                    m_diagnostics.report(XhtmlDiagnosticCode::InnerTextParentInvalid, m_characters, parentElement->getTypeNameU32());
+                                else
+                                    m_diagnostics.report(XhtmlDiagnosticCode::InnerTextParentInvalid);
                             }
                         }
                         else
                         {
-                            tgui::String message(U"XhtmlParser::parseDocument() -> An inner text '");
-                            message.append(characters).append(U"' should have a parent container element, but hasn't!");
-                            m_messages.push_back(std::make_tuple(MessageType::ERROR, message));
+                            m_diagnostics.report(XhtmlDiagnosticCode::InnerTextParentMissing, m_characters);
                         }
-                        characters.clear();
+                        m_characters.clear();
                     }
 
-                    workDataLen = 0;
-                    workStartPosition = m_bufferPos;
+                    m_workDataLen = 0;
+                    m_workStartPosition = m_bufferPos;
 
                     // update element hierarchy
                     if (comment.size())
@@ -204,12 +420,11 @@ namespace tgui  { namespace xhtml
                     }
                     else if (newElement == nullptr)
                     {
-                        tgui::String message(U"XhtmlParser::parseDocument() -> An XHTML element should be created, but isn't!");
-                        m_messages.push_back(std::make_tuple(MessageType::ERROR, message));
+                        m_diagnostics.report(XhtmlDiagnosticCode::ElementNotCreated);
                     }
                     else
                     {
-                        auto parentElement = parentElements.back();
+                        auto parentElement = m_parentElements.back();
                         if (isOpeningTag) // includs: isOpeningTag && isClosingTag
                         {
                             // [1 - see above] catch up the postponed registration to the parent/root element collection here
@@ -222,21 +437,27 @@ namespace tgui  { namespace xhtml
                             }
 
                             if (!isClosingTag)
-                                parentElements.push_back(newElement);
+                                m_parentElements.push_back(newElement);
+                            else if (m_onElementCompleted)
+                                m_onElementCompleted(newElement);
                         }
                         else if (isClosingTag)
                         {
                             if (parseDocument_checkStartEndTagParity(parentElement, newElement))
-                                parentElements.pop_back();
+                            {
+                                m_parentElements.pop_back();
+                                if (m_onElementCompleted)
+                                    m_onElementCompleted(parentElement);
+                            }
                         }
 
                         // special preformatted mode handling
                         if (isOpeningTag && tgui::viewEqualIgnoreCase(newElement->getTypeName(), "pre"))
-                            preformattedDepth++;
+                            m_preformattedDepth++;
                         if (isClosingTag && tgui::viewEqualIgnoreCase(newElement->getTypeName(), "pre"))
-                            preformattedDepth--;
-                        if (preformattedDepth < 0)
-                            preformattedDepth = 0;
+                            m_preformattedDepth--;
+                        if (m_preformattedDepth < 0)
+                            m_preformattedDepth = 0;
                     }
 
                     break;
@@ -247,22 +468,35 @@ namespace tgui  { namespace xhtml
                 {
                     workCharacter = rejectChar();
 
+                    // wait for the complete look-ahead of the entity resolver, if the entity might be split across chunks
+                    if (!isFinal && resolveEntities && m_bufferPos + XhtmlEntityResolver::MaxEntityLength > getBufferSize())
+                    {
+                        isSuspended = true;
+                        break;
+                    }
+
                     unsigned int charOffset = 0;
+                    char32_t     secondCharacter = 0;
                     if (resolveEntities)
-                        charOffset = XhtmlEntityResolver::resolveEntity(m_messages, &m_buffer[m_bufferPos], workCharacter);
+                    {
+                        locateDiagnostics(m_bufferPos);
+                        charOffset = resolveEntityAtCursor(workCharacter, secondCharacter);
+                    }
 
                     if (charOffset)
                     {
-                        characters.append(m_buffer.substr(workStartPosition, workDataLen));
-                        characters.append(workCharacter);
+                        appendBufferRange(m_characters, m_workStartPosition, m_workDataLen);
+                        m_characters.append(workCharacter);
+                        if (secondCharacter != 0)
+                            m_characters.append(secondCharacter);
                         m_bufferPos += charOffset;
-                        workStartPosition = m_bufferPos;
-                        workDataLen = 0L;
+                        m_workStartPosition = m_bufferPos;
+                        m_workDataLen = 0L;
                     }
                     else
                     {
                         workCharacter = acquireChar();
-                        workDataLen++;
+                        m_workDataLen++;
                     }
 
                     break;
@@ -271,18 +505,38 @@ namespace tgui  { namespace xhtml
                 // handle not specific characters like tag content
                 default:
                 {
-                    workDataLen++;
+                    // jump to the next character, that requires evaluation ('<', '&' or the end of the buffer)
+                    const size_t nextPosition = findNextDelimiter(m_bufferPos);
+                    m_workDataLen += 1 + (nextPosition - m_bufferPos);
+                    m_bufferPos = nextPosition;
                     break;
                 }
             }
         };
 
+        // the end of the currently available buffer has been reached (acquireChar() returned 0) - step back to continue there
+        if (!isSuspended && !isFinal && workCharacter == 0)
+            rejectChar();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    size_t XhtmlParser::parseDocument_finish(bool traceResult)
+    {
         // do a simple quality check
-        if (workDataLen || characters.size())
+        if (m_workDataLen || m_characters.size())
+        {
+            locateDiagnostics(m_bufferPos);
+            m_diagnostics.report(XhtmlDiagnosticCode::RemainingCharacters, m_characters);
+        }
+
+        // the end of the document completes all elements, that are still open
+        while (m_parentElements.size() > 1)
         {
-            tgui::String message(U"XhtmlParser::parseDocument() -> There are remaining characters '");
-            message.append(characters).append(U"' after the end of document parsing!");
-            m_messages.push_back(std::make_tuple(MessageType::ERROR, message));
+            auto parentElement = m_parentElements.back();
+            m_parentElements.pop_back();
+            if (m_onElementCompleted)
+                m_onElementCompleted(parentElement);
         }
 
         size_t htmlRootElements = 0;
@@ -292,8 +546,8 @@ namespace tgui  { namespace xhtml
 
         if (htmlRootElements > 1)
         {
-            tgui::String message(U"XhtmlParser::parseDocument() -> There is more than 1 'html' root element, but shouldn't!");
-            m_messages.push_back(std::make_tuple(MessageType::ERROR, message));
+            locateDiagnostics(m_bufferPos);
+            m_diagnostics.report(XhtmlDiagnosticCode::MultipleHtmlRoots);
         }
 
         if (traceResult)
@@ -303,66 +557,98 @@ namespace tgui  { namespace xhtml
                 htmlElement->trace(L"");
         }
 
-        return m_bufferPos;
+        return m_feedOffset + m_bufferPos;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void XhtmlParser::parseDocument_cleanBreaksAndSpaces(const XhtmlElement::Ptr parentElement, tgui::String& characters)
+    void XhtmlParser::parseDocument_cleanBreaksAndSpaces(const XhtmlElement::Ptr parentElement, tgui::String& characters, int preformattedDepth)
     {
-        characters.replace(U"\r\n", U"\n");
-        characters.replace(U'\n', U' ');
-        characters.replace(U'\t', U' ');
-        characters.replace(U'\v', U' ');
-        while(characters.contains(U"  "))
-            characters.replace(U"  ", U" ");
-        characters.replace(U'\xA0', U'\x20');
+        // the characters are compacted in place, the write position never overtakes the read position
+        const size_t size = characters.size();
+        char32_t*    data = &characters[0];
+        size_t       readPosition = 0;
+        size_t       writePosition = 0;
 
-        if (parentElement != nullptr && characters.size() > 0 && characters[0] == U' ')
+        if (preformattedDepth > 0)
+        {
+            // keep all spaces and line breaks, but reduce "\r\n" to "\n"
+            for (; readPosition < size; readPosition++)
+                if (data[readPosition] != U'\r' || readPosition + 1 >= size || data[readPosition + 1] != U'\n')
+                    data[writePosition++] = data[readPosition];
+            characters.resize(writePosition);
+            return;
+        }
+
+        // a leading space is suppressed at the beginning of a block
+        bool suppressLeadingSpace = false;
+        if (parentElement != nullptr)
         {
             auto previousElement = (parentElement->getChildren() != nullptr && parentElement->getChildren()->size() > 0 ? parentElement->getChildren()->back() : nullptr);
+            suppressLeadingSpace = (previousElement == nullptr || previousElement->isStructuringBlock() || previousElement->isTextBlock());
+        }
+
+        while (readPosition < size)
+        {
+            // move the run of characters, that need no normalization, en bloc
+            const size_t runEnd = findNextSpaceCandidate(data, readPosition, size);
+            if (runEnd > readPosition)
+            {
+                if (writePosition != readPosition)
+                    std::memmove(data + writePosition, data + readPosition, (runEnd - readPosition) * sizeof(char32_t));
+                writePosition += runEnd - readPosition;
+                readPosition = runEnd;
+                continue;
+            }
 
-            if (previousElement == nullptr ||
-                (previousElement != nullptr && (previousElement->isStructuringBlock() || previousElement->isTextBlock()) ))
+            const char32_t c = data[readPosition];
+            const size_t spacesEnd = skipCollapsibleSpaces(data, readPosition, size);
+            if (spacesEnd > readPosition || c == U'\xA0')
             {
-                characters.erase(0, 1);
+                // a run of spaces, tabs, vertical tabs and line breaks becomes one space, a no-break space becomes a space (but
+                // is not collapsed with its neighbours)
+                readPosition = (spacesEnd > readPosition ? spacesEnd : readPosition + 1);
+                if (writePosition == 0 && suppressLeadingSpace)
+                    suppressLeadingSpace = false;
+                else
+                    data[writePosition++] = U' ';
+            }
+            else
+            {
+                // any other control character (including a single '\r') is kept
+                data[writePosition++] = c;
+                readPosition++;
             }
         }
+        characters.resize(writePosition);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void XhtmlParser::parseDocument_createInnerText(XhtmlElement::Ptr parentElement, tgui::String& characters, int preformattedDepth)
+    void XhtmlParser::parseDocument_createInnerText(XhtmlElement::Ptr parentElement, const tgui::String& characters)
     {
-        tgui::String match = U"";
-        if (characters.find(U"\n", 0) != SIZE_MAX)
-            match = U"\n";
-
-        if (match.length() > 0)
+        // cleaned characters contain line breaks only inside of '<pre>' tags - every line break becomes a break element
+        size_t lineStart = 0;
+        size_t lineEnd = characters.find(U'\n');
+        if (lineEnd == tgui::String::npos)
         {
-            auto charactersParts = characters.split(match);
-            for (size_t index = 0; index < charactersParts.size(); index++)
-            {
-                auto charactersPart = charactersParts[index];
+            XhtmlElement::createInnerText(parentElement, characters);
+            return;
+        }
 
-                if (preformattedDepth == 0)
-                {
-                    if (index == 0)
-                        charactersPart = StringEx::trimRight(charactersPart);
-                    else if (index == charactersParts.size() - 1)
-                        charactersPart = StringEx::trimLeft(charactersPart);
-                    else
-                        charactersPart = charactersPart.trim();
-                }
+        while (true)
+        {
+            if (lineEnd > lineStart)
+                XhtmlElement::createInnerText(parentElement, characters.substr(lineStart, lineEnd - lineStart));
+            if (lineEnd >= characters.size())
+                break;
 
-                if (charactersPart.size() > 0)
-                    XhtmlElement::createInnerText(parentElement, charactersPart);
-                if (index < charactersParts.size() - 1)
-                    XhtmlElement::createBreak(parentElement);
-            }
+            XhtmlElement::createBreak(parentElement);
+            lineStart = lineEnd + 1;
+            lineEnd = characters.find(U'\n', lineStart);
+            if (lineEnd == tgui::String::npos)
+                lineEnd = characters.size();
         }
-        else
-            XhtmlElement::createInnerText(parentElement, characters);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -375,10 +661,7 @@ namespace tgui  { namespace xhtml
             auto stopTagName = endTagElement->getTypeName();
             if (!tgui::viewEqualIgnoreCase(startTagName, stopTagName))
             {
-                tgui::String message(U"XhtmlParser::parseDocument_checkStartEndTagParity() -> Can't close tag of type '");
-                message.append(startTagElement->getTypeNameU32()).append(U"' with tag of type '");
-                message.append(endTagElement->getTypeNameU32()).append(U"'!");
-                m_messages.push_back(std::make_tuple(MessageType::WARNING, message));
+                m_diagnostics.report(XhtmlDiagnosticCode::EndTagMismatch, startTagName, stopTagName);
             }
 
             // whether start tag and end tag match or not - there is a parity
@@ -386,10 +669,7 @@ namespace tgui  { namespace xhtml
         }
         else
         {
-            tgui::String message(U"XhtmlParser::parseDocument_checkStartEndTagParity() -> Can't find matching open tag of type '");
-            message.append(endTagElement->getTypeNameU32()).append(U"' for current tag of type '");
-            message.append(endTagElement->getTypeNameU32()).append(U"'!");
-            m_messages.push_back(std::make_tuple(MessageType::WARNING, message));
+            m_diagnostics.report(XhtmlDiagnosticCode::EndTagUnmatched, endTagElement->getTypeName());
 
             // there is no parity
             return false;
@@ -400,23 +680,24 @@ namespace tgui  { namespace xhtml
 
     XhtmlElement::Ptr XhtmlParser::parseElement(XhtmlElement::Ptr parent, bool& isOpeningTag, bool& isClosingTag, bool& isInsideScript)
     {
-        if (m_buffer.size() == 0)
+        if (getBufferSize() == 0)
         {
-            tgui::String message(U"XhtmlParser::parseElement() -> Invalid buffer!");
-            m_messages.push_back(std::make_tuple(MessageType::ERROR, message));
+            m_diagnostics.report(XhtmlDiagnosticCode::ElementBufferInvalid);
             return nullptr;
         }
-        if (m_bufferPos + 4 >= m_buffer.size())
+        if (m_bufferPos + 4 >= getBufferSize())
         {
-            tgui::String message(U"XhtmlParser::parseElement() -> Index overrun!");
-            m_messages.push_back(std::make_tuple(MessageType::ERROR, message));
+            m_diagnostics.report(XhtmlDiagnosticCode::ElementIndexOverrun);
             return nullptr;
         }
 
+        if (m_isUtf8Buffer)
+            return parseElementUtf8(parent, isOpeningTag, isClosingTag, isInsideScript);
+
         // we can't assume that the next '<' following a '<script ...>' is a tag start - it
         // can also be a part of the code, e.g. a compare operator or a tag within the code
         size_t processedLength;
-        auto element = XhtmlElement::createElementFromParseStr(m_messages, parent, m_buffer, m_bufferPos, isOpeningTag, isClosingTag, isInsideScript, processedLength);
+        auto element = XhtmlElement::createElementFromParseStr(m_diagnostics, parent, m_buffer, m_bufferPos, isOpeningTag, isClosingTag, isInsideScript, processedLength);
         if (!processedLength)
             return nullptr;
 
@@ -424,14 +705,330 @@ namespace tgui  { namespace xhtml
         return element;
     }
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    XhtmlElement::Ptr XhtmlParser::parseElementUtf8(XhtmlElement::Ptr parent, bool& isOpeningTag, bool& isClosingTag, bool& isInsideScript)
+    {
+        // determine the tag's ending delimiter '>' - take the remaining buffer, if the tag isn't closed
+        const size_t tagEndPosition = findTagEnd(m_bufferPos);
+        if (m_markupScan.IsTooLong)
+        {
+            m_diagnostics.report(XhtmlDiagnosticCode::ElementTooLong);
+            return nullptr;
+        }
+        const char*  tagBegin       = m_utf8Buffer.data() + m_bufferPos;
+        const char*  tagEnd         = m_utf8Buffer.data() + (tagEndPosition != tgui::String::npos ? tagEndPosition : m_utf8Buffer.size());
+
+        // decode the tag markup only (all markup delimiters are ASCII, so the tag boundaries are code point boundaries) - the
+        // not yet decoded attribute values move to a slice of their own, so the buffer is reused unless somebody still holds it
+        if (m_tagBuffer == nullptr || m_tagBuffer.use_count() > 1)
+            m_tagBuffer = std::make_shared<tgui::String>();
+        else
+            m_tagBuffer->clear();
+        UtfHelper::appendUtf8(*m_tagBuffer, tagBegin, tagEnd);
+
+        size_t processedLength;
+        auto element = XhtmlElement::createElementFromParseStr(m_diagnostics, parent, m_tagBuffer, 0, isOpeningTag, isClosingTag, isInsideScript, processedLength);
+        if (!processedLength)
+            return nullptr;
+
+        // map the processed code points back to processed bytes
+        const size_t processedBytes = UtfHelper::offsetOfUtf8CodePoint(tagBegin, tagEnd, processedLength);
+        if (element != nullptr)
+            element->setStartTagPositions(m_feedOffset + m_bufferPos, m_feedOffset + m_bufferPos + processedBytes);
+
+        m_bufferPos += processedBytes;
+        return element;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void XhtmlParser::appendBufferRange(tgui::String& target, size_t position, size_t length) const
+    {
+        if (m_isUtf8Buffer)
+        {
+            if (position >= m_utf8Buffer.size())
+                return;
+            length = std::min(length, m_utf8Buffer.size() - position);
+            UtfHelper::appendUtf8(target, m_utf8Buffer.data() + position, m_utf8Buffer.data() + position + length);
+        }
+        else
+            target.append(m_buffer->substr(position, length));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    size_t XhtmlParser::findInBuffer(const char* pattern, size_t startPosition) const
+    {
+        const size_t patternLength = strlen(pattern);
+        const size_t bufferSize = getBufferSize();
+        for (size_t position = startPosition; position + patternLength <= bufferSize; position++)
+        {
+            size_t index = 0;
+            while (index < patternLength && peekChar(position + index) == static_cast<char32_t>(pattern[index]))
+                index++;
+            if (index == patternLength)
+                return position;
+        }
+        return tgui::String::npos;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    size_t XhtmlParser::findTagEnd(size_t position)
+    {
+        // continue the search of the previous call, if the tag is still pending (incremental mode)
+        if (m_markupScan.Start != position)
+        {
+            m_markupScan          = MarkupScan();
+            m_markupScan.Start    = position;
+            m_markupScan.Position = position + 1;
+        }
+        if (m_markupScan.End != tgui::String::npos || m_markupScan.IsTooLong)
+            return m_markupScan.End;
+
+        // determine the tag's ending delimiter '>' - it doesn't count inside quoted attribute values
+        const size_t searchEnd = std::min(getBufferSize(), position + MaxTagLength);
+        for (; m_markupScan.Position < searchEnd; m_markupScan.Position++)
+        {
+            const char32_t c = peekChar(m_markupScan.Position);
+            if (m_markupScan.Quote != 0)
+            {
+                if (c == m_markupScan.Quote)
+                    m_markupScan.Quote = 0;
+                continue;
+            }
+            if (c == '>')
+            {
+                m_markupScan.End = m_markupScan.Position + 1;
+                return m_markupScan.End;
+            }
+
+            if (c == '=')
+                m_markupScan.AfterEqualSign = true;
+            else if (m_markupScan.AfterEqualSign && (c == '\'' || c == '\"'))
+            {
+                m_markupScan.Quote = c;
+                m_markupScan.AfterEqualSign = false;
+            }
+            else if (c != ' ' && c != '\t' && c != '\r' && c != '\n')
+                m_markupScan.AfterEqualSign = false;
+        }
+        m_markupScan.IsTooLong = (m_markupScan.Position >= position + MaxTagLength);
+        return tgui::String::npos;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    size_t XhtmlParser::findNextDelimiter(size_t position) const
+    {
+        if (m_isUtf8Buffer)
+            return findNextDelimiter(m_utf8Buffer.data(), position, m_utf8Buffer.size());
+        return findNextDelimiter(m_buffer->data(), position, m_buffer->size());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    size_t XhtmlParser::findNextDelimiter(const char* data, size_t position, size_t size)
+    {
+#if defined(TGUI_XHTML_PARSER_AVX2)
+        const __m256i lessThan256  = _mm256_set1_epi8('<');
+        const __m256i ampersand256 = _mm256_set1_epi8('&');
+        const __m256i zero256      = _mm256_setzero_si256();
+        for (; position + 32 <= size; position += 32)
+        {
+            const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + position));
+            const __m256i hits  = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(block, lessThan256), _mm256_cmpeq_epi8(block, ampersand256)),
+                                                  _mm256_cmpeq_epi8(block, zero256));
+            const unsigned int mask = static_cast<unsigned int>(_mm256_movemask_epi8(hits));
+            if (mask != 0)
+                return position + countTrailingZeros(mask);
+        }
+#endif
+#if defined(TGUI_XHTML_PARSER_SSE2)
+        const __m128i lessThan  = _mm_set1_epi8('<');
+        const __m128i ampersand = _mm_set1_epi8('&');
+        const __m128i zero      = _mm_setzero_si128();
+        for (; position + 16 <= size; position += 16)
+        {
+            const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + position));
+            const __m128i hits  = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(block, lessThan), _mm_cmpeq_epi8(block, ampersand)),
+                                               _mm_cmpeq_epi8(block, zero));
+            const unsigned int mask = static_cast<unsigned int>(_mm_movemask_epi8(hits));
+            if (mask != 0)
+                return position + countTrailingZeros(mask);
+        }
+#endif
+        for (; position < size; position++)
+        {
+            const char c = data[position];
+            if (c == '<' || c == '&' || c == 0)
+                return position;
+        }
+        return size;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    size_t XhtmlParser::findNextDelimiter(const char32_t* data, size_t position, size_t size)
+    {
+#if defined(TGUI_XHTML_PARSER_AVX2)
+        const __m256i lessThan256  = _mm256_set1_epi32('<');
+        const __m256i ampersand256 = _mm256_set1_epi32('&');
+        const __m256i zero256      = _mm256_setzero_si256();
+        for (; position + 8 <= size; position += 8)
+        {
+            const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + position));
+            const __m256i hits  = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi32(block, lessThan256), _mm256_cmpeq_epi32(block, ampersand256)),
+                                                  _mm256_cmpeq_epi32(block, zero256));
+            const unsigned int mask = static_cast<unsigned int>(_mm256_movemask_epi8(hits));
+            if (mask != 0)
+                return position + countTrailingZeros(mask) / 4;
+        }
+#endif
+#if defined(TGUI_XHTML_PARSER_SSE2)
+        const __m128i lessThan  = _mm_set1_epi32('<');
+        const __m128i ampersand = _mm_set1_epi32('&');
+        const __m128i zero      = _mm_setzero_si128();
+        for (; position + 4 <= size; position += 4)
+        {
+            const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + position));
+            const __m128i hits  = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi32(block, lessThan), _mm_cmpeq_epi32(block, ampersand)),
+                                               _mm_cmpeq_epi32(block, zero));
+            const unsigned int mask = static_cast<unsigned int>(_mm_movemask_epi8(hits));
+            if (mask != 0)
+                return position + countTrailingZeros(mask) / 4;
+        }
+#endif
+        for (; position < size; position++)
+        {
+            const char32_t c = data[position];
+            if (c == U'<' || c == U'&' || c == 0)
+                return position;
+        }
+        return size;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    size_t XhtmlParser::findNextSpaceCandidate(const char32_t* data, size_t position, size_t size)
+    {
+#if defined(TGUI_XHTML_PARSER_SSE2)
+        // the UTF-32 characters are positive as signed 32 bit integers, so the signed comparison is sufficient
+        const __m128i limit         = _mm_set1_epi32(0x21);
+        const __m128i noBreakSpace  = _mm_set1_epi32(0xA0);
+        for (; position + 4 <= size; position += 4)
+        {
+            const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + position));
+            const __m128i hits  = _mm_or_si128(_mm_cmplt_epi32(block, limit), _mm_cmpeq_epi32(block, noBreakSpace));
+            const unsigned int mask = static_cast<unsigned int>(_mm_movemask_epi8(hits));
+            if (mask != 0)
+                return position + countTrailingZeros(mask) / 4;
+        }
+#endif
+        for (; position < size; position++)
+        {
+            const char32_t c = data[position];
+            if (c <= U' ' || c == U'\xA0')
+                return position;
+        }
+        return size;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    size_t XhtmlParser::skipCollapsibleSpaces(const char32_t* data, size_t position, size_t size)
+    {
+#if defined(TGUI_XHTML_PARSER_SSE2)
+        const __m128i space       = _mm_set1_epi32(' ');
+        const __m128i tab         = _mm_set1_epi32('\t');
+        const __m128i lineFeed    = _mm_set1_epi32('\n');
+        const __m128i verticalTab = _mm_set1_epi32('\v');
+        for (; position + 4 <= size; position += 4)
+        {
+            const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + position));
+            const __m128i hits  = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi32(block, space), _mm_cmpeq_epi32(block, tab)),
+                                               _mm_or_si128(_mm_cmpeq_epi32(block, lineFeed), _mm_cmpeq_epi32(block, verticalTab)));
+            if (_mm_movemask_epi8(hits) != 0xFFFF)
+                break;
+        }
+#endif
+        while (position < size)
+        {
+            const char32_t c = data[position];
+            if (c == U' ' || c == U'\t' || c == U'\n' || c == U'\v')
+                position++;
+            else if (c == U'\r' && position + 1 < size && data[position + 1] == U'\n')
+                position += 2;
+            else
+                break;
+        }
+        return position;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int XhtmlParser::countTrailingZeros(unsigned int mask)
+    {
+#if defined(_MSC_VER)
+        unsigned long index;
+        _BitScanForward(&index, mask);
+        return static_cast<unsigned int>(index);
+#elif defined(__GNUC__) || defined(__clang__)
+        return static_cast<unsigned int>(__builtin_ctz(mask));
+#else
+        unsigned int index = 0;
+        while ((mask & 1) == 0)
+        {
+            mask >>= 1;
+            index++;
+        }
+        return index;
+#endif
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void XhtmlParser::locateDiagnosticsAt(size_t position)
+    {
+        const size_t offset = m_feedOffset + position;
+        if (offset > m_lineScanOffset)
+        {
+            const size_t scanStart = (m_lineScanOffset > m_feedOffset ? m_lineScanOffset - m_feedOffset : 0);
+            for (size_t scanPosition = scanStart; scanPosition < position; scanPosition++)
+            {
+                if (peekChar(scanPosition) == '\n')
+                {
+                    m_lineNumber++;
+                    m_lineStartOffset = m_feedOffset + scanPosition + 1;
+                }
+            }
+            m_lineScanOffset = offset;
+        }
+
+        // a position before the scanned range (after a rejected character) stays on the current line
+        const size_t column = (offset >= m_lineStartOffset ? offset - m_lineStartOffset + 1 : 1);
+        m_diagnostics.setLocation(offset, m_lineNumber, column);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int XhtmlParser::resolveEntityAtCursor(char32_t& substitute, char32_t& secondSubstitute)
+    {
+        const size_t length = getBufferSize() - m_bufferPos;
+        if (m_isUtf8Buffer)
+            return XhtmlEntityResolver::resolveEntity(m_diagnostics, m_utf8Buffer.data() + m_bufferPos, length, substitute, secondSubstitute);
+        return XhtmlEntityResolver::resolveEntity(m_diagnostics, m_buffer->data() + m_bufferPos, length, substitute, secondSubstitute);
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     std::shared_ptr<std::vector<String>> XhtmlParser::getErrorMessages() const
     {
         auto errors = std::make_shared<std::vector<String>>();
-        for (XhtmlParser::MsgType m : m_messages)
-            if (std::get<0>(m) == MessageType::ERROR)
-                errors->push_back(std::get<1>(m));
+        for (auto& diagnostic : m_diagnostics.getDiagnostics())
+            if (XhtmlDiagnostics::getMessageType(diagnostic.Code) == MessageType::ERROR)
+                errors->push_back(XhtmlDiagnostics::format(diagnostic));
         return errors;
     }
 
@@ -440,9 +1037,9 @@ namespace tgui  { namespace xhtml
     std::shared_ptr<std::vector<String>> XhtmlParser::getWarningMessages() const
     {
         auto warnings = std::make_shared<std::vector<String>>();
-        for (XhtmlParser::MsgType m : m_messages)
-            if (std::get<0>(m) == MessageType::WARNING)
-                warnings->push_back(std::get<1>(m));
+        for (auto& diagnostic : m_diagnostics.getDiagnostics())
+            if (XhtmlDiagnostics::getMessageType(diagnostic.Code) == MessageType::WARNING)
+                warnings->push_back(XhtmlDiagnostics::format(diagnostic));
         return warnings;
     }
 
@@ -0,0 +1,501 @@
+#include <algorithm>
+#include <mutex>
+
+#include <TGUI/Config.hpp>
+#include <TGUI/TGUI.hpp>
+
+// MSC needs a clear distiction between "__declspec(dllimport)" (above) and "__declspec(dllexport)" (below) this comment.
+// So in the case of direct source file integration (in contrast to library creation and linking), the API must be 'dllexport'.
+#ifndef TGUI_STATIC
+#ifdef TGUI_SYSTEM_WINDOWS
+#undef TGUI_API
+#define TGUI_API __declspec(dllexport)
+#endif
+#endif
+
+#include "TGUI/Xhtml/StringHelper.hpp"
+#include "TGUI/Xhtml/Dom/XhtmlElements.hpp"
+
+namespace tgui  { namespace xhtml
+{
+    namespace
+    {
+        /// @brief The highest count of IDs, classes or types, the specificity can represent
+        constexpr std::uint32_t MaxSpecificityCount = 0xFF;
+
+        std::mutex                            classIdsMutex;    //!< The guard of the class ID table
+        std::map<tgui::String, XhtmlClassId>  internedClassIds; //!< The class IDs by class name
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Gets the class ID of a class name and registers the class name if necessary - classIdsMutex must be locked
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        XhtmlClassId internLocked(const tgui::String& className)
+        {
+            auto it = internedClassIds.find(className);
+            if (it != internedClassIds.end())
+                return it->second;
+
+            const XhtmlClassId classId = static_cast<XhtmlClassId>(internedClassIds.size() + 1);
+            internedClassIds.emplace(className, classId);
+            return classId;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Combines the tag key and the (first) class ID of a selector or an element to the key of the rule index
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        inline std::uint64_t makeRuleIndexKey(unsigned int tagKey, XhtmlClassId classId)
+        {
+            return (static_cast<std::uint64_t>(tagKey) << 32) | classId;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Determines whether the character separates class names within a 'class' attribute
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        inline bool isClassSeparator(char32_t character)
+        {
+            return character == U' ' || character == U'\t' || character == U'\n' || character == U'\r' || character == U'\f';
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Determines whether the character can be part of a CSS identifier (escapes are not supported)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        inline bool isIdentifierCharacter(char32_t character)
+        {
+            return (character >= U'a' && character <= U'z') || (character >= U'A' && character <= U'Z') ||
+                   (character >= U'0' && character <= U'9') || character == U'-' || character == U'_' || character >= 0x80;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Reads a CSS identifier and moves the position behind it
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        tgui::String readIdentifier(const tgui::String& text, size_t& position)
+        {
+            const size_t beginPosition = position;
+            while (position < text.length() && isIdentifierCharacter(text[position]))
+                position++;
+            return text.substr(beginPosition, position - beginPosition);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds one to a specificity component (IDs, classes or types), saturating at MaxSpecificityCount
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        inline void incrementSpecificity(std::uint32_t& specificity, unsigned int shift)
+        {
+            if (((specificity >> shift) & MaxSpecificityCount) < MaxSpecificityCount)
+                specificity += (1u << shift);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Skips a comment "/* ... */" if the position is at its start, and moves the position behind it
+        ///
+        /// @return The flag whether a comment has been skipped, 'isClosed' tells whether it has been closed before the end
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool skipComment(const char32_t* text, size_t length, size_t& position, bool& isClosed)
+        {
+            if (position + 1 >= length || text[position] != U'/' || text[position + 1] != U'*')
+                return false;
+
+            for (position += 2; position + 1 < length; position++)
+            {
+                if (text[position] == U'*' && text[position + 1] == U'/')
+                {
+                    position += 2;
+                    isClosed = true;
+                    return true;
+                }
+            }
+            position = length;
+            isClosed = false;
+            return true;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Copies a quoted string (including the quotes and escaped characters) and moves the position behind it
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void copyString(const char32_t* text, size_t length, size_t& position, tgui::String& target)
+        {
+            const char32_t quote = text[position];
+            target += text[position++];
+            while (position < length && text[position] != quote)
+            {
+                if (text[position] == U'\\' && position + 1 < length)
+                    target += text[position++];
+                target += text[position++];
+            }
+            if (position < length)
+                target += text[position++];
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Gets the at-keyword (e.g. "@media") of an at-rule prelude
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        tgui::String getAtKeyword(const tgui::String& prelude)
+        {
+            size_t position = 1;
+            readIdentifier(prelude, position);
+            return prelude.substr(0, position);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    XhtmlClassId XhtmlClassNames::intern(const tgui::String& className)
+    {
+        std::lock_guard<std::mutex> lock(classIdsMutex);
+        return internLocked(className);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void XhtmlClassNames::tokenize(const tgui::String& classNames, std::vector<XhtmlClassId>& classIds)
+    {
+        classIds.clear();
+
+        // intern all class names of the attribute under one lock
+        std::lock_guard<std::mutex> lock(classIdsMutex);
+        for (size_t position = 0; position < classNames.length(); )
+        {
+            while (position < classNames.length() && isClassSeparator(classNames[position]))
+                position++;
+
+            const size_t beginPosition = position;
+            while (position < classNames.length() && !isClassSeparator(classNames[position]))
+                position++;
+
+            if (position > beginPosition)
+                classIds.push_back(internLocked(classNames.substr(beginPosition, position - beginPosition)));
+        }
+        std::sort(classIds.begin(), classIds.end());
+        classIds.erase(std::unique(classIds.begin(), classIds.end()), classIds.end());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool XhtmlStyleSelector::tryParse(const tgui::String& selectorText, XhtmlStyleSelector& selector)
+    {
+        selector = XhtmlStyleSelector();
+        selector.TagKey = AnyTagKey;
+        selector.Specificity = 0;
+        if (selectorText.empty())
+            return false;
+
+        size_t position = 0;
+        if (selectorText[0] == U'*')
+            position++;
+        else if (selectorText[0] != U'.' && selectorText[0] != U'#')
+        {
+            selector.TypeName = readIdentifier(selectorText, position).toLower();
+            if (selector.TypeName.empty())
+                return false;
+
+            const XhtmlElementType::TagId tagId = XhtmlElementType::getTagId(selector.TypeName.data(), selector.TypeName.length());
+            // unknown elements share the fall back type, so a type selector for an unknown type name must never match
+            selector.TagKey = (tagId != XhtmlElementType::EmptyTagId ? tagId : UnknownTagKey);
+            incrementSpecificity(selector.Specificity, 0);
+        }
+
+        while (position < selectorText.length())
+        {
+            const char32_t delimiter = selectorText[position++];
+            if (delimiter != U'.' && delimiter != U'#')
+                return false;
+
+            tgui::String name = readIdentifier(selectorText, position);
+            if (name.empty())
+                return false;
+
+            if (delimiter == U'#')
+            {
+                // an element has one ID only, so two different IDs never match - don't support that
+                if (!selector.Id.empty() && selector.Id != name)
+                    return false;
+                selector.Id = name;
+                incrementSpecificity(selector.Specificity, 16);
+            }
+            else
+            {
+                selector.ClassIds.push_back(XhtmlClassNames::intern(name));
+                selector.ClassNames.push_back(std::move(name));
+                incrementSpecificity(selector.Specificity, 8);
+            }
+        }
+        std::sort(selector.ClassIds.begin(), selector.ClassIds.end());
+        selector.ClassIds.erase(std::unique(selector.ClassIds.begin(), selector.ClassIds.end()), selector.ClassIds.end());
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool XhtmlStyleSelector::matches(unsigned int tagId, const tgui::String& id, const std::vector<XhtmlClassId>& classIds) const
+    {
+        if (TagKey != AnyTagKey && TagKey != tagId)
+            return false;
+        if (!Id.empty() && Id != id)
+            return false;
+        // both class ID lists are sorted
+        return std::includes(classIds.begin(), classIds.end(), ClassIds.begin(), ClassIds.end());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    size_t XhtmlStyleSheet::compile(XhtmlDiagnostics& diagnostics, const tgui::String& source)
+    {
+        const size_t    initialRuleCount = m_rules.size();
+        const char32_t* text = source.data();
+        const size_t    length = source.length();
+        size_t          position = 0;
+        bool            isClosed = true;
+        tgui::String    prelude;
+        tgui::String    declarations;
+
+        while (position < length)
+        {
+            // 1. the prelude (selector list or at-rule) up to the block start '{' or a statement end ';'
+            prelude.clear();
+            while (position < length && text[position] != U'{' && text[position] != U';' && text[position] != U'}')
+            {
+                if (skipComment(text, length, position, isClosed))
+                    prelude += U' ';
+                else if (text[position] == U'\"' || text[position] == U'\'')
+                    copyString(text, length, position, prelude);
+                // the HTML comment delimiters "<!--" and "-->" are allowed around a style sheet and are ignored
+                else if (source.compare(position, 4, U"<!--") == 0)
+                    position += 4;
+                else if (source.compare(position, 3, U"-->") == 0)
+                    position += 3;
+                else
+                    prelude += text[position++];
+            }
+            if (!isClosed)
+                diagnostics.report(XhtmlDiagnosticCode::StyleSheetBlockNotClosed);
+            prelude = prelude.trim();
+
+            if (position >= length || text[position] != U'{')
+            {
+                if (prelude.length() > 0 && prelude[0] == U'@')
+                    diagnostics.report(XhtmlDiagnosticCode::StyleSheetAtRuleIgnored, getAtKeyword(prelude));
+                else if (prelude.length() > 0)
+                    diagnostics.report(XhtmlDiagnosticCode::StyleSheetRuleIncomplete, prelude);
+                position++;
+                continue;
+            }
+
+            // 2. the block up to the matching '}' - nested blocks only occur within at-rules
+            declarations.clear();
+            size_t depth = 1;
+            for (position++; position < length && depth > 0; )
+            {
+                if (skipComment(text, length, position, isClosed))
+                    declarations += U' ';
+                else if (text[position] == U'\"' || text[position] == U'\'')
+                    copyString(text, length, position, declarations);
+                else
+                {
+                    depth += (text[position] == U'{' ? 1 : 0);
+                    depth -= (text[position] == U'}' ? 1 : 0);
+                    if (depth > 0)
+                        declarations += text[position];
+                    position++;
+                }
+            }
+            if (depth > 0 || !isClosed)
+                diagnostics.report(XhtmlDiagnosticCode::StyleSheetBlockNotClosed);
+
+            if (prelude.length() > 0 && prelude[0] == U'@')
+            {
+                diagnostics.report(XhtmlDiagnosticCode::StyleSheetAtRuleIgnored, getAtKeyword(prelude));
+                continue;
+            }
+
+            // 3. the selector list - every supported selector becomes a rule of its own, sharing the style entry
+            std::vector<XhtmlStyleRule> rules;
+            for (auto& selectorText : StringEx::split(prelude, U','))
+            {
+                XhtmlStyleRule rule;
+                rule.SelectorText = selectorText.trim();
+                if (XhtmlStyleSelector::tryParse(rule.SelectorText, rule.Selector))
+                    rules.push_back(std::move(rule));
+                else
+                    diagnostics.report(XhtmlDiagnosticCode::StyleSheetSelectorUnsupported, rule.SelectorText);
+            }
+
+            declarations = declarations.trim();
+            if (rules.empty() || declarations.empty())
+                continue;
+
+            auto styleEntry = XhtmlMemoryResource::makeShared<XhtmlStyleEntry>();
+            styleEntry->putValue(diagnostics, declarations);
+            for (auto& rule : rules)
+            {
+                rule.Entry = styleEntry;
+                appendRule(std::move(rule));
+            }
+        }
+
+        return m_rules.size() - initialRuleCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool XhtmlStyleSheet::addRule(const tgui::String& selectorText, XhtmlStyleEntry::Ptr styleEntry)
+    {
+        XhtmlStyleRule rule;
+        rule.SelectorText = selectorText.trim();
+        if (styleEntry == nullptr || !XhtmlStyleSelector::tryParse(rule.SelectorText, rule.Selector))
+            return false;
+
+        rule.Entry = styleEntry;
+        appendRule(std::move(rule));
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void XhtmlStyleSheet::merge(const XhtmlStyleSheet& styleSheet)
+    {
+        if (&styleSheet == this)
+            return;
+
+        m_rules.reserve(m_rules.size() + styleSheet.m_rules.size());
+        for (const auto& rule : styleSheet.m_rules)
+            appendRule(rule);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void XhtmlStyleSheet::clear()
+    {
+        m_rules.clear();
+        m_idIndex.clear();
+        m_ruleIndex.clear();
+        m_nextSourceOrder = 0;
+        m_revision = XhtmlAttribute::nextRevision();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    XhtmlStyleEntry::Ptr XhtmlStyleSheet::findEntry(const tgui::String& selectorText) const
+    {
+        for (auto it = m_rules.rbegin(); it != m_rules.rend(); it++)
+            if (it->SelectorText == selectorText)
+                return it->Entry;
+        return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void XhtmlStyleSheet::match(unsigned int tagId, const tgui::String& id, const std::vector<XhtmlClassId>& classIds,
+                                std::vector<XhtmlStyleEntry::Ptr>& styleEntries) const
+    {
+        styleEntries.clear();
+        if (m_rules.empty())
+            return;
+
+        std::vector<size_t> candidates;
+        auto appendCandidates = [&candidates](const std::vector<size_t>& ruleIndices)
+            {   candidates.insert(candidates.end(), ruleIndices.begin(), ruleIndices.end());   };
+        auto appendIndexed = [this, &appendCandidates](unsigned int tagKey, XhtmlClassId classId)
+            {
+                auto it = m_ruleIndex.find(makeRuleIndexKey(tagKey, classId));
+                if (it != m_ruleIndex.end())
+                    appendCandidates(it->second);
+            };
+
+        if (!id.empty())
+        {
+            auto it = m_idIndex.find(id);
+            if (it != m_idIndex.end())
+                appendCandidates(it->second);
+        }
+        for (XhtmlClassId classId : classIds)
+        {
+            appendIndexed(tagId, classId);
+            appendIndexed(XhtmlStyleSelector::AnyTagKey, classId);
+        }
+        appendIndexed(tagId, XhtmlClassNames::NoClassId);
+        appendIndexed(XhtmlStyleSelector::AnyTagKey, XhtmlClassNames::NoClassId);
+
+        // every rule is registered to one index bucket only, so the candidates are unique - sorting restores the source order
+        std::sort(candidates.begin(), candidates.end());
+        candidates.erase(std::remove_if(candidates.begin(), candidates.end(), [this, tagId, &id, &classIds](size_t ruleIndex)
+            {   return !m_rules[ruleIndex].Selector.matches(tagId, id, classIds);   }), candidates.end());
+        std::stable_sort(candidates.begin(), candidates.end(), [this](size_t left, size_t right)
+            {   return m_rules[left].Selector.Specificity < m_rules[right].Selector.Specificity;   });
+
+        styleEntries.reserve(candidates.size());
+        for (size_t ruleIndex : candidates)
+            styleEntries.push_back(m_rules[ruleIndex].Entry);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::vector<XhtmlStyleEntry::Ptr>& XhtmlStyleSheet::match(const XhtmlElement& element) const
+    {
+        XhtmlAttribute::Ptr idAttribute;
+        XhtmlAttribute::Ptr classAttribute;
+        auto attributes = element.getAttributes();
+        if (attributes != nullptr)
+        {
+            for (const auto& attribute : *attributes)
+            {
+                if (idAttribute == nullptr && attribute->getName().equalIgnoreCase(U"id"))
+                    idAttribute = attribute;
+                else if (classAttribute == nullptr && attribute->getName().equalIgnoreCase(U"class"))
+                    classAttribute = attribute;
+            }
+        }
+
+        const XhtmlAttribute::Revision idRevision = (idAttribute != nullptr ? idAttribute->getRevision() : 0);
+        const XhtmlAttribute::Revision classRevision = (classAttribute != nullptr ? classAttribute->getRevision() : 0);
+
+        XhtmlMatchedStyle& matchedStyle = element.getMatchedStyle();
+        if (matchedStyle.IsValid && matchedStyle.StyleSheetRevision == m_revision &&
+            matchedStyle.IdRevision == idRevision && matchedStyle.ClassRevision == classRevision)
+            return matchedStyle.Entries;
+
+        if (!matchedStyle.IsValid || matchedStyle.ClassRevision != classRevision)
+        {
+            if (classAttribute != nullptr)
+                XhtmlClassNames::tokenize(classAttribute->getValue(), matchedStyle.ClassIds);
+            else
+                matchedStyle.ClassIds.clear();
+        }
+
+        match(element.getTagId(), (idAttribute != nullptr ? idAttribute->getValue() : tgui::String()), matchedStyle.ClassIds,
+              matchedStyle.Entries);
+        matchedStyle.StyleSheetRevision = m_revision;
+        matchedStyle.IdRevision = idRevision;
+        matchedStyle.ClassRevision = classRevision;
+        matchedStyle.IsValid = true;
+        return matchedStyle.Entries;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void XhtmlStyleSheet::appendRule(XhtmlStyleRule rule)
+    {
+        const size_t ruleIndex = m_rules.size();
+        rule.SourceOrder = m_nextSourceOrder++;
+
+        if (!rule.Selector.Id.empty())
+            m_idIndex[rule.Selector.Id].push_back(ruleIndex);
+        else
+        {
+            // any class is as good as any other - all of them must be assigned to a matching element
+            const XhtmlClassId classId = (rule.Selector.ClassIds.empty() ? XhtmlClassNames::NoClassId : rule.Selector.ClassIds.front());
+            m_ruleIndex[makeRuleIndexKey(rule.Selector.TagKey, classId)].push_back(ruleIndex);
+        }
+
+        m_rules.push_back(std::move(rule));
+        m_revision = XhtmlAttribute::nextRevision();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+} }
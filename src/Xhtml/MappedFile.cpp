@@ -0,0 +1,105 @@
+#include <string>
+
+#include <TGUI/Config.hpp>
+#include <TGUI/TGUI.hpp>
+
+#ifdef TGUI_SYSTEM_LINUX
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+// MSC needs a clear distiction between "__declspec(dllimport)" (above) and "__declspec(dllexport)" (below) this comment.
+// So in the case of direct source file integration (in contrast to library creation and linking), the API must be 'dllexport'.
+#ifndef TGUI_STATIC
+#ifdef TGUI_SYSTEM_WINDOWS
+#undef TGUI_API
+#define TGUI_API __declspec(dllexport)
+#endif
+#endif
+
+#include "TGUI/Xhtml/MappedFile.hpp"
+
+namespace tgui  { namespace xhtml
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool MappedFile::open(const std::string& filePath, std::string& errorMessage)
+    {
+        close();
+
+#ifdef TGUI_SYSTEM_LINUX
+        int fileDescriptor = ::open(filePath.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fileDescriptor < 0)
+        {
+            errorMessage = "Unable to open file.";
+            return false;
+        }
+
+        struct stat fileStatus;
+        if (::fstat(fileDescriptor, &fileStatus) != 0 || !S_ISREG(fileStatus.st_mode))
+        {
+            ::close(fileDescriptor);
+            errorMessage = "Unable to determine the file size.";
+            return false;
+        }
+
+        // A zero length mapping is illegal, empty files must be handled by the caller.
+        if (fileStatus.st_size <= 0)
+        {
+            ::close(fileDescriptor);
+            errorMessage = "File too small or empty.";
+            return false;
+        }
+
+        const size_t fileSizeInByte = static_cast<size_t>(fileStatus.st_size);
+        void* mapping = ::mmap(nullptr, fileSizeInByte, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+        // The mapping stays valid after the file descriptor has been closed.
+        ::close(fileDescriptor);
+        if (mapping == MAP_FAILED)
+        {
+            errorMessage = "Unable to map file into memory.";
+            return false;
+        }
+
+        // The parser reads the document front to back exactly once.
+        ::madvise(mapping, fileSizeInByte, MADV_SEQUENTIAL);
+
+        m_data = static_cast<const char*>(mapping);
+        m_size = fileSizeInByte;
+        errorMessage.clear();
+        return true;
+#else
+        (void)filePath;
+        errorMessage = "Memory mapped files are not supported on this system.";
+        return false;
+#endif
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void MappedFile::close()
+    {
+#ifdef TGUI_SYSTEM_LINUX
+        if (m_data != nullptr)
+            ::munmap(const_cast<char*>(m_data), m_size);
+#endif
+        m_data = nullptr;
+        m_size = 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool MappedFile::isSupported()
+    {
+#ifdef TGUI_SYSTEM_LINUX
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+} }
@@ -20,7 +20,14 @@ namespace tgui  { namespace xhtml
 
     bool UtfHelper::checkValid(const std::vector<char>& data, bool utf8)
     {
-        size_t ix = data.size();
+        return checkValid(data.data(), data.size(), utf8);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool UtfHelper::checkValid(const char* data, size_t size, bool utf8)
+    {
+        size_t ix = size;
 
         for (size_t i = 0; i < ix; i++)
         {
@@ -39,7 +46,7 @@ namespace tgui  { namespace xhtml
 
             for (size_t j = 0; j < n && i < ix; j++)
             {   // n bytes matching 10bbbbbb follow ?
-                if ((++i == ix) || ((c & 0xC0) != 0x80))
+                if ((++i == ix) || ((static_cast<unsigned char>(data[i]) & 0xC0) != 0x80))
                     return false;
             }
         }
@@ -48,4 +55,84 @@ namespace tgui  { namespace xhtml
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    size_t UtfHelper::decodeUtf8(const char* begin, const char* end, char32_t& codePoint)
+    {
+        if (begin >= end)
+        {
+            codePoint = 0;
+            return 0;
+        }
+
+        const unsigned char c = static_cast<unsigned char>(*begin);
+        size_t   n;        // number of continuation bytes
+        char32_t minValue; // smallest code point, that is legal for this sequence length (rejects overlong encodings)
+        if      (c <= 0x7f)           { codePoint = c; return 1; }
+        else if ((c & 0xE0) == 0xC0) { n = 1; minValue = 0x80;    codePoint = c & 0x1F; }
+        else if ((c & 0xF0) == 0xE0) { n = 2; minValue = 0x800;   codePoint = c & 0x0F; }
+        else if ((c & 0xF8) == 0xF0) { n = 3; minValue = 0x10000; codePoint = c & 0x07; }
+        else                         { codePoint = c; return 1; }
+
+        if (static_cast<size_t>(end - begin) <= n)
+        {
+            codePoint = c;
+            return 1;
+        }
+
+        for (size_t j = 1; j <= n; j++)
+        {
+            const unsigned char cc = static_cast<unsigned char>(begin[j]);
+            if ((cc & 0xC0) != 0x80)
+            {
+                codePoint = c;
+                return 1;
+            }
+            codePoint = (codePoint << 6) | (cc & 0x3F);
+        }
+
+        if (codePoint < minValue || codePoint > 0x10FFFF || (codePoint >= 0xD800 && codePoint <= 0xDFFF))
+        {
+            codePoint = c;
+            return 1;
+        }
+
+        return n + 1;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void UtfHelper::appendUtf8(tgui::String& target, const char* begin, const char* end)
+    {
+        target.reserve(target.size() + static_cast<size_t>(end - begin));
+
+        char32_t codePoint;
+        while (begin < end)
+        {
+            // fast path for ASCII runs, the typical content of markup
+            if (static_cast<unsigned char>(*begin) <= 0x7f)
+            {
+                target.push_back(static_cast<char32_t>(*begin));
+                begin++;
+                continue;
+            }
+            begin += decodeUtf8(begin, end, codePoint);
+            target.push_back(codePoint);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    size_t UtfHelper::offsetOfUtf8CodePoint(const char* begin, const char* end, size_t codePoints)
+    {
+        const char* work = begin;
+        char32_t    codePoint;
+        while (codePoints > 0 && work < end)
+        {
+            work += decodeUtf8(work, end, codePoint);
+            codePoints--;
+        }
+        return static_cast<size_t>(work - begin);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 } }
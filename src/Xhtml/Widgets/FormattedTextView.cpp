@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <cstdint>
 
 #include <TGUI/Config.hpp>
@@ -24,10 +25,21 @@ namespace tgui  { namespace xhtml
     constexpr const char FormattedTextView::StaticWidgetType[];
 #endif
 
+    namespace
+    {
+        /// @brief The height, above which a formatted element is kept apart from the short ones in the display list
+        constexpr float TallDisplayListEntryHeight = 512.0f;
+        /// @brief The height of the rows, the hit test grid splits the document into
+        constexpr float HitTestRowHeight = 32.0f;
+    }
+
     FormattedTextView::FormattedTextView(const char* typeName, bool initRenderer) :
-        ClickableWidget{typeName, false}, m_document(), m_zoom(1.0f), m_bordersCached(0), m_paddingCached(2),
+        ClickableWidget{typeName, false}, m_document(), m_zoom(1.0f), m_layoutRenderWidth(-1.0f), m_bordersCached(0), m_paddingCached(2),
         m_borderColorCached(Color::Transparent), m_backgroundColorCached(Color::Transparent),
-        m_horizontalScrollbar(), m_verticalScrollbar(), m_fontCollection(), m_anchorSources(), m_anchorTargets()
+        m_horizontalScrollbar(), m_verticalScrollbar(), m_fontCollection(), m_activeAnchorSources(), m_anchorTargets(),
+        m_displayList(), m_tallDisplayListStart(0), m_displayListMaxHeight(0.0f), m_displayListInnerSize(),
+        m_visibleDisplayList(), m_visiblePartTop(0.0f), m_visiblePartBottom(-1.0f),
+        m_hitTestRowStarts(), m_hitTestEntries()
     {
         m_horizontalScrollbar->setSize(/*Will be updated anyway*/ 18, 18);
         m_horizontalScrollbar->setVisible(false);
@@ -78,6 +90,15 @@ namespace tgui  { namespace xhtml
 
         updateScrollbars();
 
+        // The line breaks only depend on the width, a pure height change keeps the layout - but the rectangle and border
+        // geometry depends on the complete inner size
+        if (m_document != nullptr && getRenderSize().x == m_layoutRenderWidth)
+        {
+            if (getInnerSize() != m_displayListInnerSize)
+                rebuildDisplayList();
+            return;
+        }
+
         // The size of the XHTML static area has changed, update the content layout
         rearrangeText(true);
     }
@@ -290,19 +311,31 @@ namespace tgui  { namespace xhtml
 
         Vector2f adoptedPos = pos - Vector2f(m_paddingCached.getLeft(), m_paddingCached.getTop()) +
             Vector2f(static_cast<float>(m_horizontalScrollbar->getValue()), static_cast<float>(m_verticalScrollbar->getValue()));
-        for (FormattedLink::Ptr anchorSource : m_anchorSources)
+        m_activeAnchorSources.erase(std::remove_if(m_activeAnchorSources.begin(), m_activeAnchorSources.end(),
+                                                   [adoptedPos](const FormattedLink::Ptr& anchorSource)
+                                                   {
+                                                       if (anchorSource->getLayoutArea().contains(adoptedPos))
+                                                           return false;
+                                                       anchorSource->setActive(false);
+                                                       return true;
+                                                   }),
+                                    m_activeAnchorSources.end());
+
+        // Only the links within the hit test grid row of the mouse position are candidates to become active.
+        const size_t* hitTestEntry = nullptr;
+        const size_t* hitTestEnd = nullptr;
+        findHitTestRow(adoptedPos.y, hitTestEntry, hitTestEnd);
+        for (; hitTestEntry != hitTestEnd; hitTestEntry++)
         {
-            if (anchorSource->getLayoutArea().contains(adoptedPos))
+            const auto& displayListEntry = m_displayList[*hitTestEntry];
+            if (displayListEntry.Kind != DisplayListEntryKind::Rectangle || displayListEntry.SourceAnchor == nullptr)
+                continue;
+
+            const auto& anchorSource = displayListEntry.SourceAnchor;
+            if (!anchorSource->getActive() && anchorSource->getLayoutArea().contains(adoptedPos))
             {
-                if (anchorSource->getActive())
-                    continue;
                 anchorSource->setActive(true);
-            }
-            else
-            {
-                if (!anchorSource->getActive())
-                    continue;
-                anchorSource->setActive(false);
+                m_activeAnchorSources.push_back(anchorSource);
             }
         }
 
@@ -394,7 +427,9 @@ namespace tgui  { namespace xhtml
         if (m_horizontalScrollbar->isShown())
             m_horizontalScrollbar->leftMouseButtonNoLongerDown();
 
-        for (FormattedLink::Ptr anchorSource : m_anchorSources)
+        // Following a link lays out the document again, which replaces the active links.
+        const auto activeAnchorSources = m_activeAnchorSources;
+        for (FormattedLink::Ptr anchorSource : activeAnchorSources)
         {
             if (anchorSource->getActive())
             {
@@ -503,20 +538,14 @@ namespace tgui  { namespace xhtml
         {
             m_document->layout(renderSize, m_textSizeCached * m_zoom, getSharedRenderer()->getDefaultTextColor(), m_opacityCached,
                                m_fontCollection, keepSelection);
+            m_layoutRenderWidth = renderSize.x;
         }
 
-        m_anchorSources.clear();
         m_anchorTargets.clear();
         if (m_document != nullptr)
         {
             for (auto formattedElement : m_document->getContent())
             {
-                FormattedLink::Ptr formattedLink = nullptr;
-                if (formattedElement->getContentOrigin()->getTypeName() == MarkupLanguageElement::Anchor)
-                    formattedLink = std::dynamic_pointer_cast<FormattedLink>(formattedElement);
-                if (formattedLink != nullptr)
-                    m_anchorSources.push_back(formattedLink);
-
                 auto originName = formattedElement->getOriginName();
                 auto originId   = formattedElement->getOriginId();
                 if (!originName.empty())
@@ -526,11 +555,240 @@ namespace tgui  { namespace xhtml
             }
         }
 
+        rebuildDisplayList();
         updateScrollbars();
      }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void FormattedTextView::recalculateVisiblePart()
+    {
+        const float visibleTop = static_cast<float>(m_verticalScrollbar->getValue());
+        findVisibleDisplayListEntries(visibleTop, visibleTop + getRenderSize().y);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void FormattedTextView::rebuildDisplayList()
+    {
+        m_displayList.clear();
+        m_tallDisplayListStart = 0;
+        m_displayListMaxHeight = 0.0f;
+        m_rectangleVertices.clear();
+        m_rectangleIndices.clear();
+        m_activeAnchorSources.clear();
+        m_hitTestRowStarts.clear();
+        m_hitTestEntries.clear();
+        m_visibleDisplayList.clear();
+        m_visiblePartBottom = m_visiblePartTop - 1.0f;
+        m_displayListInnerSize = getInnerSize();
+        if (m_document == nullptr)
+            return;
+
+        std::vector<DisplayListEntry> tallEntries;
+        FormattedLink::Ptr lastSourceAnchor = nullptr;
+        const auto innerSize = m_displayListInnerSize;
+        const auto& content = m_document->getContent();
+        for (size_t index = 0; index < content.size(); index++)
+        {
+            const auto& formattedElement = content[index];
+            auto formattedTextSection = std::dynamic_pointer_cast<FormattedTextSection>(formattedElement);
+            auto formattedImage = std::dynamic_pointer_cast<FormattedImage>(formattedElement);
+            auto formattedRectangle = std::dynamic_pointer_cast<FormattedRectangle>(formattedElement);
+
+            DisplayListEntryKind kind;
+            if (formattedTextSection)
+                kind = DisplayListEntryKind::TextSection;
+            else if (formattedImage)
+                kind = DisplayListEntryKind::Image;
+            else if (formattedRectangle)
+                kind = DisplayListEntryKind::Rectangle;
+            else
+                continue;
+            DisplayListEntry entry(formattedElement, index, kind);
+
+            // A text section is drawn as part of a link, if it is located within the link rectangle, that precedes it.
+            if (formattedTextSection && lastSourceAnchor)
+            {
+                auto textRenderArea = formattedTextSection->getLayoutArea();
+                if (lastSourceAnchor->getLayoutArea().contains(textRenderArea.getPosition() + (textRenderArea.getSize() * 0.5F)))
+                    entry.SourceAnchor = lastSourceAnchor;
+            }
+            else if (!formattedImage && formattedRectangle)
+            {
+                if (lastSourceAnchor != nullptr)
+                {
+                    if (lastSourceAnchor->getLayoutBottom() < formattedRectangle->getLayoutTop() ||
+                        lastSourceAnchor->getLayoutTop() > formattedRectangle->getLayoutBottom())
+                        lastSourceAnchor = nullptr;
+                }
+                if (formattedRectangle->getContentOrigin() != nullptr && formattedRectangle->getContentOrigin()->getTypeName() == MarkupLanguageElement::Anchor)
+                {
+                    lastSourceAnchor = std::dynamic_pointer_cast<FormattedLink>(formattedElement);
+                    entry.SourceAnchor = lastSourceAnchor;
+                    if (lastSourceAnchor != nullptr && lastSourceAnchor->getActive())
+                        m_activeAnchorSources.push_back(lastSourceAnchor);
+                }
+            }
+
+            // The background and border geometry is built once per layout, in content order, into the shared buffers.
+            if (kind == DisplayListEntryKind::Rectangle)
+            {
+                entry.GeometryVertexBegin = m_rectangleVertices.size();
+                entry.GeometryIndexBegin  = m_rectangleIndices.size();
+                calculateRectangleVerticesAndIndices(formattedRectangle, innerSize, m_rectangleVertices, m_rectangleIndices);
+                entry.GeometryVertexEnd   = m_rectangleVertices.size();
+                entry.GeometryIndexEnd    = m_rectangleIndices.size();
+                for (size_t rectangleIndex = entry.GeometryIndexBegin; rectangleIndex < entry.GeometryIndexEnd; rectangleIndex++)
+                    m_rectangleIndices[rectangleIndex] -= static_cast<unsigned int>(entry.GeometryVertexBegin);
+            }
+
+            // Containers can span the whole document - they would spoil the search window of the short entries.
+            if (entry.Bottom - entry.Top > TallDisplayListEntryHeight)
+                tallEntries.push_back(std::move(entry));
+            else
+            {
+                m_displayListMaxHeight = std::max(m_displayListMaxHeight, entry.Bottom - entry.Top);
+                m_displayList.push_back(std::move(entry));
+            }
+        }
+
+        auto byTop = [](const DisplayListEntry& left, const DisplayListEntry& right) { return left.Top < right.Top; };
+        std::stable_sort(m_displayList.begin(), m_displayList.end(), byTop);
+        std::stable_sort(tallEntries.begin(), tallEntries.end(), byTop);
+        m_tallDisplayListStart = m_displayList.size();
+        m_displayList.insert(m_displayList.end(), std::make_move_iterator(tallEntries.begin()), std::make_move_iterator(tallEntries.end()));
+
+        // The hit test grid lists the display list entries, that overlap a row, for each row - counted first, then filled.
+        auto firstRow = [](const DisplayListEntry& entry) { return static_cast<size_t>(std::max(0.0f, entry.Top) / HitTestRowHeight); };
+        auto lastRow  = [](const DisplayListEntry& entry) { return static_cast<size_t>(std::max(0.0f, entry.Bottom) / HitTestRowHeight); };
+        size_t rowCount = 0;
+        for (const auto& entry : m_displayList)
+            rowCount = std::max(rowCount, lastRow(entry) + 1);
+        m_hitTestRowStarts.assign(rowCount + 1, 0);
+        for (const auto& entry : m_displayList)
+            for (size_t row = firstRow(entry); row <= lastRow(entry); row++)
+                m_hitTestRowStarts[row + 1]++;
+        for (size_t row = 0; row < rowCount; row++)
+            m_hitTestRowStarts[row + 1] += m_hitTestRowStarts[row];
+        m_hitTestEntries.resize(m_hitTestRowStarts.back());
+        std::vector<size_t> rowFill(m_hitTestRowStarts.begin(), m_hitTestRowStarts.end() - 1);
+        for (size_t displayListIndex = 0; displayListIndex < m_displayList.size(); displayListIndex++)
+            for (size_t row = firstRow(m_displayList[displayListIndex]); row <= lastRow(m_displayList[displayListIndex]); row++)
+                m_hitTestEntries[rowFill[row]++] = displayListIndex;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void FormattedTextView::findHitTestRow(float y, const size_t*& begin, const size_t*& end) const
+    {
+        begin = end = nullptr;
+        if (y < 0.0f || m_hitTestRowStarts.empty())
+            return;
+
+        const size_t row = static_cast<size_t>(y / HitTestRowHeight);
+        if (row + 1 >= m_hitTestRowStarts.size())
+            return;
+
+        begin = m_hitTestEntries.data() + m_hitTestRowStarts[row];
+        end   = m_hitTestEntries.data() + m_hitTestRowStarts[row + 1];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    FormattedElement::Ptr FormattedTextView::elementAt(Vector2f position) const
+    {
+        const size_t* hitTestEntry = nullptr;
+        const size_t* hitTestEnd = nullptr;
+        findHitTestRow(position.y, hitTestEntry, hitTestEnd);
+
+        // The frontmost element is the one drawn last, that is the one with the highest content index.
+        const DisplayListEntry* frontmostEntry = nullptr;
+        for (; hitTestEntry != hitTestEnd; hitTestEntry++)
+        {
+            const auto& displayListEntry = m_displayList[*hitTestEntry];
+            if ((frontmostEntry == nullptr || displayListEntry.Index > frontmostEntry->Index) &&
+                displayListEntry.Element->getLayoutArea().contains(position))
+                frontmostEntry = &displayListEntry;
+        }
+        return frontmostEntry != nullptr ? frontmostEntry->Element : nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void FormattedTextView::findVisibleDisplayListEntries(float top, float bottom) const
+    {
+        std::vector<size_t> previousVisibleDisplayList;
+        previousVisibleDisplayList.swap(m_visibleDisplayList);
+        m_visibleDisplayList.reserve(previousVisibleDisplayList.size());
+
+        // A short entry, that intersects the range, starts at most the height of the tallest short entry above the range.
+        const auto shortEnd = m_displayList.begin() + static_cast<std::ptrdiff_t>(m_tallDisplayListStart);
+        auto displayListEntry = std::lower_bound(m_displayList.begin(), shortEnd, top - m_displayListMaxHeight,
+                                                 [](const DisplayListEntry& entry, float value) { return entry.Top < value; });
+        for (; displayListEntry != shortEnd && displayListEntry->Top <= bottom; displayListEntry++)
+            if (displayListEntry->Bottom >= top)
+                m_visibleDisplayList.push_back(static_cast<size_t>(displayListEntry - m_displayList.begin()));
+
+        // The few tall entries are checked one by one.
+        for (displayListEntry = shortEnd; displayListEntry != m_displayList.end() && displayListEntry->Top <= bottom; displayListEntry++)
+            if (displayListEntry->Bottom >= top)
+                m_visibleDisplayList.push_back(static_cast<size_t>(displayListEntry - m_displayList.begin()));
+
+        // Draw in content order, so that backgrounds stay behind the text.
+        auto byIndex = [this](size_t left, size_t right) { return m_displayList[left].Index < m_displayList[right].Index; };
+        std::sort(m_visibleDisplayList.begin(), m_visibleDisplayList.end(), byIndex);
+
+        // Release the retained text of the entries, that scrolled out - only the visible part keeps glyph geometry.
+        auto visibleDisplayListIndex = m_visibleDisplayList.begin();
+        for (size_t previousDisplayListIndex : previousVisibleDisplayList)
+        {
+            while (visibleDisplayListIndex != m_visibleDisplayList.end() && byIndex(*visibleDisplayListIndex, previousDisplayListIndex))
+                visibleDisplayListIndex++;
+            if (visibleDisplayListIndex == m_visibleDisplayList.end() || *visibleDisplayListIndex != previousDisplayListIndex)
+                m_displayList[previousDisplayListIndex].TextGeometry = nullptr;
+        }
+
+        m_visiblePartTop = top;
+        m_visiblePartBottom = bottom;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const Text& FormattedTextView::getRetainedText(size_t displayListIndex) const
+    {
+        const auto& displayListEntry = m_displayList[displayListIndex];
+        auto formattedTextSection = std::static_pointer_cast<FormattedTextSection>(displayListEntry.Element);
+        const auto& sourceAnchor = displayListEntry.SourceAnchor;
+        const bool showsActiveLink = sourceAnchor != nullptr && sourceAnchor->getActive();
+
+        if (displayListEntry.TextGeometry == nullptr)
+        {
+            displayListEntry.TextGeometry = std::make_shared<Text>();
+            displayListEntry.TextGeometry->setString(formattedTextSection->getString());
+            displayListEntry.TextGeometry->setFont(formattedTextSection->getFont());
+            displayListEntry.TextGeometry->setCharacterSize(formattedTextSection->getCharacterSizeAsInt());
+            displayListEntry.TextGeometry->setPosition({formattedTextSection->getLayoutLeft(),  formattedTextSection->getLayoutTop()});
+            displayListEntry.TextGeometry->setOpacity(formattedTextSection->getOpacity());
+            displayListEntry.TextGeometry->setColor(sourceAnchor != nullptr ? sourceAnchor->getLinkColor() : formattedTextSection->getColor());
+            displayListEntry.TextGeometry->setStyle(formattedTextSection->getStyle());
+            displayListEntry.TextGeometryShowsActiveLink = false;
+        }
+
+        // Hovering a link is the only change between frames - it patches color and style, the glyphs stay untouched.
+        if (displayListEntry.TextGeometryShowsActiveLink != showsActiveLink)
+        {
+            displayListEntry.TextGeometry->setColor(showsActiveLink ? sourceAnchor->getActiveColor() : sourceAnchor->getLinkColor());
+            displayListEntry.TextGeometry->setStyle(showsActiveLink && sourceAnchor->getUnderlined() ? formattedTextSection->getStyle() | TextStyle::Underlined
+                                                                                                     : formattedTextSection->getStyle());
+            displayListEntry.TextGeometryShowsActiveLink = showsActiveLink;
+        }
+
+        return *displayListEntry.TextGeometry;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void FormattedTextView::draw(BackendRenderTarget& target, RenderStates states) const
     {
         const RenderStates statesForScrollbar = states;
@@ -562,44 +820,24 @@ namespace tgui  { namespace xhtml
         // Move the text according to the scrollars
         states.transform.translate({-static_cast<float>(m_horizontalScrollbar->getValue()), -static_cast<float>(m_verticalScrollbar->getValue())});
 
-        FormattedLink::Ptr lastSourceAnchor = nullptr;
-        for (auto formattedElement : m_document->getContent())
+        // Only the formatted elements, that intersect the clipping area, are drawn.
+        const float visibleTop = static_cast<float>(m_verticalScrollbar->getValue());
+        if (m_visiblePartTop != visibleTop || m_visiblePartBottom != visibleTop + clipHeight)
+            findVisibleDisplayListEntries(visibleTop, visibleTop + clipHeight);
+
+        for (size_t visibleIndex = 0; visibleIndex < m_visibleDisplayList.size(); visibleIndex++)
         {
-            auto formattedTextSection = std::dynamic_pointer_cast<FormattedTextSection>(formattedElement);
-            auto formattedImage = std::dynamic_pointer_cast<FormattedImage>(formattedElement);
-            auto formattedRectangle = std::dynamic_pointer_cast<FormattedRectangle>(formattedElement);
-            if (formattedTextSection)
+            const size_t displayListIndex = m_visibleDisplayList[visibleIndex];
+            const auto& displayListEntry = m_displayList[displayListIndex];
+            if (displayListEntry.Kind == DisplayListEntryKind::TextSection)
             {
-                bool match = false;
-                if (lastSourceAnchor)
-                {
-                    auto textRenderArea = formattedTextSection->getLayoutArea();
-
-                    if (lastSourceAnchor->getLayoutArea().contains(textRenderArea.getPosition() + (textRenderArea.getSize() * 0.5F)))
-                        match = true;
-                }
-
-                Text text;
-                text.setString(formattedTextSection->getString());
-                text.setFont(formattedTextSection->getFont());
-                text.setCharacterSize(formattedTextSection->getCharacterSizeAsInt());
-                text.setPosition({formattedTextSection->getLayoutLeft(),  formattedTextSection->getLayoutTop()});
-                text.setOpacity(formattedTextSection->getOpacity());
-                if (match)
-                {
-                    text.setColor(lastSourceAnchor->getActive() ? lastSourceAnchor->getActiveColor() : lastSourceAnchor->getLinkColor());
-                    text.setStyle(lastSourceAnchor->getActive() && lastSourceAnchor->getUnderlined() ? formattedTextSection->getStyle() | TextStyle::Underlined : formattedTextSection->getStyle());
-                }
-                else
-                {
-                    text.setColor(formattedTextSection->getColor());
-                    text.setStyle(formattedTextSection->getStyle());
-                }
-
-                target.drawText(states, text);
+                // Each text section is drawn by its own call - tgui::Text doesn't expose its glyph vertices, so the sections
+                // can't be merged into one batch per font texture. The retained text only saves rebuilding the glyph quads.
+                target.drawText(states, getRetainedText(displayListIndex));
             }
-            else if (formattedImage)
+            else if (displayListEntry.Kind == DisplayListEntryKind::Image)
             {
+                auto formattedImage = std::static_pointer_cast<FormattedImage>(displayListEntry.Element);
                 auto topleft = formattedImage->getLayoutLeftTop();
                 if (formattedImage->getTexture().getData() != nullptr)
                 {
@@ -609,636 +847,665 @@ namespace tgui  { namespace xhtml
                     target.drawSprite(states, sprite);
                 }
             }
-            else if (formattedRectangle)
+            else
             {
-                if (lastSourceAnchor != nullptr)
+                // Consecutive rectangles, whose geometry is adjacent within the shared buffers, are drawn with a single call.
+                size_t runEnd = visibleIndex + 1;
+                while (runEnd < m_visibleDisplayList.size() &&
+                       m_displayList[m_visibleDisplayList[runEnd]].Kind == DisplayListEntryKind::Rectangle &&
+                       m_displayList[m_visibleDisplayList[runEnd]].GeometryVertexBegin == m_displayList[m_visibleDisplayList[runEnd - 1]].GeometryVertexEnd)
+                    runEnd++;
+
+                const auto& lastDisplayListEntry = m_displayList[m_visibleDisplayList[runEnd - 1]];
+                const size_t vertexBegin = displayListEntry.GeometryVertexBegin;
+                const size_t indexCount  = lastDisplayListEntry.GeometryIndexEnd - displayListEntry.GeometryIndexBegin;
+                if (indexCount > 0)
                 {
-                    if (lastSourceAnchor->getLayoutBottom() < formattedRectangle->getLayoutTop() ||
-                        lastSourceAnchor->getLayoutTop() > formattedRectangle->getLayoutBottom())
-                        lastSourceAnchor = nullptr;
+                    // The indices of an entry are relative to its first vertex - a run needs them relative to the first vertex of the run.
+                    const unsigned int* indices = m_rectangleIndices.data() + displayListEntry.GeometryIndexBegin;
+                    if (runEnd - visibleIndex > 1)
+                    {
+                        m_rectangleRunIndices.clear();
+                        for (size_t runIndex = visibleIndex; runIndex < runEnd; runIndex++)
+                        {
+                            const auto& runEntry = m_displayList[m_visibleDisplayList[runIndex]];
+                            const auto vertexOffset = static_cast<unsigned int>(runEntry.GeometryVertexBegin - vertexBegin);
+                            for (size_t index = runEntry.GeometryIndexBegin; index < runEntry.GeometryIndexEnd; index++)
+                                m_rectangleRunIndices.push_back(vertexOffset + m_rectangleIndices[index]);
+                        }
+                        indices = m_rectangleRunIndices.data();
+                    }
+                    target.drawVertexArray(states, m_rectangleVertices.data() + vertexBegin, lastDisplayListEntry.GeometryVertexEnd - vertexBegin,
+                                           indices, indexCount, nullptr);
                 }
-                if (formattedRectangle->getContentOrigin() != nullptr && formattedRectangle->getContentOrigin()->getTypeName() == MarkupLanguageElement::Anchor)
-                    lastSourceAnchor = std::dynamic_pointer_cast<FormattedLink>(formattedElement);
+                visibleIndex = runEnd - 1;
+            }
+        }
+
+        target.removeClippingLayer();
+
+        // Draw the scrollbars if needed
+        if (m_verticalScrollbar->isShown())
+            m_verticalScrollbar->draw(target, statesForScrollbar);
+
+        if (m_horizontalScrollbar->isShown())
+            m_horizontalScrollbar->draw(target, statesForScrollbar);
+   }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-                if (formattedRectangle->getOpacity() > 0.0f)
+    void FormattedTextView::calculateRectangleVerticesAndIndices(const FormattedRectangle::Ptr& formattedRectangle, Vector2f innerSize,
+        std::vector<tgui::Vertex>& batchVertices, std::vector<unsigned int>& batchIndices)
+    {
+        if (formattedRectangle->getOpacity() > 0.0f)
+        {
+            ///////////////
+            // 0-------1 //
+            // |       | //
+            // |       | //
+            // 3-------2 //
+            ///////////////
+
+            auto color = Vertex::Color(formattedRectangle->getBackgroundColor().getRed(),
+                                       formattedRectangle->getBackgroundColor().getGreen(),
+                                       formattedRectangle->getBackgroundColor().getBlue(),
+                                       std::max(std::min(static_cast<int>(formattedRectangle->getOpacity() * formattedRectangle->getBackgroundColor().getAlpha()), 255), 0));
+            const std::array<Vertex, 4> vertices = {{
+                {{formattedRectangle->getLayoutLeft()  + formattedRectangle->getMargin().left,  formattedRectangle->getLayoutTop()    + formattedRectangle->getMargin().top   }, color},
+                {{formattedRectangle->getLayoutLeft()  + formattedRectangle->getMargin().left,  formattedRectangle->getLayoutBottom() - formattedRectangle->getMargin().bottom}, color},
+                {{formattedRectangle->getLayoutRight() - formattedRectangle->getMargin().right, formattedRectangle->getLayoutTop()    + formattedRectangle->getMargin().top   }, color},
+                {{formattedRectangle->getLayoutRight() - formattedRectangle->getMargin().right, formattedRectangle->getLayoutBottom() - formattedRectangle->getMargin().bottom}, color}
+            }};
+            const std::array<unsigned int, 2*3> indices = {{
+                0, 1, 2,
+                1, 3, 2
+            }};
+            appendVerticesAndIndices(vertices.data(), vertices.size(), indices.data(), indices.size(), batchVertices, batchIndices);
+        }
+
+        if (!formattedRectangle->getBoderWidth().isEmpty(innerSize) && !formattedRectangle->getBoderStyle().isNoneOrHidden())
+        {
+            Outline borderWidth(std::max(1.0f, formattedRectangle->getBoderWidth().left),  std::max(1.0f, formattedRectangle->getBoderWidth().top),
+                                std::max(1.0f, formattedRectangle->getBoderWidth().right), std::max(1.0f, formattedRectangle->getBoderWidth().bottom));
+            auto color = Vertex::Color(formattedRectangle->getBorderColor().getRed(),
+                                       formattedRectangle->getBorderColor().getGreen(),
+                                       formattedRectangle->getBorderColor().getBlue(),
+                                       std::max(std::min(static_cast<int>(formattedRectangle->getOpacity() * formattedRectangle->getBorderColor().getAlpha()), 255), 0));
+            Outline borderArea{ formattedRectangle->getLayoutLeft()   + formattedRectangle->getMargin().left,
+                                formattedRectangle->getLayoutTop()    + formattedRectangle->getMargin().top,
+                                formattedRectangle->getLayoutRight()  - formattedRectangle->getMargin().right,
+                                formattedRectangle->getLayoutBottom() - formattedRectangle->getMargin().bottom };
+
+            //        lft1 lft2  lft3 lft4 lft5                rgt5 rgt4  rgt3 rgt2 rgt1
+            //        |       |   |   |       |                |       |   |   |       |
+            // top1-- +----------------------------------------------------------------+
+            //        | \                                                            / |
+            //        |   \                                                        /   |
+            //        |     \                                                    /     |
+            // top2-- |       +------------------------------------------------+       |
+            //        |       |                                                |       |
+            // top3-- |       |                                                |       |
+            //        |       |                                                |       |
+            // top4-- |       |       +--------------------------------+       |       |
+            //        |       |       | \                            / |       |       |
+            //        |       |       |   \                        /   |       |       |
+            //        |       |       |     \                    /     |       |       |
+            // top5-- |       |       |       +----------------+       |       |       |
+            //        |       |       |       |                |       |       |       |
+            //        |       |       |       |                |       |       |       |
+            //        :       :       :       :                :       :       :       :
+            //
+            //        :           :           :                :           :           :
+            //        |           |           |                |           |           |
+            //        |           |           |                |           |           |
+            // btm5-- |           |           +----------------+           |           |
+            //        |           |                                        |           |
+            //        |           |                                        |           |
+            //        |           |                                        |           |
+            // btm4-- |           |                                        |           |
+            //        |           |                                        |           |
+            // btm3-- |           +----------------------------------------+           |
+            //        |         /                                            \         |
+            // btm2-- |       /                                                \       |
+            //        |     /                                                    \     |
+            //        |   /                                                        \   |
+            //        | /                                                            \ |
+            // btm1-- +----------------------------------------------------------------+
+            //        |       |   |   |       |                |       |   |   |       |
+            //        lft1 lft2  lft3 lft4 lft5                rgt5 rgt4  rgt3 rgt2 rgt1
+            if (formattedRectangle->getBoderWidth().left > 0.0f)
+            {
+                if (formattedRectangle->getBoderStyle().left == BorderStyle::Solid)
                 {
-                    ///////////////
-                    // 0-------1 //
-                    // |       | //
-                    // |       | //
-                    // 3-------2 //
-                    ///////////////
-
-                    auto color = Vertex::Color(formattedRectangle->getBackgroundColor().getRed(),
-                                               formattedRectangle->getBackgroundColor().getGreen(),
-                                               formattedRectangle->getBackgroundColor().getBlue(),
-                                               std::max(std::min(static_cast<int>(formattedRectangle->getOpacity() * formattedRectangle->getBackgroundColor().getAlpha()), 255), 0));
-                    const std::array<Vertex, 4> vertices = {{
-                        {{formattedRectangle->getLayoutLeft()  + formattedRectangle->getMargin().left,  formattedRectangle->getLayoutTop()    + formattedRectangle->getMargin().top   }, color},
-                        {{formattedRectangle->getLayoutLeft()  + formattedRectangle->getMargin().left,  formattedRectangle->getLayoutBottom() - formattedRectangle->getMargin().bottom}, color},
-                        {{formattedRectangle->getLayoutRight() - formattedRectangle->getMargin().right, formattedRectangle->getLayoutTop()    + formattedRectangle->getMargin().top   }, color},
-                        {{formattedRectangle->getLayoutRight() - formattedRectangle->getMargin().right, formattedRectangle->getLayoutBottom() - formattedRectangle->getMargin().bottom}, color}
-                    }};
-                    const std::array<unsigned int, 2*3> indices = {{
-                        0, 1, 2,
-                        1, 3, 2
-                    }};
-                    target.drawVertexArray(states, vertices.data(), vertices.size(), indices.data(), indices.size(), nullptr);
-                    //target.drawTriangle(states, vertices[0], vertices[1], vertices[2]);
-                    //target.drawTriangle(states, vertices[1], vertices[3], vertices[2]);
+                    const std::array<Vertex, 4> vertices = { {
+                        { { borderArea.getLeft(),                           borderArea.getTop()    }, color },
+                        { { borderArea.getLeft() + borderWidth.getLeft(),   borderArea.getTop()    }, color },
+                        { { borderArea.getLeft() + borderWidth.getLeft(),   borderArea.getBottom() }, color },
+                        { { borderArea.getLeft(),                           borderArea.getBottom() }, color }
+                    } };
+                    const std::array<unsigned int, 2 * 3> indices = { {
+                        0, 1, 3,
+                        1, 2, 3
+                    } };
+                    appendVerticesAndIndices(vertices.data(), vertices.size(), indices.data(), indices.size(), batchVertices, batchIndices);
                 }
-
-                if (!formattedRectangle->getBoderWidth().isEmpty(innerSize) && !formattedRectangle->getBoderStyle().isNoneOrHidden())
+                else if (formattedRectangle->getBoderStyle().left == BorderStyle::Dotted ||
+                         formattedRectangle->getBoderStyle().left == BorderStyle::Dashed)
                 {
-                    Outline borderWidth(std::max(1.0f, formattedRectangle->getBoderWidth().left),  std::max(1.0f, formattedRectangle->getBoderWidth().top),
-                                        std::max(1.0f, formattedRectangle->getBoderWidth().right), std::max(1.0f, formattedRectangle->getBoderWidth().bottom));
-                    auto color = Vertex::Color(formattedRectangle->getBorderColor().getRed(),
-                                               formattedRectangle->getBorderColor().getGreen(),
-                                               formattedRectangle->getBorderColor().getBlue(),
-                                               std::max(std::min(static_cast<int>(formattedRectangle->getOpacity() * formattedRectangle->getBorderColor().getAlpha()), 255), 0));
-                    Outline borderArea{ formattedRectangle->getLayoutLeft()   + formattedRectangle->getMargin().left,
-                                        formattedRectangle->getLayoutTop()    + formattedRectangle->getMargin().top,
-                                        formattedRectangle->getLayoutRight()  - formattedRectangle->getMargin().right,
-                                        formattedRectangle->getLayoutBottom() - formattedRectangle->getMargin().bottom };
-
-                    //        lft1 lft2  lft3 lft4 lft5                rgt5 rgt4  rgt3 rgt2 rgt1
-                    //        |       |   |   |       |                |       |   |   |       |
-                    // top1-- +----------------------------------------------------------------+
-                    //        | \                                                            / |
-                    //        |   \                                                        /   |
-                    //        |     \                                                    /     |
-                    // top2-- |       +------------------------------------------------+       |
-                    //        |       |                                                |       |
-                    // top3-- |       |                                                |       |
-                    //        |       |                                                |       |
-                    // top4-- |       |       +--------------------------------+       |       |
-                    //        |       |       | \                            / |       |       |
-                    //        |       |       |   \                        /   |       |       |
-                    //        |       |       |     \                    /     |       |       |
-                    // top5-- |       |       |       +----------------+       |       |       |
-                    //        |       |       |       |                |       |       |       |
-                    //        |       |       |       |                |       |       |       |
-                    //        :       :       :       :                :       :       :       :
-                    //
-                    //        :           :           :                :           :           :
-                    //        |           |           |                |           |           |
-                    //        |           |           |                |           |           |
-                    // btm5-- |           |           +----------------+           |           |
-                    //        |           |                                        |           |
-                    //        |           |                                        |           |
-                    //        |           |                                        |           |
-                    // btm4-- |           |                                        |           |
-                    //        |           |                                        |           |
-                    // btm3-- |           +----------------------------------------+           |
-                    //        |         /                                            \         |
-                    // btm2-- |       /                                                \       |
-                    //        |     /                                                    \     |
-                    //        |   /                                                        \   |
-                    //        | /                                                            \ |
-                    // btm1-- +----------------------------------------------------------------+
-                    //        |       |   |   |       |                |       |   |   |       |
-                    //        lft1 lft2  lft3 lft4 lft5                rgt5 rgt4  rgt3 rgt2 rgt1
-                    if (formattedRectangle->getBoderWidth().left > 0.0f)
+                    auto distance = borderArea.getBottom() - borderArea.getTop();
+                    if ((formattedRectangle->getBoderStyle().left == BorderStyle::Dotted && distance > borderWidth.getLeft()) ||
+                        (formattedRectangle->getBoderStyle().left == BorderStyle::Dashed && distance > borderWidth.getLeft() * 3))
                     {
-                        if (formattedRectangle->getBoderStyle().left == BorderStyle::Solid)
-                        {
-                            const std::array<Vertex, 4> vertices = { {
-                                { { borderArea.getLeft(),                           borderArea.getTop()    }, color },
-                                { { borderArea.getLeft() + borderWidth.getLeft(),   borderArea.getTop()    }, color },
-                                { { borderArea.getLeft() + borderWidth.getLeft(),   borderArea.getBottom() }, color },
-                                { { borderArea.getLeft(),                           borderArea.getBottom() }, color }
-                            } };
-                            const std::array<unsigned int, 2 * 3> indices = { {
-                                0, 1, 3,
-                                1, 2, 3
-                            } };
-                            target.drawVertexArray(states, vertices.data(), vertices.size(), indices.data(), indices.size(), nullptr);
-                        }
-                        else if (formattedRectangle->getBoderStyle().left == BorderStyle::Dotted ||
-                                 formattedRectangle->getBoderStyle().left == BorderStyle::Dashed)
-                        {
-                            auto distance = borderArea.getBottom() - borderArea.getTop();
-                            if ((formattedRectangle->getBoderStyle().left == BorderStyle::Dotted && distance > borderWidth.getLeft()) ||
-                                (formattedRectangle->getBoderStyle().left == BorderStyle::Dashed && distance > borderWidth.getLeft() * 3))
-                            {
-                                int   numDots   = 1;
-                                float stepWidth = 1.0f;
-                                float dotSize   = 1.0f;
-                                calculateBorderDots(distance, borderWidth.getLeft(), formattedRectangle->getBoderStyle().left == BorderStyle::Dashed, numDots, stepWidth, dotSize);
-
-                                std::vector<Vertex> vertices; vertices.resize(numDots * 4);
-                                std::vector<unsigned int> indices; indices.resize(numDots * 6);
-                                calculateDottedBorderVerticesAndIndices(numDots, stepWidth, color, true, borderArea.getLeft(), borderArea.getLeft() + borderWidth.getLeft(),
-                                    borderArea.getTop(), borderArea.getTop() + dotSize, borderArea.getBottom() - dotSize, borderArea.getBottom(), vertices, indices);
-                                target.drawVertexArray(states, vertices.data(), vertices.size(), indices.data(), indices.size(), nullptr);
-                            }
-                        }
-                        else if (formattedRectangle->getBoderStyle().left == BorderStyle::Double)
-                        {
-                            float top1 = borderArea.getTop();
-                            float top2 = borderArea.getTop() + borderWidth.getTop() / 3;
-                            float top4 = borderArea.getTop() + borderWidth.getTop() - borderWidth.getTop() / 3;
-                            float top5 = borderArea.getTop() + borderWidth.getTop();
-                            float btm1 = borderArea.getBottom() - borderWidth.getBottom();
-                            float btm2 = borderArea.getBottom() - borderWidth.getBottom() + borderWidth.getBottom() / 3;
-                            float btm4 = borderArea.getBottom() - borderWidth.getBottom() / 3;
-                            float btm5 = borderArea.getBottom();
-                            float lft1 = borderArea.getLeft();
-                            float lft2 = borderArea.getLeft() + borderWidth.getLeft() / 3;
-                            float lft4 = borderArea.getLeft() + borderWidth.getLeft() - borderWidth.getLeft() / 3;
-                            float lft5 = borderArea.getLeft() + borderWidth.getLeft();
-                            const std::array<Vertex, 8> vertices = { {
-                                { { lft1, top1 }, color },
-                                { { lft2, top2 }, color },
-                                { { lft2, btm4 }, color },
-                                { { lft1, btm5 }, color },
-
-                                { { lft4, top4 }, color },
-                                { { lft5, top5 }, color },
-                                { { lft5, btm1 }, color },
-                                { { lft4, btm2 }, color }
-                            } };
-                            const std::array<unsigned int, 4 * 3> indices = { {
-                                0, 1, 3,
-                                1, 2, 3,
-                                4, 5, 7,
-                                5, 6, 7
-                            } };
-                            target.drawVertexArray(states, vertices.data(), vertices.size(), indices.data(), indices.size(), nullptr);
-                        }
-                        else if (formattedRectangle->getBoderStyle().left == BorderStyle::Groove ||
-                                 formattedRectangle->getBoderStyle().left == BorderStyle::Ridge)
-                        {
-                            color = formattedRectangle->getBoderStyle().left == BorderStyle::Groove ?
-                                calculateDarkerColor (formattedRectangle->getBorderColor(), formattedRectangle->getOpacity()) :
-                                calculateLighterColor(formattedRectangle->getBorderColor(), formattedRectangle->getOpacity());
-                            auto colo2 = formattedRectangle->getBoderStyle().left == BorderStyle::Groove ?
-                                calculateLighterColor(formattedRectangle->getBorderColor(), formattedRectangle->getOpacity()) :
-                                calculateDarkerColor (formattedRectangle->getBorderColor(), formattedRectangle->getOpacity());
-
-                            float top1 = borderArea.getTop();
-                            float top3 = borderArea.getTop() + borderWidth.getTop() / 2;
-                            float top5 = borderArea.getTop() + borderWidth.getTop();
-                            float btm1 = borderArea.getBottom() - borderWidth.getBottom();
-                            float btm3 = borderArea.getBottom() - borderWidth.getBottom() / 2;
-                            float btm5 = borderArea.getBottom();
-                            float lft1 = borderArea.getLeft();
-                            float lft3 = borderArea.getLeft() + borderWidth.getLeft() / 2;
-                            float lft5 = borderArea.getLeft() + borderWidth.getLeft();
-                            const std::array<Vertex, 8> vertices = { {
-                                { { lft1, top1 }, color },
-                                { { lft3, top3 }, color },
-                                { { lft3, btm3 }, color },
-                                { { lft1, btm5 }, color },
-
-                                { { lft3, top3 }, colo2 },
-                                { { lft5, top5 }, colo2 },
-                                { { lft5, btm1 }, colo2 },
-                                { { lft3, btm3 }, colo2 }
-                            } };
-                            const std::array<unsigned int, 4 * 3> indices = { {
-                                0, 1, 3,
-                                1, 2, 3,
-                                4, 5, 7,
-                                5, 6, 7
-                            } };
-                            target.drawVertexArray(states, vertices.data(), vertices.size(), indices.data(), indices.size(), nullptr);
-                        }
-                        else if (formattedRectangle->getBoderStyle().left == BorderStyle::Inset ||
-                                 formattedRectangle->getBoderStyle().left == BorderStyle::Outset)
-                        {
-                            color = formattedRectangle->getBoderStyle().left == BorderStyle::Inset ?
-                                calculateDarkerColor (formattedRectangle->getBorderColor(), formattedRectangle->getOpacity()) :
-                                calculateLighterColor(formattedRectangle->getBorderColor(), formattedRectangle->getOpacity());
-
-                            float top1 = borderArea.getTop();
-                            float top5 = borderArea.getTop() + borderWidth.getTop();
-                            float btm1 = borderArea.getBottom() - borderWidth.getBottom();
-                            float btm5 = borderArea.getBottom();
-                            float lft1 = borderArea.getLeft();
-                            float lft5 = borderArea.getLeft() + borderWidth.getLeft();
-                            const std::array<Vertex, 4> vertices = { {
-                                { { lft1, top1 }, color },
-                                { { lft5, top5 }, color },
-                                { { lft5, btm1 }, color },
-                                { { lft1, btm5 }, color }
-                            } };
-                            const std::array<unsigned int, 2 * 3> indices = { {
-                                0, 1, 3,
-                                1, 2, 3
-                            } };
-                            target.drawVertexArray(states, vertices.data(), vertices.size(), indices.data(), indices.size(), nullptr);
-                        }
+                        int   numDots   = 1;
+                        float stepWidth = 1.0f;
+                        float dotSize   = 1.0f;
+                        calculateBorderDots(distance, borderWidth.getLeft(), formattedRectangle->getBoderStyle().left == BorderStyle::Dashed, numDots, stepWidth, dotSize);
+
+                        calculateDottedBorderVerticesAndIndices(numDots, stepWidth, color, true, borderArea.getLeft(), borderArea.getLeft() + borderWidth.getLeft(),
+                            borderArea.getTop(), borderArea.getTop() + dotSize, borderArea.getBottom() - dotSize, borderArea.getBottom(), batchVertices, batchIndices);
                     }
-                    if (formattedRectangle->getBoderWidth().top > 0.0f)
+                }
+                else if (formattedRectangle->getBoderStyle().left == BorderStyle::Double)
+                {
+                    float top1 = borderArea.getTop();
+                    float top2 = borderArea.getTop() + borderWidth.getTop() / 3;
+                    float top4 = borderArea.getTop() + borderWidth.getTop() - borderWidth.getTop() / 3;
+                    float top5 = borderArea.getTop() + borderWidth.getTop();
+                    float btm1 = borderArea.getBottom() - borderWidth.getBottom();
+                    float btm2 = borderArea.getBottom() - borderWidth.getBottom() + borderWidth.getBottom() / 3;
+                    float btm4 = borderArea.getBottom() - borderWidth.getBottom() / 3;
+                    float btm5 = borderArea.getBottom();
+                    float lft1 = borderArea.getLeft();
+                    float lft2 = borderArea.getLeft() + borderWidth.getLeft() / 3;
+                    float lft4 = borderArea.getLeft() + borderWidth.getLeft() - borderWidth.getLeft() / 3;
+                    float lft5 = borderArea.getLeft() + borderWidth.getLeft();
+                    const std::array<Vertex, 8> vertices = { {
+                        { { lft1, top1 }, color },
+                        { { lft2, top2 }, color },
+                        { { lft2, btm4 }, color },
+                        { { lft1, btm5 }, color },
+
+                        { { lft4, top4 }, color },
+                        { { lft5, top5 }, color },
+                        { { lft5, btm1 }, color },
+                        { { lft4, btm2 }, color }
+                    } };
+                    const std::array<unsigned int, 4 * 3> indices = { {
+                        0, 1, 3,
+                        1, 2, 3,
+                        4, 5, 7,
+                        5, 6, 7
+                    } };
+                    appendVerticesAndIndices(vertices.data(), vertices.size(), indices.data(), indices.size(), batchVertices, batchIndices);
+                }
+                else if (formattedRectangle->getBoderStyle().left == BorderStyle::Groove ||
+                         formattedRectangle->getBoderStyle().left == BorderStyle::Ridge)
+                {
+                    color = formattedRectangle->getBoderStyle().left == BorderStyle::Groove ?
+                        calculateDarkerColor (formattedRectangle->getBorderColor(), formattedRectangle->getOpacity()) :
+                        calculateLighterColor(formattedRectangle->getBorderColor(), formattedRectangle->getOpacity());
+                    auto colo2 = formattedRectangle->getBoderStyle().left == BorderStyle::Groove ?
+                        calculateLighterColor(formattedRectangle->getBorderColor(), formattedRectangle->getOpacity()) :
+                        calculateDarkerColor (formattedRectangle->getBorderColor(), formattedRectangle->getOpacity());
+
+                    float top1 = borderArea.getTop();
+                    float top3 = borderArea.getTop() + borderWidth.getTop() / 2;
+                    float top5 = borderArea.getTop() + borderWidth.getTop();
+                    float btm1 = borderArea.getBottom() - borderWidth.getBottom();
+                    float btm3 = borderArea.getBottom() - borderWidth.getBottom() / 2;
+                    float btm5 = borderArea.getBottom();
+                    float lft1 = borderArea.getLeft();
+                    float lft3 = borderArea.getLeft() + borderWidth.getLeft() / 2;
+                    float lft5 = borderArea.getLeft() + borderWidth.getLeft();
+                    const std::array<Vertex, 8> vertices = { {
+                        { { lft1, top1 }, color },
+                        { { lft3, top3 }, color },
+                        { { lft3, btm3 }, color },
+                        { { lft1, btm5 }, color },
+
+                        { { lft3, top3 }, colo2 },
+                        { { lft5, top5 }, colo2 },
+                        { { lft5, btm1 }, colo2 },
+                        { { lft3, btm3 }, colo2 }
+                    } };
+                    const std::array<unsigned int, 4 * 3> indices = { {
+                        0, 1, 3,
+                        1, 2, 3,
+                        4, 5, 7,
+                        5, 6, 7
+                    } };
+                    appendVerticesAndIndices(vertices.data(), vertices.size(), indices.data(), indices.size(), batchVertices, batchIndices);
+                }
+                else if (formattedRectangle->getBoderStyle().left == BorderStyle::Inset ||
+                         formattedRectangle->getBoderStyle().left == BorderStyle::Outset)
+                {
+                    color = formattedRectangle->getBoderStyle().left == BorderStyle::Inset ?
+                        calculateDarkerColor (formattedRectangle->getBorderColor(), formattedRectangle->getOpacity()) :
+                        calculateLighterColor(formattedRectangle->getBorderColor(), formattedRectangle->getOpacity());
+
+                    float top1 = borderArea.getTop();
+                    float top5 = borderArea.getTop() + borderWidth.getTop();
+                    float btm1 = borderArea.getBottom() - borderWidth.getBottom();
+                    float btm5 = borderArea.getBottom();
+                    float lft1 = borderArea.getLeft();
+                    float lft5 = borderArea.getLeft() + borderWidth.getLeft();
+                    const std::array<Vertex, 4> vertices = { {
+                        { { lft1, top1 }, color },
+                        { { lft5, top5 }, color },
+                        { { lft5, btm1 }, color },
+                        { { lft1, btm5 }, color }
+                    } };
+                    const std::array<unsigned int, 2 * 3> indices = { {
+                        0, 1, 3,
+                        1, 2, 3
+                    } };
+                    appendVerticesAndIndices(vertices.data(), vertices.size(), indices.data(), indices.size(), batchVertices, batchIndices);
+                }
+            }
+            if (formattedRectangle->getBoderWidth().top > 0.0f)
+            {
+                if (formattedRectangle->getBoderStyle().top == BorderStyle::Solid)
+                {
+                    const std::array<Vertex, 4> vertices = { {
+                        { { borderArea.getLeft(),  borderArea.getTop()                        }, color },
+                        { { borderArea.getRight(), borderArea.getTop()                        }, color },
+                        { { borderArea.getRight(), borderArea.getTop() + borderWidth.getTop() }, color },
+                        { { borderArea.getLeft(),  borderArea.getTop() + borderWidth.getTop() }, color }
+                    } };
+                    const std::array<unsigned int, 2 * 3> indices = { {
+                        0, 1, 3,
+                        1, 2, 3
+                    } };
+                    appendVerticesAndIndices(vertices.data(), vertices.size(), indices.data(), indices.size(), batchVertices, batchIndices);
+                }
+                else if (formattedRectangle->getBoderStyle().top == BorderStyle::Dotted ||
+                         formattedRectangle->getBoderStyle().top == BorderStyle::Dashed)
+                {
+                    auto distance = borderArea.getRight() - borderArea.getLeft();
+                    if ((formattedRectangle->getBoderStyle().top == BorderStyle::Dotted && distance > borderWidth.getTop()) ||
+                        (formattedRectangle->getBoderStyle().top == BorderStyle::Dashed && distance > borderWidth.getTop() * 3))
                     {
-                        if (formattedRectangle->getBoderStyle().top == BorderStyle::Solid)
-                        {
-                            const std::array<Vertex, 4> vertices = { {
-                                { { borderArea.getLeft(),  borderArea.getTop()                        }, color },
-                                { { borderArea.getRight(), borderArea.getTop()                        }, color },
-                                { { borderArea.getRight(), borderArea.getTop() + borderWidth.getTop() }, color },
-                                { { borderArea.getLeft(),  borderArea.getTop() + borderWidth.getTop() }, color }
-                            } };
-                            const std::array<unsigned int, 2 * 3> indices = { {
-                                0, 1, 3,
-                                1, 2, 3
-                            } };
-                            target.drawVertexArray(states, vertices.data(), vertices.size(), indices.data(), indices.size(), nullptr);
-                        }
-                        else if (formattedRectangle->getBoderStyle().top == BorderStyle::Dotted ||
-                                 formattedRectangle->getBoderStyle().top == BorderStyle::Dashed)
-                        {
-                            auto distance = borderArea.getRight() - borderArea.getLeft();
-                            if ((formattedRectangle->getBoderStyle().top == BorderStyle::Dotted && distance > borderWidth.getTop()) ||
-                                (formattedRectangle->getBoderStyle().top == BorderStyle::Dashed && distance > borderWidth.getTop() * 3))
-                            {
-                                int   numDots   = 1;
-                                float stepWidth = 1.0f;
-                                float dotSize   = 1.0f;
-                                calculateBorderDots(distance, borderWidth.getTop(), formattedRectangle->getBoderStyle().top == BorderStyle::Dashed, numDots, stepWidth, dotSize);
-
-                                std::vector<Vertex> vertices; vertices.resize(numDots * 4);
-                                std::vector<unsigned int> indices; indices.resize(numDots * 6);
-                                calculateDottedBorderVerticesAndIndices(numDots, stepWidth, color, false, borderArea.getLeft(), borderArea.getLeft() + dotSize,
-                                    borderArea.getTop(), borderArea.getTop() + borderWidth.getTop(), borderArea.getRight() - dotSize, borderArea.getRight(), vertices, indices);
-                                target.drawVertexArray(states, vertices.data(), vertices.size(), indices.data(), indices.size(), nullptr);
-                            }
-                        }
-                        else if (formattedRectangle->getBoderStyle().left == BorderStyle::Double)
-                        {
-                            float top1 = borderArea.getTop();
-                            float top2 = borderArea.getTop() + borderWidth.getTop() / 3;
-                            float top4 = borderArea.getTop() + borderWidth.getTop() - borderWidth.getTop() / 3;
-                            float top5 = borderArea.getTop() + borderWidth.getTop();
-                            float lft1 = borderArea.getLeft();
-                            float lft2 = borderArea.getLeft() + borderWidth.getLeft() / 3;
-                            float lft4 = borderArea.getLeft() + borderWidth.getLeft() - borderWidth.getLeft() / 3;
-                            float lft5 = borderArea.getLeft() + borderWidth.getLeft();
-                            float rgt5 = borderArea.getRight() - borderWidth.getRight();
-                            float rgt4 = borderArea.getRight() - borderWidth.getRight() + borderWidth.getRight() / 3;
-                            float rgt2 = borderArea.getRight() - borderWidth.getRight() / 3;
-                            float rgt1 = borderArea.getRight();
-                            const std::array<Vertex, 8> vertices = { {
-                                { { lft1, top1 }, color },
-                                { { rgt1, top1 }, color },
-                                { { rgt2, top2 }, color },
-                                { { lft2, top2 }, color },
-
-                                { { lft4, top4 }, color },
-                                { { rgt4, top4 }, color },
-                                { { rgt5, top5 }, color },
-                                { { lft5, top5 }, color }
-                            } };
-                            const std::array<unsigned int, 4 * 3> indices = { {
-                                0, 1, 3,
-                                1, 2, 3,
-                                4, 5, 7,
-                                5, 6, 7
-                            } };
-                            target.drawVertexArray(states, vertices.data(), vertices.size(), indices.data(), indices.size(), nullptr);
-                        }
-                        else if (formattedRectangle->getBoderStyle().top == BorderStyle::Groove ||
-                                 formattedRectangle->getBoderStyle().top == BorderStyle::Ridge)
-                        {
-                            color = formattedRectangle->getBoderStyle().left == BorderStyle::Groove ?
-                                calculateDarkerColor (formattedRectangle->getBorderColor(), formattedRectangle->getOpacity()) :
-                                calculateLighterColor(formattedRectangle->getBorderColor(), formattedRectangle->getOpacity());
-                            auto colo2 = formattedRectangle->getBoderStyle().left == BorderStyle::Groove ?
-                                calculateLighterColor(formattedRectangle->getBorderColor(), formattedRectangle->getOpacity()) :
-                                calculateDarkerColor (formattedRectangle->getBorderColor(), formattedRectangle->getOpacity());
-
-                            float top1 = borderArea.getTop();
-                            float top3 = borderArea.getTop() + borderWidth.getTop() / 2;
-                            float top5 = borderArea.getTop() + borderWidth.getTop();
-                            float lft1 = borderArea.getLeft();
-                            float lft3 = borderArea.getLeft() + borderWidth.getLeft() / 2;
-                            float lft5 = borderArea.getLeft() + borderWidth.getLeft();
-                            float rgt5 = borderArea.getRight() - borderWidth.getRight();
-                            float rgt3 = borderArea.getRight() - borderWidth.getRight() / 2;
-                            float rgt1 = borderArea.getRight();
-                            const std::array<Vertex, 8> vertices = { {
-                                { { lft1, top1 }, color },
-                                { { rgt1, top1 }, color },
-                                { { rgt3, top3 }, color },
-                                { { lft3, top3 }, color },
-
-                                { { lft3, top3 }, colo2 },
-                                { { rgt3, top3 }, colo2 },
-                                { { rgt5, top5 }, colo2 },
-                                { { lft5, top5 }, colo2 }
-                            } };
-                            const std::array<unsigned int, 4 * 3> indices = { {
-                                0, 1, 3,
-                                1, 2, 3,
-                                4, 5, 7,
-                                5, 6, 7
-                            } };
-                            target.drawVertexArray(states, vertices.data(), vertices.size(), indices.data(), indices.size(), nullptr);
-                        }
-                        else if (formattedRectangle->getBoderStyle().top == BorderStyle::Inset ||
-                                 formattedRectangle->getBoderStyle().top == BorderStyle::Outset)
-                        {
-                            color = formattedRectangle->getBoderStyle().left == BorderStyle::Inset ?
-                                calculateDarkerColor (formattedRectangle->getBorderColor(), formattedRectangle->getOpacity()) :
-                                calculateLighterColor(formattedRectangle->getBorderColor(), formattedRectangle->getOpacity());
-
-                            float top1 = borderArea.getTop();
-                            float top5 = borderArea.getTop() + borderWidth.getTop();
-                            float lft1 = borderArea.getLeft();
-                            float lft5 = borderArea.getLeft() + borderWidth.getLeft();
-                            float rgt5 = borderArea.getRight() - borderWidth.getRight();
-                            float rgt1 = borderArea.getRight();
-                            const std::array<Vertex, 4> vertices = { {
-                                { { lft1, top1 }, color },
-                                { { rgt1, top1 }, color },
-                                { { rgt5, top5 }, color },
-                                { { lft5, top5 }, color }
-                            } };
-                            const std::array<unsigned int, 2 * 3> indices = { {
-                                0, 1, 3,
-                                1, 2, 3
-                            } };
-                            target.drawVertexArray(states, vertices.data(), vertices.size(), indices.data(), indices.size(), nullptr);
-                        }
+                        int   numDots   = 1;
+                        float stepWidth = 1.0f;
+                        float dotSize   = 1.0f;
+                        calculateBorderDots(distance, borderWidth.getTop(), formattedRectangle->getBoderStyle().top == BorderStyle::Dashed, numDots, stepWidth, dotSize);
+
+                        calculateDottedBorderVerticesAndIndices(numDots, stepWidth, color, false, borderArea.getLeft(), borderArea.getLeft() + dotSize,
+                            borderArea.getTop(), borderArea.getTop() + borderWidth.getTop(), borderArea.getRight() - dotSize, borderArea.getRight(), batchVertices, batchIndices);
                     }
-                    if (formattedRectangle->getBoderWidth().right > 0.0f)
+                }
+                else if (formattedRectangle->getBoderStyle().left == BorderStyle::Double)
+                {
+                    float top1 = borderArea.getTop();
+                    float top2 = borderArea.getTop() + borderWidth.getTop() / 3;
+                    float top4 = borderArea.getTop() + borderWidth.getTop() - borderWidth.getTop() / 3;
+                    float top5 = borderArea.getTop() + borderWidth.getTop();
+                    float lft1 = borderArea.getLeft();
+                    float lft2 = borderArea.getLeft() + borderWidth.getLeft() / 3;
+                    float lft4 = borderArea.getLeft() + borderWidth.getLeft() - borderWidth.getLeft() / 3;
+                    float lft5 = borderArea.getLeft() + borderWidth.getLeft();
+                    float rgt5 = borderArea.getRight() - borderWidth.getRight();
+                    float rgt4 = borderArea.getRight() - borderWidth.getRight() + borderWidth.getRight() / 3;
+                    float rgt2 = borderArea.getRight() - borderWidth.getRight() / 3;
+                    float rgt1 = borderArea.getRight();
+                    const std::array<Vertex, 8> vertices = { {
+                        { { lft1, top1 }, color },
+                        { { rgt1, top1 }, color },
+                        { { rgt2, top2 }, color },
+                        { { lft2, top2 }, color },
+
+                        { { lft4, top4 }, color },
+                        { { rgt4, top4 }, color },
+                        { { rgt5, top5 }, color },
+                        { { lft5, top5 }, color }
+                    } };
+                    const std::array<unsigned int, 4 * 3> indices = { {
+                        0, 1, 3,
+                        1, 2, 3,
+                        4, 5, 7,
+                        5, 6, 7
+                    } };
+                    appendVerticesAndIndices(vertices.data(), vertices.size(), indices.data(), indices.size(), batchVertices, batchIndices);
+                }
+                else if (formattedRectangle->getBoderStyle().top == BorderStyle::Groove ||
+                         formattedRectangle->getBoderStyle().top == BorderStyle::Ridge)
+                {
+                    color = formattedRectangle->getBoderStyle().left == BorderStyle::Groove ?
+                        calculateDarkerColor (formattedRectangle->getBorderColor(), formattedRectangle->getOpacity()) :
+                        calculateLighterColor(formattedRectangle->getBorderColor(), formattedRectangle->getOpacity());
+                    auto colo2 = formattedRectangle->getBoderStyle().left == BorderStyle::Groove ?
+                        calculateLighterColor(formattedRectangle->getBorderColor(), formattedRectangle->getOpacity()) :
+                        calculateDarkerColor (formattedRectangle->getBorderColor(), formattedRectangle->getOpacity());
+
+                    float top1 = borderArea.getTop();
+                    float top3 = borderArea.getTop() + borderWidth.getTop() / 2;
+                    float top5 = borderArea.getTop() + borderWidth.getTop();
+                    float lft1 = borderArea.getLeft();
+                    float lft3 = borderArea.getLeft() + borderWidth.getLeft() / 2;
+                    float lft5 = borderArea.getLeft() + borderWidth.getLeft();
+                    float rgt5 = borderArea.getRight() - borderWidth.getRight();
+                    float rgt3 = borderArea.getRight() - borderWidth.getRight() / 2;
+                    float rgt1 = borderArea.getRight();
+                    const std::array<Vertex, 8> vertices = { {
+                        { { lft1, top1 }, color },
+                        { { rgt1, top1 }, color },
+                        { { rgt3, top3 }, color },
+                        { { lft3, top3 }, color },
+
+                        { { lft3, top3 }, colo2 },
+                        { { rgt3, top3 }, colo2 },
+                        { { rgt5, top5 }, colo2 },
+                        { { lft5, top5 }, colo2 }
+                    } };
+                    const std::array<unsigned int, 4 * 3> indices = { {
+                        0, 1, 3,
+                        1, 2, 3,
+                        4, 5, 7,
+                        5, 6, 7
+                    } };
+                    appendVerticesAndIndices(vertices.data(), vertices.size(), indices.data(), indices.size(), batchVertices, batchIndices);
+                }
+                else if (formattedRectangle->getBoderStyle().top == BorderStyle::Inset ||
+                         formattedRectangle->getBoderStyle().top == BorderStyle::Outset)
+                {
+                    color = formattedRectangle->getBoderStyle().left == BorderStyle::Inset ?
+                        calculateDarkerColor (formattedRectangle->getBorderColor(), formattedRectangle->getOpacity()) :
+                        calculateLighterColor(formattedRectangle->getBorderColor(), formattedRectangle->getOpacity());
+
+                    float top1 = borderArea.getTop();
+                    float top5 = borderArea.getTop() + borderWidth.getTop();
+                    float lft1 = borderArea.getLeft();
+                    float lft5 = borderArea.getLeft() + borderWidth.getLeft();
+                    float rgt5 = borderArea.getRight() - borderWidth.getRight();
+                    float rgt1 = borderArea.getRight();
+                    const std::array<Vertex, 4> vertices = { {
+                        { { lft1, top1 }, color },
+                        { { rgt1, top1 }, color },
+                        { { rgt5, top5 }, color },
+                        { { lft5, top5 }, color }
+                    } };
+                    const std::array<unsigned int, 2 * 3> indices = { {
+                        0, 1, 3,
+                        1, 2, 3
+                    } };
+                    appendVerticesAndIndices(vertices.data(), vertices.size(), indices.data(), indices.size(), batchVertices, batchIndices);
+                }
+            }
+            if (formattedRectangle->getBoderWidth().right > 0.0f)
+            {
+                if (formattedRectangle->getBoderStyle().right == BorderStyle::Solid)
+                {
+                    const std::array<Vertex, 4> vertices = { {
+                        { { borderArea.getRight() - borderWidth.getRight(), borderArea.getTop()    }, color },
+                        { { borderArea.getRight(),                          borderArea.getTop()    }, color },
+                        { { borderArea.getRight(),                          borderArea.getBottom() }, color },
+                        { { borderArea.getRight() - borderWidth.getRight(), borderArea.getBottom() }, color }
+                    } };
+                    const std::array<unsigned int, 2 * 3> indices = { {
+                        0, 1, 3,
+                        1, 2, 3
+                    } };
+                    appendVerticesAndIndices(vertices.data(), vertices.size(), indices.data(), indices.size(), batchVertices, batchIndices);
+                }
+                else if (formattedRectangle->getBoderStyle().right == BorderStyle::Dotted ||
+                         formattedRectangle->getBoderStyle().right == BorderStyle::Dashed)
+                {
+                    auto distance = borderArea.getBottom() - borderArea.getTop();
+                    if ((formattedRectangle->getBoderStyle().right == BorderStyle::Dotted && distance > borderWidth.getRight()) ||
+                        (formattedRectangle->getBoderStyle().right == BorderStyle::Dashed && distance > borderWidth.getRight() * 3))
                     {
-                        if (formattedRectangle->getBoderStyle().right == BorderStyle::Solid)
-                        {
-                            const std::array<Vertex, 4> vertices = { {
-                                { { borderArea.getRight() - borderWidth.getRight(), borderArea.getTop()    }, color },
-                                { { borderArea.getRight(),                          borderArea.getTop()    }, color },
-                                { { borderArea.getRight(),                          borderArea.getBottom() }, color },
-                                { { borderArea.getRight() - borderWidth.getRight(), borderArea.getBottom() }, color }
-                            } };
-                            const std::array<unsigned int, 2 * 3> indices = { {
-                                0, 1, 3,
-                                1, 2, 3
-                            } };
-                            target.drawVertexArray(states, vertices.data(), vertices.size(), indices.data(), indices.size(), nullptr);
-                        }
-                        else if (formattedRectangle->getBoderStyle().right == BorderStyle::Dotted ||
-                                 formattedRectangle->getBoderStyle().right == BorderStyle::Dashed)
-                        {
-                            auto distance = borderArea.getBottom() - borderArea.getTop();
-                            if ((formattedRectangle->getBoderStyle().right == BorderStyle::Dotted && distance > borderWidth.getRight()) ||
-                                (formattedRectangle->getBoderStyle().right == BorderStyle::Dashed && distance > borderWidth.getRight() * 3))
-                            {
-                                int   numDots = 1;
-                                float stepWidth = 1.0f;
-                                float dotSize = 1.0f;
-                                calculateBorderDots(distance, borderWidth.getRight(), formattedRectangle->getBoderStyle().right == BorderStyle::Dashed, numDots, stepWidth, dotSize);
-
-                                std::vector<Vertex> vertices; vertices.resize(numDots * 4);
-                                std::vector<unsigned int> indices; indices.resize(numDots * 6);
-                                calculateDottedBorderVerticesAndIndices(numDots, stepWidth, color, true, borderArea.getRight() - borderWidth.getRight(), borderArea.getRight(),
-                                    borderArea.getTop(), borderArea.getTop() + dotSize, borderArea.getBottom() - dotSize, borderArea.getBottom(), vertices, indices);
-                                target.drawVertexArray(states, vertices.data(), vertices.size(), indices.data(), indices.size(), nullptr);
-                            }
-                        }
-                        else if (formattedRectangle->getBoderStyle().left == BorderStyle::Double)
-                        {
-                            float top1 = borderArea.getTop();
-                            float top2 = borderArea.getTop() + borderWidth.getTop() / 3;
-                            float top4 = borderArea.getTop() + borderWidth.getTop() - borderWidth.getTop() / 3;
-                            float top5 = borderArea.getTop() + borderWidth.getTop();
-                            float btm1 = borderArea.getBottom() - borderWidth.getBottom();
-                            float btm2 = borderArea.getBottom() - borderWidth.getBottom() + borderWidth.getBottom() / 3;
-                            float btm4 = borderArea.getBottom() - borderWidth.getBottom() / 3;
-                            float btm5 = borderArea.getBottom();
-                            float rgt5 = borderArea.getRight() - borderWidth.getRight();
-                            float rgt4 = borderArea.getRight() - borderWidth.getRight() + borderWidth.getRight() / 3;
-                            float rgt2 = borderArea.getRight() - borderWidth.getRight() / 3;
-                            float rgt1 = borderArea.getRight();
-                            const std::array<Vertex, 8> vertices = { {
-                                { { rgt5, top5 }, color },
-                                { { rgt4, top4 }, color },
-                                { { rgt4, btm2 }, color },
-                                { { rgt5, btm1 }, color },
-
-                                { { rgt2, top2 }, color },
-                                { { rgt1, top1 }, color },
-                                { { rgt1, btm5 }, color },
-                                { { rgt2, btm4 }, color }
-                            } };
-                            const std::array<unsigned int, 4 * 3> indices = { {
-                                0, 1, 3,
-                                1, 2, 3,
-                                4, 5, 7,
-                                5, 6, 7
-                            } };
-                            target.drawVertexArray(states, vertices.data(), vertices.size(), indices.data(), indices.size(), nullptr);
-                        }
-                        else if (formattedRectangle->getBoderStyle().right == BorderStyle::Groove ||
-                                 formattedRectangle->getBoderStyle().right == BorderStyle::Ridge)
-                        {
-                            color = formattedRectangle->getBoderStyle().left == BorderStyle::Groove ?
-                                calculateLighterColor(formattedRectangle->getBorderColor(), formattedRectangle->getOpacity()) :
-                                calculateDarkerColor (formattedRectangle->getBorderColor(), formattedRectangle->getOpacity());
-                            auto colo2 = formattedRectangle->getBoderStyle().left == BorderStyle::Groove ?
-                                calculateDarkerColor (formattedRectangle->getBorderColor(), formattedRectangle->getOpacity()) :
-                                calculateLighterColor(formattedRectangle->getBorderColor(), formattedRectangle->getOpacity());
-
-                            float top1 = borderArea.getTop();
-                            float top3 = borderArea.getTop() + borderWidth.getTop() / 2;
-                            float top5 = borderArea.getTop() + borderWidth.getTop();
-                            float btm1 = borderArea.getBottom() - borderWidth.getBottom();
-                            float btm3 = borderArea.getBottom() - borderWidth.getBottom() / 2;
-                            float btm5 = borderArea.getBottom();
-                            float rgt5 = borderArea.getRight() - borderWidth.getRight();
-                            float rgt3 = borderArea.getRight() - borderWidth.getRight() / 2;
-                            float rgt1 = borderArea.getRight();
-                            const std::array<Vertex, 8> vertices = { {
-                                { { rgt3, top3 }, color },
-                                { { rgt1, top1 }, color },
-                                { { rgt1, btm5 }, color },
-                                { { rgt3, btm3 }, color },
-
-                                { { rgt5, top5 }, colo2 },
-                                { { rgt3, top3 }, colo2 },
-                                { { rgt3, btm3 }, colo2 },
-                                { { rgt5, btm1 }, colo2 },
-                            } };
-                            const std::array<unsigned int, 4 * 3> indices = { {
-                                0, 1, 3,
-                                1, 2, 3,
-                                4, 5, 7,
-                                5, 6, 7
-                            } };
-                            target.drawVertexArray(states, vertices.data(), vertices.size(), indices.data(), indices.size(), nullptr);
-                        }
-                        else if (formattedRectangle->getBoderStyle().right == BorderStyle::Inset ||
-                                 formattedRectangle->getBoderStyle().right == BorderStyle::Outset)
-                        {
-                            color = formattedRectangle->getBoderStyle().left == BorderStyle::Inset ?
-                                calculateLighterColor(formattedRectangle->getBorderColor(), formattedRectangle->getOpacity()) :
-                                calculateDarkerColor (formattedRectangle->getBorderColor(), formattedRectangle->getOpacity());
-
-                            float top1 = borderArea.getTop();
-                            float top5 = borderArea.getTop() + borderWidth.getTop();
-                            float btm1 = borderArea.getBottom() - borderWidth.getBottom();
-                            float btm5 = borderArea.getBottom();
-                            float rgt5 = borderArea.getRight() - borderWidth.getRight();
-                            float rgt1 = borderArea.getRight();
-                            const std::array<Vertex, 4> vertices = { {
-                                { { rgt5, top5 }, color },
-                                { { rgt1, top1 }, color },
-                                { { rgt1, btm5 }, color },
-                                { { rgt5, btm1 }, color }
-                            } };
-                            const std::array<unsigned int, 2 * 3> indices = { {
-                                0, 1, 3,
-                                1, 2, 3
-                            } };
-                            target.drawVertexArray(states, vertices.data(), vertices.size(), indices.data(), indices.size(), nullptr);
-                        }
+                        int   numDots = 1;
+                        float stepWidth = 1.0f;
+                        float dotSize = 1.0f;
+                        calculateBorderDots(distance, borderWidth.getRight(), formattedRectangle->getBoderStyle().right == BorderStyle::Dashed, numDots, stepWidth, dotSize);
+
+                        calculateDottedBorderVerticesAndIndices(numDots, stepWidth, color, true, borderArea.getRight() - borderWidth.getRight(), borderArea.getRight(),
+                            borderArea.getTop(), borderArea.getTop() + dotSize, borderArea.getBottom() - dotSize, borderArea.getBottom(), batchVertices, batchIndices);
                     }
-                    if (formattedRectangle->getBoderWidth().bottom > 0.0f)
+                }
+                else if (formattedRectangle->getBoderStyle().left == BorderStyle::Double)
+                {
+                    float top1 = borderArea.getTop();
+                    float top2 = borderArea.getTop() + borderWidth.getTop() / 3;
+                    float top4 = borderArea.getTop() + borderWidth.getTop() - borderWidth.getTop() / 3;
+                    float top5 = borderArea.getTop() + borderWidth.getTop();
+                    float btm1 = borderArea.getBottom() - borderWidth.getBottom();
+                    float btm2 = borderArea.getBottom() - borderWidth.getBottom() + borderWidth.getBottom() / 3;
+                    float btm4 = borderArea.getBottom() - borderWidth.getBottom() / 3;
+                    float btm5 = borderArea.getBottom();
+                    float rgt5 = borderArea.getRight() - borderWidth.getRight();
+                    float rgt4 = borderArea.getRight() - borderWidth.getRight() + borderWidth.getRight() / 3;
+                    float rgt2 = borderArea.getRight() - borderWidth.getRight() / 3;
+                    float rgt1 = borderArea.getRight();
+                    const std::array<Vertex, 8> vertices = { {
+                        { { rgt5, top5 }, color },
+                        { { rgt4, top4 }, color },
+                        { { rgt4, btm2 }, color },
+                        { { rgt5, btm1 }, color },
+
+                        { { rgt2, top2 }, color },
+                        { { rgt1, top1 }, color },
+                        { { rgt1, btm5 }, color },
+                        { { rgt2, btm4 }, color }
+                    } };
+                    const std::array<unsigned int, 4 * 3> indices = { {
+                        0, 1, 3,
+                        1, 2, 3,
+                        4, 5, 7,
+                        5, 6, 7
+                    } };
+                    appendVerticesAndIndices(vertices.data(), vertices.size(), indices.data(), indices.size(), batchVertices, batchIndices);
+                }
+                else if (formattedRectangle->getBoderStyle().right == BorderStyle::Groove ||
+                         formattedRectangle->getBoderStyle().right == BorderStyle::Ridge)
+                {
+                    color = formattedRectangle->getBoderStyle().left == BorderStyle::Groove ?
+                        calculateLighterColor(formattedRectangle->getBorderColor(), formattedRectangle->getOpacity()) :
+                        calculateDarkerColor (formattedRectangle->getBorderColor(), formattedRectangle->getOpacity());
+                    auto colo2 = formattedRectangle->getBoderStyle().left == BorderStyle::Groove ?
+                        calculateDarkerColor (formattedRectangle->getBorderColor(), formattedRectangle->getOpacity()) :
+                        calculateLighterColor(formattedRectangle->getBorderColor(), formattedRectangle->getOpacity());
+
+                    float top1 = borderArea.getTop();
+                    float top3 = borderArea.getTop() + borderWidth.getTop() / 2;
+                    float top5 = borderArea.getTop() + borderWidth.getTop();
+                    float btm1 = borderArea.getBottom() - borderWidth.getBottom();
+                    float btm3 = borderArea.getBottom() - borderWidth.getBottom() / 2;
+                    float btm5 = borderArea.getBottom();
+                    float rgt5 = borderArea.getRight() - borderWidth.getRight();
+                    float rgt3 = borderArea.getRight() - borderWidth.getRight() / 2;
+                    float rgt1 = borderArea.getRight();
+                    const std::array<Vertex, 8> vertices = { {
+                        { { rgt3, top3 }, color },
+                        { { rgt1, top1 }, color },
+                        { { rgt1, btm5 }, color },
+                        { { rgt3, btm3 }, color },
+
+                        { { rgt5, top5 }, colo2 },
+                        { { rgt3, top3 }, colo2 },
+                        { { rgt3, btm3 }, colo2 },
+                        { { rgt5, btm1 }, colo2 },
+                    } };
+                    const std::array<unsigned int, 4 * 3> indices = { {
+                        0, 1, 3,
+                        1, 2, 3,
+                        4, 5, 7,
+                        5, 6, 7
+                    } };
+                    appendVerticesAndIndices(vertices.data(), vertices.size(), indices.data(), indices.size(), batchVertices, batchIndices);
+                }
+                else if (formattedRectangle->getBoderStyle().right == BorderStyle::Inset ||
+                         formattedRectangle->getBoderStyle().right == BorderStyle::Outset)
+                {
+                    color = formattedRectangle->getBoderStyle().left == BorderStyle::Inset ?
+                        calculateLighterColor(formattedRectangle->getBorderColor(), formattedRectangle->getOpacity()) :
+                        calculateDarkerColor (formattedRectangle->getBorderColor(), formattedRectangle->getOpacity());
+
+                    float top1 = borderArea.getTop();
+                    float top5 = borderArea.getTop() + borderWidth.getTop();
+                    float btm1 = borderArea.getBottom() - borderWidth.getBottom();
+                    float btm5 = borderArea.getBottom();
+                    float rgt5 = borderArea.getRight() - borderWidth.getRight();
+                    float rgt1 = borderArea.getRight();
+                    const std::array<Vertex, 4> vertices = { {
+                        { { rgt5, top5 }, color },
+                        { { rgt1, top1 }, color },
+                        { { rgt1, btm5 }, color },
+                        { { rgt5, btm1 }, color }
+                    } };
+                    const std::array<unsigned int, 2 * 3> indices = { {
+                        0, 1, 3,
+                        1, 2, 3
+                    } };
+                    appendVerticesAndIndices(vertices.data(), vertices.size(), indices.data(), indices.size(), batchVertices, batchIndices);
+                }
+            }
+            if (formattedRectangle->getBoderWidth().bottom > 0.0f)
+            {
+                if (formattedRectangle->getBoderStyle().bottom == BorderStyle::Solid)
+                {
+                    const std::array<Vertex, 4> vertices = { {
+                        { { borderArea.getLeft(),  borderArea.getBottom() - borderWidth.getBottom() }, color },
+                        { { borderArea.getRight(), borderArea.getBottom() - borderWidth.getBottom() }, color },
+                        { { borderArea.getRight(), borderArea.getBottom()                           }, color },
+                        { { borderArea.getLeft(),  borderArea.getBottom()                           }, color }
+                    } };
+                    const std::array<unsigned int, 2 * 3> indices = { {
+                        0, 1, 3,
+                        1, 2, 3
+                    } };
+                    appendVerticesAndIndices(vertices.data(), vertices.size(), indices.data(), indices.size(), batchVertices, batchIndices);
+                }
+                else if (formattedRectangle->getBoderStyle().bottom == BorderStyle::Dotted ||
+                         formattedRectangle->getBoderStyle().bottom == BorderStyle::Dashed)
+                {
+                    auto distance = borderArea.getRight() - borderArea.getLeft();
+                    if ((formattedRectangle->getBoderStyle().bottom == BorderStyle::Dotted && distance > borderWidth.getBottom()) ||
+                        (formattedRectangle->getBoderStyle().bottom == BorderStyle::Dashed && distance > borderWidth.getBottom() * 3))
                     {
-                        if (formattedRectangle->getBoderStyle().bottom == BorderStyle::Solid)
-                        {
-                            const std::array<Vertex, 4> vertices = { {
-                                { { borderArea.getLeft(),  borderArea.getBottom() - borderWidth.getBottom() }, color },
-                                { { borderArea.getRight(), borderArea.getBottom() - borderWidth.getBottom() }, color },
-                                { { borderArea.getRight(), borderArea.getBottom()                           }, color },
-                                { { borderArea.getLeft(),  borderArea.getBottom()                           }, color }
-                            } };
-                            const std::array<unsigned int, 2 * 3> indices = { {
-                                0, 1, 3,
-                                1, 2, 3
-                            } };
-                            target.drawVertexArray(states, vertices.data(), vertices.size(), indices.data(), indices.size(), nullptr);
-                        }
-                        else if (formattedRectangle->getBoderStyle().bottom == BorderStyle::Dotted ||
-                                 formattedRectangle->getBoderStyle().bottom == BorderStyle::Dashed)
-                        {
-                            auto distance = borderArea.getRight() - borderArea.getLeft();
-                            if ((formattedRectangle->getBoderStyle().bottom == BorderStyle::Dotted && distance > borderWidth.getBottom()) ||
-                                (formattedRectangle->getBoderStyle().bottom == BorderStyle::Dashed && distance > borderWidth.getBottom() * 3))
-                            {
-                                int   numDots = 1;
-                                float stepWidth = 1.0f;
-                                float dotSize = 1.0f;
-                                calculateBorderDots(distance, borderWidth.getBottom(), formattedRectangle->getBoderStyle().bottom == BorderStyle::Dashed, numDots, stepWidth, dotSize);
-
-                                std::vector<Vertex> vertices; vertices.resize(numDots * 4);
-                                std::vector<unsigned int> indices; indices.resize(numDots * 6);
-                                calculateDottedBorderVerticesAndIndices(numDots, stepWidth, color, false, borderArea.getLeft(), borderArea.getLeft() + dotSize,
-                                    borderArea.getBottom() - borderWidth.getBottom(), borderArea.getBottom(), borderArea.getRight() - dotSize, borderArea.getRight(), vertices, indices);
-                                target.drawVertexArray(states, vertices.data(), vertices.size(), indices.data(), indices.size(), nullptr);
-                            }
-                        }
-                        else if (formattedRectangle->getBoderStyle().left == BorderStyle::Double)
-                        {
-                            float btm1 = borderArea.getBottom() - borderWidth.getBottom();
-                            float btm2 = borderArea.getBottom() - borderWidth.getBottom() + borderWidth.getBottom() / 3;
-                            float btm4 = borderArea.getBottom() - borderWidth.getBottom() / 3;
-                            float btm5 = borderArea.getBottom();
-                            float lft1 = borderArea.getLeft();
-                            float lft2 = borderArea.getLeft() + borderWidth.getLeft() / 3;
-                            float lft4 = borderArea.getLeft() + borderWidth.getLeft() - borderWidth.getLeft() / 3;
-                            float lft5 = borderArea.getLeft() + borderWidth.getLeft();
-                            float rgt5 = borderArea.getRight() - borderWidth.getRight();
-                            float rgt4 = borderArea.getRight() - borderWidth.getRight() + borderWidth.getRight() / 3;
-                            float rgt2 = borderArea.getRight() - borderWidth.getRight() / 3;
-                            float rgt1 = borderArea.getRight();
-                            const std::array<Vertex, 8> vertices = { {
-                                { { lft1, btm5 }, color },
-                                { { rgt1, btm5 }, color },
-                                { { rgt2, btm4 }, color },
-                                { { lft2, btm4 }, color },
-
-                                { { lft4, btm2 }, color },
-                                { { rgt4, btm2 }, color },
-                                { { rgt5, btm1 }, color },
-                                { { lft5, btm1 }, color }
-                            } };
-                            const std::array<unsigned int, 4 * 3> indices = { {
-                                0, 1, 3,
-                                1, 2, 3,
-                                4, 5, 7,
-                                5, 6, 7
-                            } };
-                            target.drawVertexArray(states, vertices.data(), vertices.size(), indices.data(), indices.size(), nullptr);
-                        }
-                        else if (formattedRectangle->getBoderStyle().bottom == BorderStyle::Groove ||
-                                 formattedRectangle->getBoderStyle().bottom == BorderStyle::Ridge)
-                        {
-                            color = formattedRectangle->getBoderStyle().left == BorderStyle::Groove ?
-                                calculateLighterColor(formattedRectangle->getBorderColor(), formattedRectangle->getOpacity()) :
-                                calculateDarkerColor (formattedRectangle->getBorderColor(), formattedRectangle->getOpacity());
-                            auto colo2 = formattedRectangle->getBoderStyle().left == BorderStyle::Groove ?
-                                calculateDarkerColor (formattedRectangle->getBorderColor(), formattedRectangle->getOpacity()) :
-                                calculateLighterColor(formattedRectangle->getBorderColor(), formattedRectangle->getOpacity());
-
-                            float btm1 = borderArea.getBottom() - borderWidth.getBottom();
-                            float btm3 = borderArea.getBottom() - borderWidth.getBottom() / 2;
-                            float btm5 = borderArea.getBottom();
-                            float lft1 = borderArea.getLeft();
-                            float lft3 = borderArea.getLeft() + borderWidth.getLeft() / 2;
-                            float lft5 = borderArea.getLeft() + borderWidth.getLeft();
-                            float rgt5 = borderArea.getRight() - borderWidth.getRight();
-                            float rgt3 = borderArea.getRight() - borderWidth.getRight() / 2;
-                            float rgt1 = borderArea.getRight();
-                            const std::array<Vertex, 8> vertices = { {
-                                { { lft3, btm3 }, color },
-                                { { rgt3, btm3 }, color },
-                                { { rgt1, btm5 }, color },
-                                { { lft1, btm5 }, color },
-
-                                { { lft5, btm1 }, colo2 },
-                                { { rgt5, btm1 }, colo2 },
-                                { { rgt3, btm3 }, colo2 },
-                                { { lft3, btm3 }, colo2 },
-                            } };
-                            const std::array<unsigned int, 4 * 3> indices = { {
-                                0, 1, 3,
-                                1, 2, 3,
-                                4, 5, 7,
-                                5, 6, 7
-                            } };
-                            target.drawVertexArray(states, vertices.data(), vertices.size(), indices.data(), indices.size(), nullptr);
-                        }
-                        else if (formattedRectangle->getBoderStyle().bottom == BorderStyle::Inset ||
-                                 formattedRectangle->getBoderStyle().bottom == BorderStyle::Outset)
-                        {
-                            color = formattedRectangle->getBoderStyle().left == BorderStyle::Inset ?
-                                calculateLighterColor(formattedRectangle->getBorderColor(), formattedRectangle->getOpacity()) :
-                                calculateDarkerColor (formattedRectangle->getBorderColor(), formattedRectangle->getOpacity());
-
-                            float btm1 = borderArea.getBottom() - borderWidth.getBottom();
-                            float btm5 = borderArea.getBottom();
-                            float lft1 = borderArea.getLeft();
-                            float lft5 = borderArea.getLeft() + borderWidth.getLeft();
-                            float rgt5 = borderArea.getRight() - borderWidth.getRight();
-                            float rgt1 = borderArea.getRight();
-                            const std::array<Vertex, 4> vertices = { {
-                                { { lft5, btm1 }, color },
-                                { { rgt5, btm1 }, color },
-                                { { rgt1, btm5 }, color },
-                                { { lft1, btm5 }, color }
-                            } };
-                            const std::array<unsigned int, 2 * 3> indices = { {
-                                0, 1, 3,
-                                1, 2, 3
-                            } };
-                            target.drawVertexArray(states, vertices.data(), vertices.size(), indices.data(), indices.size(), nullptr);
-                        }
+                        int   numDots = 1;
+                        float stepWidth = 1.0f;
+                        float dotSize = 1.0f;
+                        calculateBorderDots(distance, borderWidth.getBottom(), formattedRectangle->getBoderStyle().bottom == BorderStyle::Dashed, numDots, stepWidth, dotSize);
+
+                        calculateDottedBorderVerticesAndIndices(numDots, stepWidth, color, false, borderArea.getLeft(), borderArea.getLeft() + dotSize,
+                            borderArea.getBottom() - borderWidth.getBottom(), borderArea.getBottom(), borderArea.getRight() - dotSize, borderArea.getRight(), batchVertices, batchIndices);
                     }
                 }
+                else if (formattedRectangle->getBoderStyle().left == BorderStyle::Double)
+                {
+                    float btm1 = borderArea.getBottom() - borderWidth.getBottom();
+                    float btm2 = borderArea.getBottom() - borderWidth.getBottom() + borderWidth.getBottom() / 3;
+                    float btm4 = borderArea.getBottom() - borderWidth.getBottom() / 3;
+                    float btm5 = borderArea.getBottom();
+                    float lft1 = borderArea.getLeft();
+                    float lft2 = borderArea.getLeft() + borderWidth.getLeft() / 3;
+                    float lft4 = borderArea.getLeft() + borderWidth.getLeft() - borderWidth.getLeft() / 3;
+                    float lft5 = borderArea.getLeft() + borderWidth.getLeft();
+                    float rgt5 = borderArea.getRight() - borderWidth.getRight();
+                    float rgt4 = borderArea.getRight() - borderWidth.getRight() + borderWidth.getRight() / 3;
+                    float rgt2 = borderArea.getRight() - borderWidth.getRight() / 3;
+                    float rgt1 = borderArea.getRight();
+                    const std::array<Vertex, 8> vertices = { {
+                        { { lft1, btm5 }, color },
+                        { { rgt1, btm5 }, color },
+                        { { rgt2, btm4 }, color },
+                        { { lft2, btm4 }, color },
+
+                        { { lft4, btm2 }, color },
+                        { { rgt4, btm2 }, color },
+                        { { rgt5, btm1 }, color },
+                        { { lft5, btm1 }, color }
+                    } };
+                    const std::array<unsigned int, 4 * 3> indices = { {
+                        0, 1, 3,
+                        1, 2, 3,
+                        4, 5, 7,
+                        5, 6, 7
+                    } };
+                    appendVerticesAndIndices(vertices.data(), vertices.size(), indices.data(), indices.size(), batchVertices, batchIndices);
+                }
+                else if (formattedRectangle->getBoderStyle().bottom == BorderStyle::Groove ||
+                         formattedRectangle->getBoderStyle().bottom == BorderStyle::Ridge)
+                {
+                    color = formattedRectangle->getBoderStyle().left == BorderStyle::Groove ?
+                        calculateLighterColor(formattedRectangle->getBorderColor(), formattedRectangle->getOpacity()) :
+                        calculateDarkerColor (formattedRectangle->getBorderColor(), formattedRectangle->getOpacity());
+                    auto colo2 = formattedRectangle->getBoderStyle().left == BorderStyle::Groove ?
+                        calculateDarkerColor (formattedRectangle->getBorderColor(), formattedRectangle->getOpacity()) :
+                        calculateLighterColor(formattedRectangle->getBorderColor(), formattedRectangle->getOpacity());
+
+                    float btm1 = borderArea.getBottom() - borderWidth.getBottom();
+                    float btm3 = borderArea.getBottom() - borderWidth.getBottom() / 2;
+                    float btm5 = borderArea.getBottom();
+                    float lft1 = borderArea.getLeft();
+                    float lft3 = borderArea.getLeft() + borderWidth.getLeft() / 2;
+                    float lft5 = borderArea.getLeft() + borderWidth.getLeft();
+                    float rgt5 = borderArea.getRight() - borderWidth.getRight();
+                    float rgt3 = borderArea.getRight() - borderWidth.getRight() / 2;
+                    float rgt1 = borderArea.getRight();
+                    const std::array<Vertex, 8> vertices = { {
+                        { { lft3, btm3 }, color },
+                        { { rgt3, btm3 }, color },
+                        { { rgt1, btm5 }, color },
+                        { { lft1, btm5 }, color },
+
+                        { { lft5, btm1 }, colo2 },
+                        { { rgt5, btm1 }, colo2 },
+                        { { rgt3, btm3 }, colo2 },
+                        { { lft3, btm3 }, colo2 },
+                    } };
+                    const std::array<unsigned int, 4 * 3> indices = { {
+                        0, 1, 3,
+                        1, 2, 3,
+                        4, 5, 7,
+                        5, 6, 7
+                    } };
+                    appendVerticesAndIndices(vertices.data(), vertices.size(), indices.data(), indices.size(), batchVertices, batchIndices);
+                }
+                else if (formattedRectangle->getBoderStyle().bottom == BorderStyle::Inset ||
+                         formattedRectangle->getBoderStyle().bottom == BorderStyle::Outset)
+                {
+                    color = formattedRectangle->getBoderStyle().left == BorderStyle::Inset ?
+                        calculateLighterColor(formattedRectangle->getBorderColor(), formattedRectangle->getOpacity()) :
+                        calculateDarkerColor (formattedRectangle->getBorderColor(), formattedRectangle->getOpacity());
+
+                    float btm1 = borderArea.getBottom() - borderWidth.getBottom();
+                    float btm5 = borderArea.getBottom();
+                    float lft1 = borderArea.getLeft();
+                    float lft5 = borderArea.getLeft() + borderWidth.getLeft();
+                    float rgt5 = borderArea.getRight() - borderWidth.getRight();
+                    float rgt1 = borderArea.getRight();
+                    const std::array<Vertex, 4> vertices = { {
+                        { { lft5, btm1 }, color },
+                        { { rgt5, btm1 }, color },
+                        { { rgt1, btm5 }, color },
+                        { { lft1, btm5 }, color }
+                    } };
+                    const std::array<unsigned int, 2 * 3> indices = { {
+                        0, 1, 3,
+                        1, 2, 3
+                    } };
+                    appendVerticesAndIndices(vertices.data(), vertices.size(), indices.data(), indices.size(), batchVertices, batchIndices);
+                }
             }
         }
+    }
 
-        target.removeClippingLayer();
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        // Draw the scrollbars if needed
-        if (m_verticalScrollbar->isShown())
-            m_verticalScrollbar->draw(target, statesForScrollbar);
+    void FormattedTextView::appendVerticesAndIndices(const tgui::Vertex* vertices, size_t vertexCount, const unsigned int* indices, size_t indexCount,
+        std::vector<tgui::Vertex>& batchVertices, std::vector<unsigned int>& batchIndices)
+    {
+        // Fully transparent geometry - like the default background color #FFFFFF00 - is not worth a single triangle.
+        if (std::none_of(vertices, vertices + vertexCount, [](const Vertex& vertex) { return vertex.color.alpha > 0; }))
+            return;
 
-        if (m_horizontalScrollbar->isShown())
-            m_horizontalScrollbar->draw(target, statesForScrollbar);
-   }
+        const auto firstVertex = static_cast<unsigned int>(batchVertices.size());
+        batchVertices.insert(batchVertices.end(), vertices, vertices + vertexCount);
+        for (size_t index = 0; index < indexCount; index++)
+            batchIndices.push_back(firstVertex + indices[index]);
+    }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -1280,51 +1547,58 @@ namespace tgui  { namespace xhtml
     void FormattedTextView::calculateDottedBorderVerticesAndIndices(int numDots, float stepWidth, tgui::Vertex::Color color, bool vertical,
         float xLO, float xHI, float yLO, float yHI, float tLO, float tHI, std::vector<tgui::Vertex>& vertices, std::vector<unsigned int>& indices)
     {
+        // Transparent dots/dashes are not worth a single triangle.
+        if (color.alpha == 0)
+            return;
+
+        const auto firstVertex = static_cast<unsigned int>(vertices.size());
+        vertices.resize(vertices.size() + numDots * 4);
+        indices.reserve(indices.size() + numDots * 6);
         for (auto cntDots = 0; cntDots < numDots; cntDots++)
         {
             if (vertical)
             {
                 if (cntDots < numDots - 1)
                 {
-                    vertices[cntDots * 4]     = { { xLO, yLO + stepWidth * cntDots }, color };
-                    vertices[cntDots * 4 + 1] = { { xHI, yLO + stepWidth * cntDots }, color };
-                    vertices[cntDots * 4 + 2] = { { xHI, yHI + stepWidth * cntDots }, color };
-                    vertices[cntDots * 4 + 3] = { { xLO, yHI + stepWidth * cntDots }, color };
+                    vertices[firstVertex + cntDots * 4]     = { { xLO, yLO + stepWidth * cntDots }, color };
+                    vertices[firstVertex + cntDots * 4 + 1] = { { xHI, yLO + stepWidth * cntDots }, color };
+                    vertices[firstVertex + cntDots * 4 + 2] = { { xHI, yHI + stepWidth * cntDots }, color };
+                    vertices[firstVertex + cntDots * 4 + 3] = { { xLO, yHI + stepWidth * cntDots }, color };
                 }
                 else
                 {
-                    vertices[cntDots * 4]     = { { xLO, tLO }, color };
-                    vertices[cntDots * 4 + 1] = { { xHI, tLO }, color };
-                    vertices[cntDots * 4 + 2] = { { xHI, tHI }, color };
-                    vertices[cntDots * 4 + 3] = { { xLO, tHI }, color };
+                    vertices[firstVertex + cntDots * 4]     = { { xLO, tLO }, color };
+                    vertices[firstVertex + cntDots * 4 + 1] = { { xHI, tLO }, color };
+                    vertices[firstVertex + cntDots * 4 + 2] = { { xHI, tHI }, color };
+                    vertices[firstVertex + cntDots * 4 + 3] = { { xLO, tHI }, color };
                 }
             }
             else
             {
                 if (cntDots < numDots - 1)
                 {
-                    vertices[cntDots * 4]     = { { xLO + stepWidth * cntDots, yLO }, color };
-                    vertices[cntDots * 4 + 1] = { { xHI + stepWidth * cntDots, yLO }, color };
-                    vertices[cntDots * 4 + 2] = { { xHI + stepWidth * cntDots, yHI }, color };
-                    vertices[cntDots * 4 + 3] = { { xLO + stepWidth * cntDots, yHI }, color };
+                    vertices[firstVertex + cntDots * 4]     = { { xLO + stepWidth * cntDots, yLO }, color };
+                    vertices[firstVertex + cntDots * 4 + 1] = { { xHI + stepWidth * cntDots, yLO }, color };
+                    vertices[firstVertex + cntDots * 4 + 2] = { { xHI + stepWidth * cntDots, yHI }, color };
+                    vertices[firstVertex + cntDots * 4 + 3] = { { xLO + stepWidth * cntDots, yHI }, color };
                 }
                 else
                 {
-                    vertices[cntDots * 4]     = { { tLO, yLO }, color };
-                    vertices[cntDots * 4 + 1] = { { tHI, yLO }, color };
-                    vertices[cntDots * 4 + 2] = { { tHI, yHI }, color };
-                    vertices[cntDots * 4 + 3] = { { tLO, yHI }, color };
+                    vertices[firstVertex + cntDots * 4]     = { { tLO, yLO }, color };
+                    vertices[firstVertex + cntDots * 4 + 1] = { { tHI, yLO }, color };
+                    vertices[firstVertex + cntDots * 4 + 2] = { { tHI, yHI }, color };
+                    vertices[firstVertex + cntDots * 4 + 3] = { { tLO, yHI }, color };
                 }
             }
         }
         for (auto cntDots = 0; cntDots < numDots; cntDots++)
         {
-            indices[cntDots * 6]     = cntDots * 4 + 0;
-            indices[cntDots * 6 + 1] = cntDots * 4 + 1;
-            indices[cntDots * 6 + 2] = cntDots * 4 + 2;
-            indices[cntDots * 6 + 3] = cntDots * 4 + 0;
-            indices[cntDots * 6 + 4] = cntDots * 4 + 2;
-            indices[cntDots * 6 + 5] = cntDots * 4 + 3;
+            indices.push_back(firstVertex + cntDots * 4 + 0);
+            indices.push_back(firstVertex + cntDots * 4 + 1);
+            indices.push_back(firstVertex + cntDots * 4 + 2);
+            indices.push_back(firstVertex + cntDots * 4 + 0);
+            indices.push_back(firstVertex + cntDots * 4 + 2);
+            indices.push_back(firstVertex + cntDots * 4 + 3);
         }
     }
 
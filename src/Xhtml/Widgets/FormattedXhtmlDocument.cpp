@@ -1,7 +1,12 @@
+#include <algorithm>
 #include <iostream>
 #include <fstream>
 #include <list>
 #include <map>
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <thread>
 #include <cstdint>
 
 #include <TGUI/Config.hpp>
@@ -20,17 +25,160 @@
 #include "TGUI/Xhtml/Widgets/FormattedXhtmlDocument.hpp"
 #include "TGUI/Xhtml/Dom/XhtmlParser.hpp"
 #include "TGUI/Xhtml/UtfHelper.hpp"
+#include "TGUI/Xhtml/MappedFile.hpp"
 
 namespace tgui  { namespace xhtml
 {
+    namespace
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Parses an UTF-8 encoded XHTML byte string into the indicated result
+        ///
+        /// @param hypertextUtf8    The UTF-8 encoded XHTML byte string to parse into an XHTML DOM
+        /// @param resolveEntities  Determine whether to resolve entities
+        /// @param trace            Determine whether to trace the result (element tree) to std::cout
+        /// @param result           [IN/OUT] The result to complete with the XHTML DOM root elements, diagnostics and state -
+        ///                         the diagnostics mode of the result is applied to the parser
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void parseIntoResult(tgui::CharStringView hypertextUtf8, bool resolveEntities, bool trace, XhtmlDocumentParseResult& result)
+        {
+            XhtmlParser xhtmlParser(hypertextUtf8);
+            xhtmlParser.setDiagnosticsMode(result.Diagnostics.getMode());
+            xhtmlParser.parseDocument(resolveEntities, trace);
+
+            result.RootElements = xhtmlParser.getRootElements();
+            result.Diagnostics = xhtmlParser.getDiagnostics();
+
+            if (result.RootElements.size() == 0)
+                result.State = -2;
+            else if (std::dynamic_pointer_cast<XhtmlContainerElement>(XhtmlElement::getFirstElement(result.RootElements, "html")) == nullptr)
+                result.State = -3;
+            else
+                result.State = 0;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Reads an XHTML file (memory mapped if possible) and parses it into the indicated result
+        ///
+        /// @param filePath         The XHTML file to read and parse into an XHTML DOM
+        /// @param resolveEntities  Determine whether to resolve entities
+        /// @param trace            Determine whether to trace the result (element tree) to std::cout
+        /// @param result           [IN/OUT] The result to fill with the XHTML DOM root elements, diagnostics and state - the
+        ///                         diagnostics mode of the result is applied to the parser
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void loadIntoResult(const std::string& filePath, bool resolveEntities, bool trace, XhtmlDocumentParseResult& result)
+        {
+            std::string  errorMessage;
+            String fileEncoding;
+
+            // Prefer the memory mapped file, the parser reads the mapped pages directly (without any intermediate copy).
+            // Fall back to the stream based file reading, if memory mapping is not supported or fails.
+            MappedFile mappedFile;
+            std::string hypertextBuffer;
+            tgui::CharStringView hypertextUtf8;
+            if (mappedFile.open(filePath, errorMessage))
+            {
+                hypertextUtf8 = tgui::CharStringView(mappedFile.getData(), mappedFile.getSize());
+                if (!FormattedXhtmlDocument::detectXhtmlDocumentEncoding(hypertextUtf8, fileEncoding, errorMessage))
+                    hypertextUtf8 = tgui::CharStringView();
+            }
+            else
+            {
+                hypertextBuffer = FormattedXhtmlDocument::readXhtmlDocumentUtf8(filePath, fileEncoding, errorMessage);
+                hypertextUtf8 = hypertextBuffer;
+            }
+
+            if (hypertextUtf8.size() == 0)
+            {
+                result.State = -1;
+                result.Diagnostics.report(XhtmlDiagnosticCode::DocumentNotReadable, errorMessage.c_str());
+            }
+            else
+                parseIntoResult(hypertextUtf8, resolveEntities, trace, result);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Runs the indicated task for every index of a task range on a pool of worker threads
+        ///
+        /// The calling thread participates as a worker. The first exception thrown by a task is rethrown after all workers
+        /// have finished.
+        ///
+        /// @param taskCount    The number of tasks, the task indices are 0 ... taskCount - 1
+        /// @param threadCount  The maximum number of worker threads, or 0 to use the number of hardware threads
+        /// @param task         The task to run for one task index
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void runOnWorkerThreads(size_t taskCount, unsigned int threadCount, const std::function<void(size_t)>& task)
+        {
+            if (threadCount == 0)
+                threadCount = std::max(1u, std::thread::hardware_concurrency());
+            const size_t workerCount = std::min(static_cast<size_t>(threadCount), taskCount);
+
+            std::atomic<size_t> nextTaskIndex(0);
+            std::exception_ptr  firstException;
+            std::mutex          firstExceptionMutex;
+            auto work = [&]()
+                {
+                    for (size_t taskIndex = nextTaskIndex++; taskIndex < taskCount; taskIndex = nextTaskIndex++)
+                    {
+                        try
+                        {
+                            task(taskIndex);
+                        }
+                        catch (...)
+                        {
+                            std::lock_guard<std::mutex> lock(firstExceptionMutex);
+                            if (!firstException)
+                                firstException = std::current_exception();
+                        }
+                    }
+                };
+
+            std::vector<std::thread> workers;
+            for (size_t workerIndex = 1; workerIndex < workerCount; workerIndex++)
+            {
+                try
+                {
+                    workers.emplace_back(work);
+                }
+                catch (const std::system_error&)
+                {
+                    break; // continue with the workers, that could be started
+                }
+            }
+            work();
+            for (auto& worker : workers)
+                worker.join();
+
+            if (firstException)
+                std::rethrow_exception(firstException);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Calls the function for the global style entries (in cascade order) and for the local style entry (if any) last
+        ///
+        /// @param styleEntries     The global style entries, matching the element
+        /// @param localStyleEntry  The local style entry of the element ('style' attribute). Can be nullptr
+        /// @param function         The function to call for every style entry
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <typename Function>
+        void forEachStyleEntry(const std::vector<XhtmlStyleEntry::Ptr>& styleEntries, const XhtmlStyleEntry::Ptr& localStyleEntry,
+                               Function function)
+        {
+            for (const XhtmlStyleEntry::Ptr& styleEntry : styleEntries)
+                function(styleEntry);
+            if (localStyleEntry != nullptr)
+                function(localStyleEntry);
+        }
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     FormattedXhtmlDocument::FormattedXhtmlDocument()
-        : FormattedDocument(), m_textures(), m_content(), m_rootElement(), m_errorNotifyDlgParent(),
+        : FormattedDocument(), m_textures(), m_content(), m_rootElement(), m_errorNotifyDlgParent(), m_errorMessageBox(),
           m_defaultTextSize(14.0f), m_defaultForeColor(Color(0, 0, 0)), m_defaultOpacity(1), m_defaultFont(nullptr),
           m_availableClientSize(0.0f, 0.0f), m_occupiedLayoutSize(0.0f, 0.0f), m_evolvingLayoutArea(0.0f, 0.0f, 0.0f, 0.0f),
           m_evolvingLineExtraHeight(0.0f), m_evolvingLineRunLength(0.0f), m_preformattedTextFlagCnt(0), m_formattingState(Color(0, 0, 0)),
-          m_listPadding(30), m_backPadding(4)
+          m_listPadding(30), m_backPadding(4), m_textRunMetrics(), m_layoutPass(0)
     {
         m_rootElement = XhtmlElement::createHtml(nullptr);
     }
@@ -76,37 +224,22 @@ namespace tgui  { namespace xhtml
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    std::vector<XhtmlStyleEntry::Ptr> FormattedXhtmlDocument::getApplicableStyleElements(XhtmlElement::Ptr xhtmlElement)
+    const std::vector<XhtmlStyleEntry::Ptr>& FormattedXhtmlDocument::getApplicableStyleElements(XhtmlElement::Ptr xhtmlElement)
     {
-        std::vector<XhtmlStyleEntry::Ptr> styleEntries;
+        static const std::vector<XhtmlStyleEntry::Ptr> noStyleEntries;
+
         auto styleElement = getStyleElement();
         if (styleElement)
-        {
-            auto classNames = StringEx::split(xhtmlElement->getClassNames(), U' ', true);
-            for (String& className : classNames)
-            {
-                auto globalStyleEntry = styleElement->getEntry(xhtmlElement->getTypeName(), className);
-                if (globalStyleEntry)
-                    styleEntries.push_back(globalStyleEntry);
-            }
-        }
-        auto xhtmlStyleableElement = std::dynamic_pointer_cast<XhtmlStyleableInterface>(xhtmlElement);
-        if (xhtmlStyleableElement)
-        {
-            auto localStyleEntry = xhtmlStyleableElement->getStyleEntry();
-            if (localStyleEntry)
-                styleEntries.push_back(localStyleEntry);
-        }
-
-        return styleEntries;
+            return styleElement->getMatchingEntries(*xhtmlElement);
+        return noStyleEntries;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void FormattedXhtmlDocument::applyStyleEntriesToFormattingState(std::vector<XhtmlStyleEntry::Ptr> styleEntries,
-        const FormattedDocument::FontCollection& fontCollection, StyleCategoryFlags categories)
+    void FormattedXhtmlDocument::applyStyleEntriesToFormattingState(const std::vector<XhtmlStyleEntry::Ptr>& styleEntries,
+        const XhtmlStyleEntry::Ptr& localStyleEntry, const FormattedDocument::FontCollection& fontCollection, StyleCategoryFlags categories)
     {
-        for (auto styleEntry : styleEntries)
+        forEachStyleEntry(styleEntries, localStyleEntry, [this, &fontCollection, categories](const XhtmlStyleEntry::Ptr& styleEntry)
         {
             auto styleEntryFlags = styleEntry->getStyleEntryFlags();
             if ((categories & StyleCategoryFlags::ColorsAndOpacity) == StyleCategoryFlags::ColorsAndOpacity)
@@ -129,17 +262,17 @@ namespace tgui  { namespace xhtml
                 if ((styleEntryFlags & StyleEntryFlags::FontSize) == StyleEntryFlags::FontSize)
                     m_formattingState.setTextSize(styleEntry->getFontSize());
             }
-        }
+        });
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void FormattedXhtmlDocument::applyStyleEntriesToFormattedElement(FormattedElement::Ptr formattedElement,
-        const std::vector<XhtmlStyleEntry::Ptr> styleEntries, Vector2f parentSize,
+        const std::vector<XhtmlStyleEntry::Ptr>& styleEntries, const XhtmlStyleEntry::Ptr& localStyleEntry, Vector2f parentSize,
         const FormattedDocument::FontCollection& fontCollection, StyleCategoryFlags categories)
     {
-
-        for (auto styleEntry : styleEntries)
+        FormattedRectangle::Ptr formattedRect = std::dynamic_pointer_cast<FormattedRectangle>(formattedElement);
+        forEachStyleEntry(styleEntries, localStyleEntry, [this, &formattedElement, &formattedRect, parentSize, categories](const XhtmlStyleEntry::Ptr& styleEntry)
         {
             auto styleEntryFlags = styleEntry->getStyleEntryFlags();
             if ((categories & StyleCategoryFlags::BackColor) == StyleCategoryFlags::BackColor)
@@ -153,9 +286,8 @@ namespace tgui  { namespace xhtml
                     formattedElement->setOpacity(styleEntry->getOpacity());
             }
 
-            FormattedRectangle::Ptr formattedRect = std::dynamic_pointer_cast<FormattedRectangle>(formattedElement);
             if (formattedRect == nullptr)
-                continue;
+                return;
 
             if ((categories & StyleCategoryFlags::BorderStyle) == StyleCategoryFlags::BorderStyle &&
                 !styleEntry->getBorderStyle().isNoneOrHidden())
@@ -174,7 +306,7 @@ namespace tgui  { namespace xhtml
                 if ((styleEntryFlags & StyleEntryFlags::BorderColor) == StyleEntryFlags::BorderColor)
                     formattedRect->setBorderColor(styleEntry->getBorderColor());
             }
-        }
+        });
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -255,36 +387,39 @@ namespace tgui  { namespace xhtml
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    size_t FormattedXhtmlDocument::calculateAutoLineBreak(const String remainingText, float runLength) const
+    size_t FormattedXhtmlDocument::calculateAutoLineBreak(const std::vector<XhtmlBreakOpportunity>& breakOpportunities, size_t lineStart,
+                                                          const TextRunMeasure& textRunMeasure) const
+    {
+        const float availableRunLength = m_evolvingLayoutArea.width - m_evolvingLineRunLength;
+
+        // the break opportunities, that would start a new line behind the line start
+        auto first = std::partition_point(breakOpportunities.begin(), breakOpportunities.end(),
+                                          [lineStart](const XhtmlBreakOpportunity& opportunity) { return opportunity.NextLineStart <= lineStart; });
+        // The run length grows with the line end, so the last break opportunity, that still fits, is found by binary search.
+        auto last = std::partition_point(first, breakOpportunities.end(),
+                                         [&textRunMeasure, lineStart, availableRunLength](const XhtmlBreakOpportunity& opportunity)
+                                         { return textRunMeasure.getRunLength(lineStart, opportunity.LineEnd) < availableRunLength; });
+
+        return (last == first ? SIZE_MAX : static_cast<size_t>(last - breakOpportunities.begin()) - 1);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const TextRunMeasure& FormattedXhtmlDocument::measureTextRun(const XhtmlInnerText& innerText, const String& text)
     {
-        // Determine SECURE auto-line-break position: For a mono-space font, the runLength is distributed equally to the characters.
-        // For a proportional font, the runLength typically is smaller and the SECURE auto-line-break position is a good starting point.
-        size_t delimiterPosition = static_cast<size_t>(remainingText.size() * ((1.0f * (m_evolvingLayoutArea.width - m_evolvingLineRunLength)) / (1.0f * runLength)));
-        // The line width calculation is not 100% correct. - So some security space is subtracted.
-        delimiterPosition -= (delimiterPosition > 333 ? 8 : (delimiterPosition > 99 ? 6 : (delimiterPosition > 33 ? 4 : (delimiterPosition > 9 ? 2 : (delimiterPosition > 3 ? 1 : 0)))));
-        size_t linebreakPosition = remainingText.find_last_of(LinebreakDelimitercharacters, delimiterPosition); // Search only includes characters at or before delimiterPosition.
-
-        auto tryAgain = true;
-        while (tryAgain)
+        const unsigned int textHeight = static_cast<unsigned int>(m_formattingState.TextHeight + 0.49f);
+
+        // the same text is laid out with the same font and text height on every relayout for a new width
+        TextRunMetric& metric = m_textRunMetrics[&innerText];
+        metric.LayoutPass = m_layoutPass;
+        if (metric.TextRevision != innerText.getTextRevision() || metric.TextHeight != textHeight || metric.TextFont != m_formattingState.TextFont)
         {
-            size_t expandedLinebreakPosition = remainingText.find_first_of(LinebreakDelimitercharacters, delimiterPosition + 1);
-            if (expandedLinebreakPosition < remainingText.size())
-            {
-                expandedLinebreakPosition += expandedLinebreakPosition < remainingText.size() - 1 && remainingText[expandedLinebreakPosition] == L'-' ? 1 : 0;
-                runLength = Text::getLineWidth(remainingText.substr(0, expandedLinebreakPosition), m_formattingState.TextFont, static_cast<unsigned int>(m_formattingState.TextHeight + 0.49f));
-                if (m_evolvingLayoutArea.width - m_evolvingLineRunLength > runLength)
-                {
-                    delimiterPosition = expandedLinebreakPosition;
-                    linebreakPosition = expandedLinebreakPosition;
-                }
-                else
-                    tryAgain = false;
-            }
-            else
-                tryAgain = false;
+            metric.TextFont = m_formattingState.TextFont;
+            metric.TextHeight = textHeight;
+            metric.TextRevision = innerText.getTextRevision();
+            metric.Measure.measure(text, m_formattingState.TextFont, textHeight);
         }
-
-        return linebreakPosition;
+        return metric.Measure;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -304,6 +439,7 @@ namespace tgui  { namespace xhtml
         m_availableClientSize = clientSize;
         m_occupiedLayoutSize = {0.0f, 0.0f};
         m_content.clear();
+        m_layoutPass++;
         m_defaultTextSize = defaultTextSize;
         m_defaultOpacity = defaultOpacity;
         m_defaultForeColor = defaultForeColor;
@@ -323,42 +459,43 @@ namespace tgui  { namespace xhtml
             FormattedElement::Ptr formattedElement = m_content[m_content.size() - 1];
             m_occupiedLayoutSize.y += formattedElement->getLayoutSize().y + m_defaultTextSize / 2;
         }
+
+        // drop the measurements of the texts, that are not part of the document anymore (removed or replaced elements)
+        for (auto metric = m_textRunMetrics.begin(); metric != m_textRunMetrics.end(); )
+        {
+            if (metric->second.LayoutPass != m_layoutPass)
+                metric = m_textRunMetrics.erase(metric);
+            else
+                metric++;
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     int FormattedXhtmlDocument::loadDocument(const std::string filePath, bool trace)
     {
-        int state = 0;
+        // the diagnostics are only read for the trace
+        XhtmlDocumentParseResult result;
+        result.Diagnostics.setMode(trace ? XhtmlDiagnosticsMode::Collect : XhtmlDiagnosticsMode::None);
+        loadIntoResult(filePath, true, trace, result);
+        int state = result.State;
 
-        std::string  errorMessage;
-        String fileEncoding;
-        String hypertextString = FormattedXhtmlDocument::readXhtmlDocument(filePath, fileEncoding, errorMessage);
-        if (hypertextString.size() == 0)
-        {
-            if (trace)
-                std::cerr << "ERROR: " << errorMessage << "\n";
-            state = -1;
-        }
-        else
+        if (trace)
         {
-            auto elements = FormattedXhtmlDocument::parseXhtmlDocument(hypertextString, true, trace);
-            if (elements.size() == 0)
-                state = -2;
-            else
+            for (auto& diagnostic : result.Diagnostics.getDiagnostics())
             {
-                auto rootHtml = XhtmlElement::getFirstElement(elements, "html");
-                auto html = std::dynamic_pointer_cast<XhtmlContainerElement>(rootHtml);
-                if (html == nullptr)
-                    state = -3;
+                if (XhtmlDiagnostics::getMessageType(diagnostic.Code) == MessageType::ERROR)
+                    std::wcerr << XhtmlDiagnostics::format(diagnostic) << std::endl;
                 else
-                    setRootElement(html);
+                    std::wcout << XhtmlDiagnostics::format(diagnostic) << std::endl;
             }
         }
 
+        if (state == 0)
+            setRootElement(std::dynamic_pointer_cast<XhtmlContainerElement>(XhtmlElement::getFirstElement(result.RootElements, "html")));
+
         if (m_errorNotifyDlgParent && state != 0)
         {
-            static MessageBox::Ptr errorMessageBox;
             tgui::String message;
             if (state == -1)
                 message = "File can not be red:\n";
@@ -367,18 +504,18 @@ namespace tgui  { namespace xhtml
             else
                 message = "File doesn't contain an XHTML root element:\n";
             message += '\"' + filePath + '\"';
-            if (errorMessageBox)
-                errorMessageBox->setText(message);
+            if (m_errorMessageBox)
+                m_errorMessageBox->setText(message);
             else
-                errorMessageBox = MessageBox::create("Error loading XML file", message, {"OK"});
+                m_errorMessageBox = MessageBox::create("Error loading XML file", message, {"OK"});
             auto parentSize = m_errorNotifyDlgParent->getSize();
-            errorMessageBox->setPosition(parentSize.x / 2 - 150, parentSize.y / 2 - 50);
-            m_errorNotifyDlgParent->getParentGui()->add(errorMessageBox, U"FormattedXhtmlDocument_ErrorMessageBox");
-            auto children = errorMessageBox->getWidgets(); // First child is label, second child id button.
+            m_errorMessageBox->setPosition(parentSize.x / 2 - 150, parentSize.y / 2 - 50);
+            m_errorNotifyDlgParent->getParentGui()->add(m_errorMessageBox, U"FormattedXhtmlDocument_ErrorMessageBox");
+            auto children = m_errorMessageBox->getWidgets(); // First child is label, second child id button.
             auto button = std::dynamic_pointer_cast<tgui::Button>(children[children.size() - 1]);
             if (button)
             {
-                button->onPress([&] { auto gui = m_errorNotifyDlgParent->getParentGui(); if (gui) { gui->remove(errorMessageBox); } });
+                button->onPress([this] { auto gui = m_errorNotifyDlgParent->getParentGui(); if (gui) { gui->remove(m_errorMessageBox); } });
             }
         }
 
@@ -531,6 +668,98 @@ namespace tgui  { namespace xhtml
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    namespace
+    {
+        constexpr LayoutTraitFlags BlockBackground = LayoutTraitFlags::Block | LayoutTraitFlags::InitializesBackground |
+                                                     LayoutTraitFlags::FinalizesBackground;
+        constexpr LayoutTraitFlags MarginPadding   = LayoutTraitFlags::TakesMargin | LayoutTraitFlags::TakesPadding;
+
+        /// @brief The layout traits of one XHTML element type
+        struct LayoutTraitEntry
+        {
+            const char*      TypeName; //!< The element type name
+            LayoutTraitFlags Traits;   //!< The layout traits of the element type
+        };
+
+        // All element types, that are not listed here, have no layout traits.
+        constexpr LayoutTraitEntry LayoutTraitEntries[] =
+        {
+            {   XhtmlElementType::Body,            BlockBackground | MarginPadding | LayoutTraitFlags::SuppressesInitialExtraSpace                    },
+
+            {   XhtmlElementType::H1,              BlockBackground | MarginPadding | LayoutTraitFlags::Heading |
+                                                   LayoutTraitFlags::ProvidesExtraSpace | LayoutTraitFlags::EndsRunLengthExpansion                  },
+            {   XhtmlElementType::H2,              BlockBackground | MarginPadding | LayoutTraitFlags::Heading |
+                                                   LayoutTraitFlags::ProvidesExtraSpace | LayoutTraitFlags::EndsRunLengthExpansion                  },
+            {   XhtmlElementType::H3,              BlockBackground | MarginPadding | LayoutTraitFlags::Heading |
+                                                   LayoutTraitFlags::ProvidesExtraSpace | LayoutTraitFlags::EndsRunLengthExpansion                  },
+            {   XhtmlElementType::H4,              BlockBackground | MarginPadding | LayoutTraitFlags::Heading |
+                                                   LayoutTraitFlags::ProvidesExtraSpace | LayoutTraitFlags::EndsRunLengthExpansion                  },
+            {   XhtmlElementType::H5,              BlockBackground | MarginPadding | LayoutTraitFlags::Heading |
+                                                   LayoutTraitFlags::ProvidesExtraSpace | LayoutTraitFlags::EndsRunLengthExpansion                  },
+            {   XhtmlElementType::H6,              BlockBackground | MarginPadding | LayoutTraitFlags::Heading |
+                                                   LayoutTraitFlags::ProvidesExtraSpace | LayoutTraitFlags::EndsRunLengthExpansion                  },
+
+            {   XhtmlElementType::Emphasized,      LayoutTraitFlags::Block | MarginPadding                                                           },
+            {   XhtmlElementType::Italic,          LayoutTraitFlags::Block | MarginPadding                                                           },
+            {   XhtmlElementType::Strong,          LayoutTraitFlags::Block | MarginPadding                                                           },
+            {   XhtmlElementType::Bold,            LayoutTraitFlags::Block | MarginPadding                                                           },
+            {   XhtmlElementType::Underline,       LayoutTraitFlags::Block | MarginPadding                                                           },
+            {   XhtmlElementType::Superscript,     LayoutTraitFlags::Block | MarginPadding                                                           },
+            {   XhtmlElementType::Subscript,       LayoutTraitFlags::Block | MarginPadding                                                           },
+
+            {   XhtmlElementType::UnorderedList,   BlockBackground | MarginPadding | LayoutTraitFlags::List | LayoutTraitFlags::SuppressesInitialExtraSpace |
+                                                   LayoutTraitFlags::ProvidesExtraSpace | LayoutTraitFlags::EndsRunLengthExpansion                  },
+            {   XhtmlElementType::OrderedList,     BlockBackground | MarginPadding | LayoutTraitFlags::List | LayoutTraitFlags::SuppressesInitialExtraSpace |
+                                                   LayoutTraitFlags::ProvidesExtraSpace | LayoutTraitFlags::EndsRunLengthExpansion                  },
+            {   XhtmlElementType::ListItem,        LayoutTraitFlags::Block | MarginPadding | LayoutTraitFlags::SuppressesInitialExtraSpace           },
+
+            // Tables, row ranges and rows don't take padding, row ranges, rows and cells don't take margin.
+            {   XhtmlElementType::Table,           BlockBackground | LayoutTraitFlags::TakesMargin | LayoutTraitFlags::EndsRunLengthExpansion       },
+            {   XhtmlElementType::TableHead,       BlockBackground | LayoutTraitFlags::TableRowRange | LayoutTraitFlags::EndsRunLengthExpansion     },
+            {   XhtmlElementType::TableBody,       BlockBackground | LayoutTraitFlags::TableRowRange | LayoutTraitFlags::EndsRunLengthExpansion     },
+            {   XhtmlElementType::TableFoot,       BlockBackground | LayoutTraitFlags::TableRowRange | LayoutTraitFlags::EndsRunLengthExpansion     },
+            {   XhtmlElementType::TableRow,        BlockBackground | LayoutTraitFlags::EndsRunLengthExpansion                                        },
+            {   XhtmlElementType::TableHeaderCell, BlockBackground | LayoutTraitFlags::TakesPadding | LayoutTraitFlags::TableCell |
+                                                   LayoutTraitFlags::EndsRunLengthExpansion                                                          },
+            {   XhtmlElementType::TableDataCell,   BlockBackground | LayoutTraitFlags::TakesPadding | LayoutTraitFlags::TableCell |
+                                                   LayoutTraitFlags::EndsRunLengthExpansion                                                          },
+
+            {   XhtmlElementType::Span,            BlockBackground | MarginPadding | LayoutTraitFlags::InlineBox                                     },
+            {   XhtmlElementType::Anchor,          BlockBackground | MarginPadding | LayoutTraitFlags::InlineBox                                     },
+            {   XhtmlElementType::Division,        BlockBackground | MarginPadding | LayoutTraitFlags::TextBlock |
+                                                   LayoutTraitFlags::SuppressesInitialExtraSpace | LayoutTraitFlags::EndsRunLengthExpansion         },
+            {   XhtmlElementType::Preformatted,    BlockBackground | MarginPadding | LayoutTraitFlags::TextBlock |
+                                                   LayoutTraitFlags::SuppressesInitialExtraSpace | LayoutTraitFlags::EndsRunLengthExpansion         },
+            {   XhtmlElementType::Code,            BlockBackground | MarginPadding | LayoutTraitFlags::TextBlock |
+                                                   LayoutTraitFlags::SuppressesInitialExtraSpace | LayoutTraitFlags::EndsRunLengthExpansion         },
+            {   XhtmlElementType::Paragraph,       BlockBackground | MarginPadding | LayoutTraitFlags::SuppressesInitialExtraSpace |
+                                                   LayoutTraitFlags::ProvidesExtraSpace | LayoutTraitFlags::EndsRunLengthExpansion                  },
+            // The image background is finalized by the image itself.
+            {   XhtmlElementType::Image,           LayoutTraitFlags::Block | LayoutTraitFlags::InitializesBackground | MarginPadding                 },
+
+            {   XhtmlElementType::Break,           LayoutTraitFlags::FlowContent                                                                     },
+            {   XhtmlElementType::Text,            LayoutTraitFlags::FlowContent                                                                     }
+        };
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    LayoutTraitFlags FormattedXhtmlDocument::getLayoutTraits(XhtmlElementType::TagId tagId)
+    {
+        // The table is indexed by tag ID, it is filled once from the (tag ID independent) layout trait entries.
+        static const std::vector<LayoutTraitFlags> layoutTraits = []()
+        {
+            std::vector<LayoutTraitFlags> traits(static_cast<size_t>(XhtmlElementType::EmptyTagId) + 1, LayoutTraitFlags::None);
+            for (const auto& entry : LayoutTraitEntries)
+                traits[XhtmlElementType::getTagId(entry.TypeName)] = entry.Traits;
+            return traits;
+        }();
+
+        return (tagId < layoutTraits.size() ? layoutTraits[tagId] : LayoutTraitFlags::None);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void FormattedXhtmlDocument::layout(bool& predecessorElementProvidesExtraSpace, bool parentElementSuppressesInitialExtraSpace,
                                         bool& lastchildAcceptsRunLengtExpansion, XhtmlElement::Ptr xhtmlElement,
                                         const FormattedDocument::FontCollection& fontCollection, bool keepSelection)
@@ -539,32 +768,24 @@ namespace tgui  { namespace xhtml
         if (typeName == XhtmlElementType::Head)
             return;
 
+        // Every phase below tests the precomputed traits instead of comparing the type name against a list of type names.
+        const auto traits = getLayoutTraits(xhtmlElement->getTagId());
+
         std::shared_ptr<FormattedElement> currentFormattedElement = nullptr;
 
         // Block elements always need to start a new line and to lock the current line.
-        if (typeName == XhtmlElementType::Body            ||
-            typeName == XhtmlElementType::H1              || typeName == XhtmlElementType::H2              || typeName == XhtmlElementType::H3 ||
-            typeName == XhtmlElementType::H4              || typeName == XhtmlElementType::H5              || typeName == XhtmlElementType::H6 ||
-            typeName == XhtmlElementType::Emphasized      || typeName == XhtmlElementType::Italic          ||
-            typeName == XhtmlElementType::Strong          || typeName == XhtmlElementType::Bold            ||
-            typeName == XhtmlElementType::Underline       ||
-            typeName == XhtmlElementType::Superscript     || typeName == XhtmlElementType::Subscript       ||
-            typeName == XhtmlElementType::UnorderedList   || typeName == XhtmlElementType::OrderedList     ||
-            typeName == XhtmlElementType::ListItem        ||
-            typeName == XhtmlElementType::Table           ||
-            typeName == XhtmlElementType::TableHead       || typeName == XhtmlElementType::TableBody       || typeName == XhtmlElementType::TableFoot     ||
-            typeName == XhtmlElementType::TableRow        || typeName == XhtmlElementType::TableHeaderCell || typeName == XhtmlElementType::TableDataCell ||
-            typeName == XhtmlElementType::Span            || typeName == XhtmlElementType::Anchor          ||
-            typeName == XhtmlElementType::Division        || typeName == XhtmlElementType::Preformatted    || typeName == XhtmlElementType::Code ||
-            typeName == XhtmlElementType::Paragraph       || typeName == XhtmlElementType::Image)
+        if (hasAnyLayoutTrait(traits, LayoutTraitFlags::Block))
         {
             // prepare rect section to accommodate the block
 
             FormattingState cachedState(m_formattingState);
-            auto styleEntries = getApplicableStyleElements(xhtmlElement);
+            // the global style entries are cached by the element, the local style entry is applied last
+            const auto& styleEntries = getApplicableStyleElements(xhtmlElement);
             auto xhtmlStyleableElement = std::dynamic_pointer_cast<XhtmlStyleableInterface>(xhtmlElement);
+            const XhtmlStyleEntry::Ptr localStyleEntry = (xhtmlStyleableElement ? xhtmlStyleableElement->getStyleEntry() : nullptr);
 
-            bool currentIsInitialExtraSpaceSuppressingElement = false;
+            // The first child element of e.g. body, list, list item, division or paragraph can be placed without preceeding extra space.
+            bool currentIsInitialExtraSpaceSuppressingElement = hasAnyLayoutTrait(traits, LayoutTraitFlags::SuppressesInitialExtraSpace);
 
             // -------------------------------
             // Apply predefined font style
@@ -613,7 +834,7 @@ namespace tgui  { namespace xhtml
             // -------------------------------
             if (xhtmlStyleableElement)
             {
-                applyStyleEntriesToFormattingState(styleEntries, fontCollection, StyleCategoryFlags::ColorsAndOpacity | StyleCategoryFlags::Fonts);
+                applyStyleEntriesToFormattingState(styleEntries, localStyleEntry, fontCollection, StyleCategoryFlags::ColorsAndOpacity | StyleCategoryFlags::Fonts);
             }
 
             // -------------------------------
@@ -646,10 +867,8 @@ namespace tgui  { namespace xhtml
                 m_evolvingLineRunLength = 0;
 
                 // -- Set flags
-                currentIsInitialExtraSpaceSuppressingElement = true; // First child element can be placed without preceeding extra space.
             }
-            else if (typeName == XhtmlElementType::H1 || typeName == XhtmlElementType::H2 || typeName == XhtmlElementType::H3 ||
-                     typeName == XhtmlElementType::H4 || typeName == XhtmlElementType::H5 || typeName == XhtmlElementType::H6)
+            else if (hasAnyLayoutTrait(traits, LayoutTraitFlags::Heading))
             {
                 // Can be an anchor or styled, but doesn't represent text/image ==> FormattedRectangle
 
@@ -671,14 +890,14 @@ namespace tgui  { namespace xhtml
 
                 // -- Set flags
             }
-            else if (typeName == XhtmlElementType::UnorderedList || typeName == XhtmlElementType::OrderedList)
+            else if (hasAnyLayoutTrait(traits, LayoutTraitFlags::List))
             {
                 // Can be an anchor or styled, but doesn't represent text/image ==> FormattedRectangle
 
                 // -- Prepare Y
                 auto parent  = xhtmlElement->getParent();
                 auto predec = XhtmlElement::getPreviousSibling(xhtmlElement);
-                auto parentTypeName = (parent != nullptr ? parent->getTypeName() : XhtmlElementType::Body);
+                auto parentIsList = (parent != nullptr && hasAnyLayoutTrait(getLayoutTraits(parent->getTagId()), LayoutTraitFlags::List));
                 auto predecTypeName = (predec != nullptr ? predec->getTypeName() : XhtmlElementType::Break);
 
                 // -- Prepare inner layout
@@ -694,7 +913,7 @@ namespace tgui  { namespace xhtml
 
                 /* [1] */ if (m_formattingState.ListMetrics.size() == 0)
                     m_evolvingLayoutArea.top += m_evolvingLineExtraHeight + m_defaultTextSize + m_defaultTextSize / 4 + m_defaultTextSize;
-                /* [2] */ else if (parentTypeName != XhtmlElementType::UnorderedList && parentTypeName != XhtmlElementType::OrderedList)
+                /* [2] */ else if (!parentIsList)
                     m_evolvingLayoutArea.top += m_evolvingLineExtraHeight + m_defaultTextSize + m_defaultTextSize / 4;
                 /* [3] */ else if (predecTypeName == XhtmlElementType::ListItem)
                     m_evolvingLayoutArea.top += m_evolvingLineExtraHeight;
@@ -718,7 +937,6 @@ namespace tgui  { namespace xhtml
                 m_evolvingLineRunLength = 0;
 
                 // -- Set flags
-                currentIsInitialExtraSpaceSuppressingElement = true; // First child element can be placed without preceeding extra space.
             }
             else if (typeName == XhtmlElementType::ListItem)
             {
@@ -756,7 +974,6 @@ namespace tgui  { namespace xhtml
                 m_evolvingLineRunLength = 0;
 
                 // -- Set flags
-                currentIsInitialExtraSpaceSuppressingElement = true; // First child element can be placed without preceeding extra space.
             }
             else if (typeName == XhtmlElementType::Table)
             {
@@ -786,11 +1003,11 @@ namespace tgui  { namespace xhtml
 
                 // -- Set flags
             }
-            else if (typeName == XhtmlElementType::TableHead || typeName == XhtmlElementType::TableBody || typeName == XhtmlElementType::TableFoot)
+            else if (hasAnyLayoutTrait(traits, LayoutTraitFlags::TableRowRange))
             {
                 // Everything is done by table's call to calculateTableColumnRequestedSizes().
             }
-            else if (typeName == XhtmlElementType::TableRow || typeName == XhtmlElementType::TableHeaderCell || typeName == XhtmlElementType::TableDataCell)
+            else if (typeName == XhtmlElementType::TableRow || hasAnyLayoutTrait(traits, LayoutTraitFlags::TableCell))
             {
                 // Can be an anchor or styled, but doesn't represent text/image ==> FormattedRectangle
 
@@ -831,7 +1048,7 @@ namespace tgui  { namespace xhtml
                     }
 
                     // Remember Y and update Y & X
-                    if (typeName == XhtmlElementType::TableHeaderCell || typeName == XhtmlElementType::TableDataCell)
+                    if (hasAnyLayoutTrait(traits, LayoutTraitFlags::TableCell))
                     {
                         size_t rowIndex = 0;
                         auto tableRowMetric = tableMetric->firstOrDefaultRowMetricByAnyCellContentOrigin(xhtmlElement, rowIndex);
@@ -883,7 +1100,7 @@ namespace tgui  { namespace xhtml
 
                     // Header cells (<th>...</th>) aren't automatically assigned to the head row range!
                     // The only defferences are alignment center and bold font.
-                    if (typeName == XhtmlElementType::TableHeaderCell || typeName == XhtmlElementType::TableDataCell)
+                    if (hasAnyLayoutTrait(traits, LayoutTraitFlags::TableCell))
                     {
                         auto tableRowMetric = tableMetric->firstOrDefaultRowMetricByAnyCellContentOrigin(xhtmlElement);
                         auto tableCellMetric = tableRowMetric ? tableRowMetric->firstOrDefaultCellMetricByContentOrigin(xhtmlElement) : nullptr;
@@ -900,7 +1117,7 @@ namespace tgui  { namespace xhtml
 
                 // -- Set flags
             }
-            else if (typeName == XhtmlElementType::Span || typeName == XhtmlElementType::Anchor)
+            else if (hasAnyLayoutTrait(traits, LayoutTraitFlags::InlineBox))
             {
                 // Can be an anchor or styled, but doesn't represent text/image ==> FormattedRectangle
 
@@ -938,7 +1155,7 @@ namespace tgui  { namespace xhtml
 
                 // -- Set flags
             }
-            else if (typeName == XhtmlElementType::Division || typeName == XhtmlElementType::Preformatted || typeName == XhtmlElementType::Code)
+            else if (hasAnyLayoutTrait(traits, LayoutTraitFlags::TextBlock))
             {
                 // Can be an anchor or styled, but doesn't represent text/image ==> FormattedRectangle
 
@@ -976,7 +1193,6 @@ namespace tgui  { namespace xhtml
                 m_evolvingLineRunLength = 0;
 
                 // -- Set flags
-                currentIsInitialExtraSpaceSuppressingElement = true; // First child element can be placed without preceeding extra space.
             }
             else if (typeName == XhtmlElementType::Paragraph)
             {
@@ -999,7 +1215,6 @@ namespace tgui  { namespace xhtml
                 m_evolvingLineRunLength = 0;
 
                 // -- Set flags
-                currentIsInitialExtraSpaceSuppressingElement = true; // First child element can be placed without preceeding extra space.
             }
             else if (typeName == XhtmlElementType::Image)
             {
@@ -1021,22 +1236,13 @@ namespace tgui  { namespace xhtml
             // -------------------------------
             // Initialize backgound and border
             // -------------------------------
-            if (typeName == XhtmlElementType::Body            ||
-                typeName == XhtmlElementType::H1              || typeName == XhtmlElementType::H2              || typeName == XhtmlElementType::H3 ||
-                typeName == XhtmlElementType::H4              || typeName == XhtmlElementType::H5              || typeName == XhtmlElementType::H6 ||
-                typeName == XhtmlElementType::UnorderedList   || typeName == XhtmlElementType::OrderedList     ||
-                typeName == XhtmlElementType::Table           ||
-                typeName == XhtmlElementType::TableHead       || typeName == XhtmlElementType::TableBody       || typeName == XhtmlElementType::TableFoot     ||
-                typeName == XhtmlElementType::TableRow        || typeName == XhtmlElementType::TableHeaderCell || typeName == XhtmlElementType::TableDataCell ||
-                typeName == XhtmlElementType::Span            || typeName == XhtmlElementType::Anchor          ||
-                typeName == XhtmlElementType::Division        || typeName == XhtmlElementType::Preformatted    || typeName == XhtmlElementType::Code ||
-                typeName == XhtmlElementType::Paragraph       || typeName == XhtmlElementType::Image)
+            if (hasAnyLayoutTrait(traits, LayoutTraitFlags::InitializesBackground))
             {
                 FormattedRectangle::Ptr formattedRectSection = std::dynamic_pointer_cast<FormattedRectangle>(currentFormattedElement);
                 if (formattedRectSection)
 
                 {
-                    applyStyleEntriesToFormattedElement(formattedRectSection, styleEntries, { m_availableClientSize.x, /* yes, X */ m_availableClientSize.x }, fontCollection,
+                    applyStyleEntriesToFormattedElement(formattedRectSection, styleEntries, localStyleEntry, { m_availableClientSize.x, /* yes, X */ m_availableClientSize.x }, fontCollection,
                         StyleCategoryFlags::BackColor | StyleCategoryFlags::Opacity |
                         StyleCategoryFlags::BorderStyle | StyleCategoryFlags::BorderWidth | StyleCategoryFlags::BorderColor);
                 }
@@ -1045,18 +1251,12 @@ namespace tgui  { namespace xhtml
             // -------------------------------
             // Apply leading margin
             // -------------------------------
-            if (xhtmlStyleableElement &&
-                typeName != XhtmlElementType::TableHead &&
-                typeName != XhtmlElementType::TableBody &&
-                typeName != XhtmlElementType::TableFoot &&
-                typeName != XhtmlElementType::TableRow &&
-                typeName != XhtmlElementType::TableHeaderCell &&
-                typeName != XhtmlElementType::TableDataCell)
+            if (xhtmlStyleableElement && hasAnyLayoutTrait(traits, LayoutTraitFlags::TakesMargin))
             {
                 FormattedRectangle::Ptr formattedRectSection = std::dynamic_pointer_cast<FormattedRectangle>(currentFormattedElement);
                 if (formattedRectSection)
                 {
-                    for (auto styleEntry : styleEntries)
+                    forEachStyleEntry(styleEntries, localStyleEntry, [&](const XhtmlStyleEntry::Ptr& styleEntry)
                     {
                         if ((styleEntry->getStyleEntryFlags() & StyleEntryFlags::Margin) == StyleEntryFlags::Margin)
                         {
@@ -1064,30 +1264,25 @@ namespace tgui  { namespace xhtml
                             inflate(m_evolvingLayoutArea, -margin.left, -margin.top, -margin.right, 0);
                             formattedRectSection->setMargin(margin);
                         }
-                    }
+                    });
                 }
             }
 
             // -----------------------------
             // Apply leading padding
             // -----------------------------
-            if (xhtmlStyleableElement &&
-                typeName != XhtmlElementType::Table &&
-                typeName != XhtmlElementType::TableHead &&
-                typeName != XhtmlElementType::TableBody &&
-                typeName != XhtmlElementType::TableFoot &&
-                typeName != XhtmlElementType::TableRow)
+            if (xhtmlStyleableElement && hasAnyLayoutTrait(traits, LayoutTraitFlags::TakesPadding))
             {
                 if (currentFormattedElement)
                 {
-                    for (auto styleEntry : styleEntries)
+                    forEachStyleEntry(styleEntries, localStyleEntry, [&](const XhtmlStyleEntry::Ptr& styleEntry)
                     {
                         if ((styleEntry->getStyleEntryFlags() & StyleEntryFlags::Padding) == StyleEntryFlags::Padding)
                         {
                             auto padding = styleEntry->getPadding().toPixel({ m_availableClientSize.x, /* yes, X */ m_availableClientSize.x });
                             inflate(m_evolvingLayoutArea, -padding.left, -padding.top, -padding.right, 0);
                         }
-                    }
+                    });
                 }
             }
 
@@ -1113,8 +1308,7 @@ namespace tgui  { namespace xhtml
             // -------------------------------
             bool loopinternalPredecessorElementProvidesExtraSpace = false;
             bool lastchildAcceptsRunLengtExpansion = false;
-            if (typeName == XhtmlElementType::Table     ||
-                typeName == XhtmlElementType::TableHead || typeName == XhtmlElementType::TableBody || typeName == XhtmlElementType::TableFoot)
+            if (typeName == XhtmlElementType::Table || hasAnyLayoutTrait(traits, LayoutTraitFlags::TableRowRange))
             {
                 // For a table and table row-ranges we can't strictly follow the XHTML element hierarchy.
                 // Because free rows always belog to the <tbody>...</tbody> row-range (even if they appear before or after the <tbody>...</tbody> row-range).
@@ -1168,16 +1362,11 @@ namespace tgui  { namespace xhtml
             // -----------------------------
             // Apply tailing padding
             // -----------------------------
-            if (xhtmlStyleableElement &&
-                typeName != XhtmlElementType::Table &&
-                typeName != XhtmlElementType::TableHead &&
-                typeName != XhtmlElementType::TableBody &&
-                typeName != XhtmlElementType::TableFoot &&
-                typeName != XhtmlElementType::TableRow)
+            if (xhtmlStyleableElement && hasAnyLayoutTrait(traits, LayoutTraitFlags::TakesPadding))
             {
                 if (currentFormattedElement)
                 {
-                    for (auto styleEntry : styleEntries)
+                    forEachStyleEntry(styleEntries, localStyleEntry, [&](const XhtmlStyleEntry::Ptr& styleEntry)
                     {
                         if ((styleEntry->getStyleEntryFlags() & StyleEntryFlags::Padding) == StyleEntryFlags::Padding)
                         {
@@ -1185,24 +1374,18 @@ namespace tgui  { namespace xhtml
                             inflate(m_evolvingLayoutArea, padding.left, -padding.bottom, padding.right, 0);
                             bottomExtraSpace += padding.bottom;
                         }
-                    }
+                    });
                 }
             }
 
             // -------------------------------
             // Apply tailing margin
             // -------------------------------
-            if (xhtmlStyleableElement &&
-                typeName != XhtmlElementType::TableHead &&
-                typeName != XhtmlElementType::TableBody &&
-                typeName != XhtmlElementType::TableFoot &&
-                typeName != XhtmlElementType::TableRow &&
-                typeName != XhtmlElementType::TableHeaderCell &&
-                typeName != XhtmlElementType::TableDataCell)
+            if (xhtmlStyleableElement && hasAnyLayoutTrait(traits, LayoutTraitFlags::TakesMargin))
             {
                 if (currentFormattedElement)
                 {
-                    for (auto styleEntry : styleEntries)
+                    forEachStyleEntry(styleEntries, localStyleEntry, [&](const XhtmlStyleEntry::Ptr& styleEntry)
                     {
                         if ((styleEntry->getStyleEntryFlags() & StyleEntryFlags::Margin) == StyleEntryFlags::Margin)
                         {
@@ -1210,23 +1393,14 @@ namespace tgui  { namespace xhtml
                             inflate(m_evolvingLayoutArea, margin.left, -margin.bottom, margin.right, 0);
                             bottomExtraSpace += margin.bottom;
                         }
-                    }
+                    });
                 }
             }
 
             // -------------------------------
             // Finalize background
             // -------------------------------
-            if (typeName == XhtmlElementType::Body            || typeName == XhtmlElementType::UnorderedList   || typeName == XhtmlElementType::OrderedList ||
-                typeName == XhtmlElementType::H1              || typeName == XhtmlElementType::H2              || typeName == XhtmlElementType::H3 ||
-                typeName == XhtmlElementType::H4              || typeName == XhtmlElementType::H5              || typeName == XhtmlElementType::H6 ||
-                typeName == XhtmlElementType::UnorderedList   || typeName == XhtmlElementType::OrderedList     ||
-                typeName == XhtmlElementType::Table           ||
-                typeName == XhtmlElementType::TableHead       || typeName == XhtmlElementType::TableBody       || typeName == XhtmlElementType::TableFoot ||
-                typeName == XhtmlElementType::TableRow        || typeName == XhtmlElementType::TableHeaderCell || typeName == XhtmlElementType::TableDataCell ||
-                typeName == XhtmlElementType::Span            || typeName == XhtmlElementType::Anchor          ||
-                typeName == XhtmlElementType::Division        || typeName == XhtmlElementType::Preformatted    || typeName == XhtmlElementType::Code ||
-                typeName == XhtmlElementType::Paragraph)      // typeName == XhtmlElementType::Image)
+            if (hasAnyLayoutTrait(traits, LayoutTraitFlags::FinalizesBackground))
             {
                 if (currentFormattedElement && typeName == XhtmlElementType::Table)
                 {
@@ -1253,9 +1427,9 @@ namespace tgui  { namespace xhtml
                     {
                         // typically the the text sections are always open to add new charachters (in other words: not finalized with line break / carriage return)
                         // which implies, that m_evolvingLayoutArea.top points still to the top of the  text sections, while they might have a heigth
-                        if (typeName == XhtmlElementType::Span || typeName == XhtmlElementType::Anchor)
+                        if (hasAnyLayoutTrait(traits, LayoutTraitFlags::InlineBox))
                             currentFormattedElement->setLayoutRightBottom(Vector2f(m_evolvingLayoutArea.left + m_evolvingLineRunLength, lastFlowContentSection->getLayoutRefLine() + m_formattingState.TextHeight / 4 + bottomExtraSpace));
-                        else if (typeName == XhtmlElementType::TableDataCell || typeName == XhtmlElementType::TableHeaderCell)
+                        else if (hasAnyLayoutTrait(traits, LayoutTraitFlags::TableCell))
                             currentFormattedElement->setLayoutRightBottom(Vector2f(right(m_evolvingLayoutArea), lastFlowContentSection->getLayoutRefLine() + bottomExtraSpace));
                         else
                             currentFormattedElement->setLayoutRightBottom(Vector2f(right(m_evolvingLayoutArea), lastFlowContentSection->getLayoutRefLine() + m_formattingState.TextHeight / 4 + bottomExtraSpace));
@@ -1269,8 +1443,7 @@ namespace tgui  { namespace xhtml
             // Finalize formatted elements
             // Apply tailing offsets
             // -------------------------------
-            if (typeName == XhtmlElementType::H1       || typeName == XhtmlElementType::H2              || typeName == XhtmlElementType::H3 ||
-                typeName == XhtmlElementType::H4       || typeName == XhtmlElementType::H5              || typeName == XhtmlElementType::H6)
+            if (hasAnyLayoutTrait(traits, LayoutTraitFlags::Heading))
             {
                 m_evolvingLayoutArea.top += m_evolvingLineExtraHeight +
                                             (m_formattingState.TextHeight >= m_defaultTextSize ?
@@ -1281,7 +1454,7 @@ namespace tgui  { namespace xhtml
                 m_evolvingLineRunLength = 0;
                 m_evolvingLineExtraHeight = 0;
             }
-            else if (typeName == XhtmlElementType::UnorderedList || typeName == XhtmlElementType::OrderedList)
+            else if (hasAnyLayoutTrait(traits, LayoutTraitFlags::List))
             {
                 m_formattingState.ListMetrics.pop_back();
 
@@ -1299,14 +1472,14 @@ namespace tgui  { namespace xhtml
             }
             else if (typeName == XhtmlElementType::ListItem)
             {
-                auto lastTypeName = XhtmlElementType::Break;
+                auto lastChildIsList = false;
                 auto childCount = xhtmlElement->countChildren();
                 if (childCount > 0)
                 {
                     auto lastChild = xhtmlElement->getChild(childCount - 1);
-                    lastTypeName = lastChild->getTypeName();
+                    lastChildIsList = hasAnyLayoutTrait(getLayoutTraits(lastChild->getTagId()), LayoutTraitFlags::List);
                 }
-                if (lastTypeName != XhtmlElementType::UnorderedList && lastTypeName != XhtmlElementType::OrderedList)
+                if (!lastChildIsList)
                     m_evolvingLayoutArea.top += m_evolvingLineExtraHeight + m_defaultTextSize / 4 + m_defaultTextSize;
                 else
                     m_evolvingLayoutArea.top += m_evolvingLineExtraHeight + m_defaultTextSize / 4;
@@ -1345,7 +1518,7 @@ namespace tgui  { namespace xhtml
                 m_evolvingLineRunLength = 0;
                 m_evolvingLineExtraHeight = 0;
             }
-            else if (typeName == XhtmlElementType::TableHeaderCell || typeName == XhtmlElementType::TableDataCell)
+            else if (hasAnyLayoutTrait(traits, LayoutTraitFlags::TableCell))
             {
                 m_evolvingLayoutArea.top = currentFormattedElement->getLayoutBottom();
 
@@ -1379,7 +1552,7 @@ namespace tgui  { namespace xhtml
                 m_evolvingLineRunLength = 0;
                 m_evolvingLineExtraHeight = 0;
             }
-            else if (typeName == XhtmlElementType::Division || typeName == XhtmlElementType::Preformatted || typeName == XhtmlElementType::Code)
+            else if (hasAnyLayoutTrait(traits, LayoutTraitFlags::TextBlock))
             {
                 if (lastchildAcceptsRunLengtExpansion)
                     m_evolvingLayoutArea.top += m_evolvingLineExtraHeight;
@@ -1407,38 +1580,14 @@ namespace tgui  { namespace xhtml
             // -------------------------------
             // Set flags
             // -------------------------------
-            predecessorElementProvidesExtraSpace = false;
-
-            if (typeName == XhtmlElementType::H1              || typeName == XhtmlElementType::H2            || typeName == XhtmlElementType::H3 ||
-                typeName == XhtmlElementType::H4              || typeName == XhtmlElementType::H5            || typeName == XhtmlElementType::H6)
-            {
-                predecessorElementProvidesExtraSpace = true;
-                lastchildAcceptsRunLengtExpansion = false;
-            }
-            else if (typeName == XhtmlElementType::UnorderedList || typeName == XhtmlElementType::OrderedList)
-            {
-                predecessorElementProvidesExtraSpace = true;
-                lastchildAcceptsRunLengtExpansion = false;
-            }
-            else if (typeName == XhtmlElementType::Table     ||
-                     typeName == XhtmlElementType::TableHead || typeName == XhtmlElementType::TableBody       || typeName == XhtmlElementType::TableFoot ||
-                     typeName == XhtmlElementType::TableRow  || typeName == XhtmlElementType::TableHeaderCell || typeName == XhtmlElementType::TableDataCell)
-            {
-                predecessorElementProvidesExtraSpace = false;
-                lastchildAcceptsRunLengtExpansion = false;
-            }
-            else if (typeName == XhtmlElementType::Division || typeName == XhtmlElementType::Preformatted || typeName == XhtmlElementType::Code)
-                lastchildAcceptsRunLengtExpansion = false;
-            else if (typeName == XhtmlElementType::Paragraph)
-            {
-                predecessorElementProvidesExtraSpace = true;
+            predecessorElementProvidesExtraSpace = hasAnyLayoutTrait(traits, LayoutTraitFlags::ProvidesExtraSpace);
+            if (hasAnyLayoutTrait(traits, LayoutTraitFlags::EndsRunLengthExpansion))
                 lastchildAcceptsRunLengtExpansion = false;
-            }
 
             m_formattingState = cachedState;
         }
 
-        if (typeName == XhtmlElementType::Break || typeName == XhtmlElementType::Text)
+        if (hasAnyLayoutTrait(traits, LayoutTraitFlags::FlowContent))
         {
             // prepare text section to accommodate the text
             auto formattedTextSection = createFormattedTextSectionWithFontAndPosition(xhtmlElement, m_formattingState.TextFont, m_evolvingLineRunLength,
@@ -1457,30 +1606,33 @@ namespace tgui  { namespace xhtml
             }
             else if (typeName == XhtmlElementType::Text)
             {
-                String remainingText = static_cast<XhtmlInnerText*>(xhtmlElement.get())->getText();
-                auto   runLength     = Text::getLineWidth(remainingText, m_formattingState.TextFont, static_cast<unsigned int>(m_formattingState.TextHeight + 0.49f));
-                size_t formerCharCnt = remainingText.size() + 1;
+                auto        innerText          = static_cast<XhtmlInnerText*>(xhtmlElement.get());
+                const auto& text               = innerText->getText();
+                const auto& textRunMeasure     = measureTextRun(*innerText, text);
+                const auto& breakOpportunities = innerText->getBreakOpportunities();
+                size_t      lineStart          = 0;
+                size_t      formerLineStart    = SIZE_MAX;
+
+                // preformatted text has dedicated line bereak instructions - the next one is tracked along with the line start
+                size_t mandatoryBreak = (m_preformattedTextFlagCnt > 0 ? 0 : breakOpportunities.size());
+                while (mandatoryBreak < breakOpportunities.size() && !breakOpportunities[mandatoryBreak].IsMandatory)
+                    mandatoryBreak++;
 
                 // distribute, if text exceeds available width
-                while ((m_preformattedTextFlagCnt > 0 && remainingText.contains('\r')) ||   // preformatted text has dedicated line bereak instructions
-                       (formerCharCnt > remainingText.size() &&                             // there must be a chance to distribute the text to multiple lines
-                        m_evolvingLayoutArea.width - m_evolvingLineRunLength < runLength && // there must be a need to distribute the text to multiple lines
-                        remainingText.size() > 0))                                          // there must be remaining text to distribute to multiple lines
+                while (mandatoryBreak < breakOpportunities.size() ||                                   // preformatted text has dedicated line bereak instructions
+                       (formerLineStart != lineStart &&                                                // there must be a chance to distribute the text to multiple lines
+                        m_evolvingLayoutArea.width - m_evolvingLineRunLength < textRunMeasure.getRunLength(lineStart, text.size()) && // there must be a need to distribute the text to multiple lines
+                        lineStart < text.size()))                                                      // there must be remaining text to distribute to multiple lines
                 {
-                    formerCharCnt = remainingText.size();
+                    formerLineStart = lineStart;
 
-                    size_t linebreakPosition = calculateAutoLineBreak(remainingText, runLength);
+                    size_t linebreakIndex = calculateAutoLineBreak(breakOpportunities, lineStart, textRunMeasure);
 
-                    // The preformatted text might force an earlier line-break, that is situated witin the remaining text before auto-line-break 'linebreakPosition'.
-                    if (m_preformattedTextFlagCnt > 0)
-                    {
-                        auto   substring      = remainingText.substr(0, linebreakPosition);
-                        size_t forcedPosition = substring.find('\r');
-                        if (forcedPosition != static_cast<size_t>(-1))
-                            linebreakPosition = forcedPosition;
-                    }
+                    // The preformatted text might force an earlier line-break, that is situated witin the remaining text before auto-line-break 'linebreakIndex'.
+                    if (mandatoryBreak < breakOpportunities.size() && mandatoryBreak < linebreakIndex)
+                        linebreakIndex = mandatoryBreak;
                     // There might be no way to add (any small part of) the remaining text to the end of the current run length (no meaningfulo auto-line-break).
-                    if (linebreakPosition == SIZE_MAX)
+                    if (linebreakIndex == SIZE_MAX)
                     {
                         // for superscript / subscript - the text height is already adjusted
                         float unscriptedTextHeight = m_formattingState.TextHeight + m_formattingState.Subscript + m_formattingState.Superscript;
@@ -1497,17 +1649,23 @@ namespace tgui  { namespace xhtml
                         break;
                     }
 
-                    formattedTextSection->setString(remainingText.substr(0, linebreakPosition));
-                    runLength = Text::getLineWidth(formattedTextSection->getString(), m_formattingState.TextFont, static_cast<unsigned int>(m_formattingState.TextHeight + 0.49f));
+                    const auto& linebreak = breakOpportunities[linebreakIndex];
+                    formattedTextSection->setString(text.substr(lineStart, linebreak.LineEnd - lineStart));
+                    auto runLength = textRunMeasure.getRunLength(lineStart, linebreak.LineEnd);
                     formattedTextSection->setRunLength(runLength + 0.45f);
                     m_evolvingLineRunLength += runLength;
                     formattedTextSection->setColor(m_formattingState.ForeColor);
                     formattedTextSection->setStyle(m_formattingState.Style);
 
-                    remainingText = remainingText.substr(linebreakPosition + 1);
-                    runLength = Text::getLineWidth(remainingText, m_formattingState.TextFont, static_cast<unsigned int>(m_formattingState.TextHeight + 0.49f));
+                    lineStart = linebreak.NextLineStart;
+                    if (linebreakIndex == mandatoryBreak)
+                    {
+                        mandatoryBreak++;
+                        while (mandatoryBreak < breakOpportunities.size() && !breakOpportunities[mandatoryBreak].IsMandatory)
+                            mandatoryBreak++;
+                    }
 
-                    if (remainingText.size() > 0)
+                    if (lineStart < text.size())
                     {
                         m_occupiedLayoutSize.x = std::max(m_occupiedLayoutSize.x, formattedTextSection->getLayoutLeft());
                         m_occupiedLayoutSize.y = formattedTextSection->getLayoutTop();
@@ -1532,10 +1690,10 @@ namespace tgui  { namespace xhtml
                     m_content.pop_back();
 
                 // process remaining text
-                if (remainingText.size() > 0)
+                if (lineStart < text.size())
                 {
-                    formattedTextSection->setString(remainingText);
-                    runLength = Text::getLineWidth(formattedTextSection->getString(), m_formattingState.TextFont, static_cast<unsigned int>(m_formattingState.TextHeight + 0.49f));
+                    formattedTextSection->setString(text.substr(lineStart));
+                    auto runLength = textRunMeasure.getRunLength(lineStart, text.size());
                     formattedTextSection->setRunLength(runLength + 0.49f);
                     m_evolvingLineRunLength += runLength;
                     formattedTextSection->setColor(m_formattingState.ForeColor);
@@ -1731,10 +1889,71 @@ namespace tgui  { namespace xhtml
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::string FormattedXhtmlDocument::readXhtmlDocumentUtf8(const std::string filePath, tgui::String& fileEncoding, std::string& errorMessage)
+    {
+        std::string   hypertextUtf8;
+        std::ifstream hypertextFile(filePath, std::ios::in | std::ios::binary);
+        if (hypertextFile.is_open())
+        {
+            hypertextFile.seekg (0, std::ios::end);
+            size_t fileSizeInByte = hypertextFile.tellg();
+            hypertextFile.seekg (0, std::ios::beg);
+            hypertextUtf8.resize(fileSizeInByte);
+            if (fileSizeInByte > 0)
+                hypertextFile.read(&hypertextUtf8[0], fileSizeInByte);
+            hypertextFile.close();
+
+            tgui::CharStringView hypertextView(hypertextUtf8);
+            if (!FormattedXhtmlDocument::detectXhtmlDocumentEncoding(hypertextView, fileEncoding, errorMessage))
+                hypertextUtf8.clear();
+            else if (hypertextView.size() != hypertextUtf8.size())
+                hypertextUtf8.erase(0, hypertextUtf8.size() - hypertextView.size());
+        }
+        else
+            errorMessage = "Unable to open file.";
+
+        return hypertextUtf8;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool FormattedXhtmlDocument::detectXhtmlDocumentEncoding(tgui::CharStringView& hypertextUtf8, tgui::String& fileEncoding,
+                                                             std::string& errorMessage)
+    {
+        if (hypertextUtf8.size() <= 2)
+        {
+            errorMessage = "File too small or empty.";
+            return false;
+        }
+        else if (((unsigned char)hypertextUtf8[0] == 254 && (unsigned char)hypertextUtf8[1] == 255) ||
+                 ((unsigned char)hypertextUtf8[0] == 255 && (unsigned char)hypertextUtf8[1] == 254))
+        {
+            fileEncoding = ((unsigned char)hypertextUtf8[0] == 254 ? U"UTF-16 BE" : U"UTF-16 LE");
+            errorMessage = "UTF-16 encoded files are not supported.";
+            return false;
+        }
+        else if ((unsigned char)hypertextUtf8[0] == 239 && (unsigned char)hypertextUtf8[1] == 187 && (unsigned char)hypertextUtf8[2] == 191)
+        {
+            fileEncoding = U"UTF-8";
+            hypertextUtf8.remove_prefix(3);
+        }
+        else
+        {
+            if (tgui::xhtml::UtfHelper::checkValid(hypertextUtf8.data(), hypertextUtf8.size()))
+                fileEncoding = U"UTF-8";
+            else
+                fileEncoding = U"ASCII";
+        }
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     std::vector<XhtmlElement::Ptr> FormattedXhtmlDocument::parseXhtmlDocument(const tgui::String hypertextString,
                                                                                   bool resolveEntities, bool trace)
     {
         XhtmlParser xhtmlParser(hypertextString);
+        xhtmlParser.setDiagnosticsMode(trace ? XhtmlDiagnosticsMode::Collect : XhtmlDiagnosticsMode::None);
         xhtmlParser.parseDocument(resolveEntities, trace);
 
         if (trace)
@@ -1751,4 +1970,67 @@ namespace tgui  { namespace xhtml
         return xhtmlParser.getRootElements();
     }
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<XhtmlElement::Ptr> FormattedXhtmlDocument::parseXhtmlDocumentUtf8(tgui::CharStringView hypertextUtf8,
+                                                                                      bool resolveEntities, bool trace)
+    {
+        XhtmlParser xhtmlParser(hypertextUtf8);
+        xhtmlParser.setDiagnosticsMode(trace ? XhtmlDiagnosticsMode::Collect : XhtmlDiagnosticsMode::None);
+        xhtmlParser.parseDocument(resolveEntities, trace);
+
+        if (trace)
+        {
+            auto errorMessages = xhtmlParser.getErrorMessages();
+            for (size_t index = 0; index < errorMessages->size(); index++)
+                std::wcerr << errorMessages->at(index) << std::endl;
+
+            auto warningMessages = xhtmlParser.getWarningMessages();
+            for (size_t index = 0; index < warningMessages->size(); index++)
+                std::wcout << warningMessages->at(index) << std::endl;
+        }
+
+        return xhtmlParser.getRootElements();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<XhtmlDocumentParseResult> FormattedXhtmlDocument::parseXhtmlDocumentsUtf8(const std::vector<tgui::CharStringView>& hypertextsUtf8,
+                                                                                           bool resolveEntities, unsigned int threadCount,
+                                                                                           XhtmlDiagnosticsMode diagnosticsMode)
+    {
+        std::vector<XhtmlDocumentParseResult> results(hypertextsUtf8.size());
+        runOnWorkerThreads(hypertextsUtf8.size(), threadCount, [&](size_t index)
+            {
+                results[index].Diagnostics.setMode(diagnosticsMode);
+
+                std::string errorMessage;
+                String fileEncoding;
+                tgui::CharStringView hypertextUtf8 = hypertextsUtf8[index];
+                if (!FormattedXhtmlDocument::detectXhtmlDocumentEncoding(hypertextUtf8, fileEncoding, errorMessage))
+                {
+                    results[index].State = -1;
+                    results[index].Diagnostics.report(XhtmlDiagnosticCode::DocumentNotReadable, errorMessage.c_str());
+                }
+                else
+                    parseIntoResult(hypertextUtf8, resolveEntities, false, results[index]);
+            });
+        return results;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<XhtmlDocumentParseResult> FormattedXhtmlDocument::loadXhtmlDocuments(const std::vector<std::string>& filePaths,
+                                                                                      bool resolveEntities, unsigned int threadCount,
+                                                                                      XhtmlDiagnosticsMode diagnosticsMode)
+    {
+        std::vector<XhtmlDocumentParseResult> results(filePaths.size());
+        runOnWorkerThreads(filePaths.size(), threadCount, [&](size_t index)
+            {
+                results[index].Diagnostics.setMode(diagnosticsMode);
+                loadIntoResult(filePaths[index], resolveEntities, false, results[index]);
+            });
+        return results;
+    }
+
 } }
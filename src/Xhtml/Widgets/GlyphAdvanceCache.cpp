@@ -0,0 +1,139 @@
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
+
+#include <TGUI/Config.hpp>
+#include <TGUI/TGUI.hpp>
+
+// MSC needs a clear distiction between "__declspec(dllimport)" (above) and "__declspec(dllexport)" (below) this comment.
+// So in the case of direct source file integration (in contrast to library creation and linking), the API must be 'dllexport'.
+#ifndef TGUI_STATIC
+#ifdef TGUI_SYSTEM_WINDOWS
+#undef TGUI_API
+#define TGUI_API __declspec(dllexport)
+#endif
+#endif
+
+#include "TGUI/Xhtml/Widgets/GlyphAdvanceCache.hpp"
+
+namespace tgui  { namespace xhtml
+{
+    namespace
+    {
+        /// @brief The code points below this limit are looked up directly, all others by map
+        constexpr char32_t DirectCodePointLimit = 0x100;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief The glyph advances and kernings of one font, character size and boldness
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct GlyphAdvanceTable
+        {
+            GlyphAdvanceTable()
+                : BackendFontRef(), DirectAdvances(DirectCodePointLimit, -1.0f), Advances(), Kernings()
+            { }
+
+            std::weak_ptr<BackendFont>     BackendFontRef; //!< The font, the table belongs to (to detect a reused address)
+            std::vector<float>             DirectAdvances; //!< The advances of the code points below the limit (negative if unknown)
+            std::map<char32_t, float>      Advances;       //!< The advances of all other code points
+            std::map<std::uint64_t, float> Kernings;       //!< The kernings by code point pair
+        };
+
+        using GlyphAdvanceTableKey = std::tuple<const BackendFont*, unsigned int, bool>;
+
+        std::mutex                                        glyphAdvanceTablesMutex; //!< The guard of the glyph advance tables
+        std::map<GlyphAdvanceTableKey, GlyphAdvanceTable> glyphAdvanceTables;      //!< The glyph advance tables
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Gets the (cached) advance of a glyph
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getGlyphAdvance(GlyphAdvanceTable& table, const Font& font, char32_t codePoint, unsigned int characterSize, bool bold)
+        {
+            if (codePoint < DirectCodePointLimit)
+            {
+                float& advance = table.DirectAdvances[codePoint];
+                if (advance < 0.0f)
+                    advance = font.getGlyph(codePoint, characterSize, bold).advance;
+                return advance;
+            }
+
+            auto iterator = table.Advances.find(codePoint);
+            if (iterator == table.Advances.end())
+                iterator = table.Advances.emplace(codePoint, font.getGlyph(codePoint, characterSize, bold).advance).first;
+            return iterator->second;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Gets the (cached) kerning between two glyphs
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getGlyphKerning(GlyphAdvanceTable& table, const Font& font, char32_t first, char32_t second, unsigned int characterSize, bool bold)
+        {
+            const std::uint64_t key = (static_cast<std::uint64_t>(first) << 32) | second;
+            auto iterator = table.Kernings.find(key);
+            if (iterator == table.Kernings.end())
+                iterator = table.Kernings.emplace(key, font.getKerning(first, second, characterSize, bold)).first;
+            return iterator->second;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void GlyphAdvanceCache::measure(const String& text, const Font& font, unsigned int characterSize, bool bold,
+                                    std::vector<float>& prefixRunLengths, std::vector<float>& kernings)
+    {
+        prefixRunLengths.assign(text.size() + 1, 0.0f);
+        kernings.assign(text.size(), 0.0f);
+        if (!font)
+            return;
+
+        auto backendFont = font.getBackendFont();
+        std::lock_guard<std::mutex> lock(glyphAdvanceTablesMutex);
+
+        const GlyphAdvanceTableKey key(backendFont.get(), characterSize, bold);
+        auto iterator = glyphAdvanceTables.find(key);
+        if (iterator == glyphAdvanceTables.end() || iterator->second.BackendFontRef.lock() != backendFont)
+        {
+            // drop the tables of destroyed fonts (one of them might have had the address of the new font) before adding a table
+            for (auto tableIterator = glyphAdvanceTables.begin(); tableIterator != glyphAdvanceTables.end(); )
+                tableIterator = (tableIterator->second.BackendFontRef.expired() ? glyphAdvanceTables.erase(tableIterator) : std::next(tableIterator));
+            iterator = glyphAdvanceTables.emplace(key, GlyphAdvanceTable()).first;
+            iterator->second.BackendFontRef = backendFont;
+        }
+        GlyphAdvanceTable& table = iterator->second;
+
+        // same accumulation as 'Text::getLineWidth()', so the prefixes are exactly what it would return for them
+        float    runLength = 0.0f;
+        char32_t previousCharacter = 0;
+        for (size_t position = 0; position < text.size(); position++)
+        {
+            const char32_t character = text[position];
+            if (character == U'\n')
+            {
+                // a new line doesn't add to the run length and doesn't kern with the next character
+                previousCharacter = 0;
+                prefixRunLengths[position + 1] = runLength;
+                continue;
+            }
+
+            float advance;
+            if (character == U'\t')
+                advance = getGlyphAdvance(table, font, U' ', characterSize, bold) * 4;
+            else
+                advance = getGlyphAdvance(table, font, character, characterSize, bold);
+            const float kerning = getGlyphKerning(table, font, previousCharacter, character, characterSize, bold);
+
+            runLength = runLength + advance + kerning;
+            kernings[position] = kerning;
+            prefixRunLengths[position + 1] = runLength;
+            previousCharacter = character;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void GlyphAdvanceCache::clear()
+    {
+        std::lock_guard<std::mutex> lock(glyphAdvanceTablesMutex);
+        glyphAdvanceTables.clear();
+    }
+} }